@@ -52,7 +52,8 @@ AssignmentClient::AssignmentClient(Assignment::Type requestAssignmentType, QStri
 {
     LogUtils::init();
 
-    DependencyManager::set<tracing::Tracer>();
+    // keep a flight recording of the last events, for the domain-server to request a trace of when something goes wrong
+    DependencyManager::set<tracing::Tracer>()->startRecording();
     DependencyManager::set<StatTracker>();
     DependencyManager::set<AccountManager>();
     DependencyManager::set<ResourceRequestObserver>();
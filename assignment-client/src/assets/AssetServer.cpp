@@ -117,13 +117,14 @@ void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetU
     qDebug() << "Starting bake for: " << assetPath << assetHash;
     auto it = _pendingBakes.find(assetHash);
     if (it == _pendingBakes.end()) {
-        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath);
+        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath, this);
         task->setAutoDelete(false);
         _pendingBakes[assetHash] = task;
 
         connect(task.get(), &BakeAssetTask::bakeComplete, this, &AssetServer::handleCompletedBake);
         connect(task.get(), &BakeAssetTask::bakeFailed, this, &AssetServer::handleFailedBake);
         connect(task.get(), &BakeAssetTask::bakeAborted, this, &AssetServer::handleAbortedBake);
+        connect(task.get(), &BakeAssetTask::ovenServerUnreachable, this, &AssetServer::handleUnreachableOvenServer);
 
         _bakingTaskPool.start(task.get());
     } else {
@@ -131,6 +132,95 @@ void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetU
     }
 }
 
+static const int MAX_OVEN_SERVER_RESTARTS = 3;
+// The oven server schedules bakes itself, so it's handed enough of them to keep its own queue filled
+static const int OVEN_SERVER_BAKE_TASK_COUNT = 64;
+
+QString AssetServer::getOvenServerName() const {
+    QMutexLocker lock(&_ovenServerNameMutex);
+    return _ovenServerName;
+}
+
+void AssetServer::setOvenServerName(const QString& serverName) {
+    QMutexLocker lock(&_ovenServerNameMutex);
+    _ovenServerName = serverName;
+}
+
+void AssetServer::startOvenServer() {
+    auto base = QFileInfo(QCoreApplication::applicationFilePath()).absoluteDir();
+    QString path = base.absolutePath() + "/oven";
+    QString serverName = "overte-oven-" + QString::number(QCoreApplication::applicationPid());
+
+    _ovenServerProcess.reset(new QProcess());
+    _ovenServerProcess->setProcessChannelMode(QProcess::ForwardedChannels);
+    // the oven server quits if the asset server goes away without stopping it
+    _ovenServerProcess->start(path, { "--server", serverName,
+                                      "--" + PARENT_PID_OPTION, QString::number(QCoreApplication::applicationPid()) });
+    if (!_ovenServerProcess->waitForStarted()) {
+        qCWarning(asset_server) << "Could not start oven server, baking every asset in its own oven process";
+        _ovenServerProcess.reset();
+        setOvenServerName(QString());
+        _bakingTaskPool.setMaxThreadCount(1);
+        return;
+    }
+
+    qCInfo(asset_server) << "Started oven server" << serverName;
+    setOvenServerName(serverName);
+    _bakingTaskPool.setMaxThreadCount(OVEN_SERVER_BAKE_TASK_COUNT);
+
+    connect(_ovenServerProcess.get(), static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
+            this, [this](int exitCode, QProcess::ExitStatus exitStatus) {
+        qCWarning(asset_server) << "Oven server exited:" << exitCode << exitStatus;
+        // bakes it was running fail on their own, the ones after them go to the restarted server
+        _ovenServerProcess.release()->deleteLater();
+        if (_ovenServerRestarts++ < MAX_OVEN_SERVER_RESTARTS) {
+            startOvenServer();
+        } else {
+            qCWarning(asset_server) << "Oven server keeps exiting, baking every asset in its own oven process";
+            setOvenServerName(QString());
+            _bakingTaskPool.setMaxThreadCount(1);
+        }
+    });
+}
+
+void AssetServer::stopOvenServer() {
+    if (!_ovenServerProcess) {
+        return;
+    }
+    disconnect(_ovenServerProcess.get(), nullptr, this, nullptr);
+    _ovenServerProcess->terminate();
+    if (!_ovenServerProcess->waitForFinished()) {
+        _ovenServerProcess->kill();
+        _ovenServerProcess->waitForFinished();
+    }
+    _ovenServerProcess.reset();
+    setOvenServerName(QString());
+}
+
+static const QString BAKE_RESULT_BAKED = "Baked";
+static const QString BAKE_RESULT_FAILED = "Failed";
+static const QString BAKE_RESULT_ABORTED = "Aborted";
+static const size_t RECENT_BAKE_COUNT = 20;
+
+void AssetServer::recordBakeTiming(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath,
+                                   const QString& result) {
+    auto it = _pendingBakes.find(assetHash);
+    if (it == _pendingBakes.end()) {
+        return;
+    }
+    const auto& task = it.value();
+    _recentBakes.push_back({ assetPath, result, task->getQueueMsecs(), task->getOvenQueueMsecs(), task->getBakeMsecs() });
+    if (_recentBakes.size() > RECENT_BAKE_COUNT) {
+        _recentBakes.pop_front();
+    }
+
+    if (result == BAKE_RESULT_BAKED) {
+        _completedBakeCount++;
+    } else if (result == BAKE_RESULT_FAILED) {
+        _failedBakeCount++;
+    }
+}
+
 QString AssetServer::getPathToAssetHash(const AssetUtils::AssetHash& assetHash) {
     return _filesDirectory.absoluteFilePath(assetHash);
 }
@@ -349,6 +439,8 @@ void AssetServer::aboutToFinish() {
     while (_pendingBakes.size() > 0) {
         QCoreApplication::processEvents();
     }
+
+    stopOvenServer();
 }
 
 void AssetServer::run() {
@@ -446,6 +538,7 @@ void AssetServer::completeSetup() {
 
         nodeList->addSetOfNodeTypesToNodeInterestSet({ NodeType::Agent, NodeType::EntityScriptServer });
 
+        startOvenServer();
         bakeAssets();
     } else {
         qCCritical(asset_server) << "Asset Server assignment will not continue because mapping file could not be loaded.";
@@ -967,6 +1060,36 @@ void AssetServer::sendStatsPacket() {
         serverStats[uuid] = nodeStats;
     });
 
+    {
+        int bakingCount = 0;
+        for (const auto& task : _pendingBakes) {
+            if (task->isBaking()) {
+                bakingCount++;
+            }
+        }
+
+        QJsonObject bakingStats;
+        bakingStats["1. Queued"] = _pendingBakes.size() - bakingCount;
+        bakingStats["2. Baking"] = bakingCount;
+        bakingStats["3. Baked"] = _completedBakeCount;
+        bakingStats["4. Failed"] = _failedBakeCount;
+        auto ovenServerName = getOvenServerName();
+        bakingStats["5. Oven Server"] = ovenServerName.isEmpty() ? "Not running" : ovenServerName;
+
+        QJsonObject recentBakeStats;
+        for (const auto& bake : _recentBakes) {
+            QJsonObject bakeStats;
+            bakeStats["1. Result"] = bake.result;
+            bakeStats["2. Queued (ms)"] = (qint64)bake.queueMsecs;
+            bakeStats["3. Oven Queued (ms)"] = (qint64)bake.ovenQueueMsecs;
+            bakeStats["4. Baked (ms)"] = (qint64)bake.bakeMsecs;
+            recentBakeStats[bake.assetPath] = bakeStats;
+        }
+        bakingStats["6. Recent Bakes"] = recentBakeStats;
+
+        serverStats["Baking"] = bakingStats;
+    }
+
     // send off the stats packets
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(serverStats);
 }
@@ -1319,6 +1442,7 @@ void AssetServer::handleFailedBake(QString originalAssetHash, QString assetPath,
 
     writeMetaFile(originalAssetHash, meta);
 
+    recordBakeTiming(originalAssetHash, assetPath, BAKE_RESULT_FAILED);
     _pendingBakes.remove(originalAssetHash);
 }
 
@@ -1342,6 +1466,7 @@ void AssetServer::handleCompletedBake(QString originalAssetHash, QString origina
 
         writeMetaFile(originalAssetHash, meta);
 
+        recordBakeTiming(originalAssetHash, originalAssetPath, errorCompletingBake ? BAKE_RESULT_FAILED : BAKE_RESULT_BAKED);
         _pendingBakes.remove(originalAssetHash);
     };
 
@@ -1475,9 +1600,32 @@ void AssetServer::handleAbortedBake(QString originalAssetHash, QString assetPath
     qDebug() << "Aborted bake:" << originalAssetHash;
 
     // for an aborted bake we don't do anything but remove the BakeAssetTask from our pending bakes
+    recordBakeTiming(originalAssetHash, assetPath, BAKE_RESULT_ABORTED);
     _pendingBakes.remove(originalAssetHash);
 }
 
+void AssetServer::handleUnreachableOvenServer(QString originalAssetHash, QString assetPath) {
+    auto it = _pendingBakes.find(originalAssetHash);
+    if (it == _pendingBakes.end()) {
+        return;
+    }
+    if (it.value()->wasAborted()) {
+        handleAbortedBake(originalAssetHash, assetPath);
+        return;
+    }
+
+    // the first task to give up on a running server stops it, the others only need to be started again
+    if (_ovenServerProcess) {
+        qCWarning(asset_server) << "Oven server" << getOvenServerName() << "is not accepting bakes,"
+            << "baking every asset in its own oven process";
+        stopOvenServer();
+        _bakingTaskPool.setMaxThreadCount(1);
+    }
+
+    qDebug() << "Restarting bake for" << assetPath << originalAssetHash;
+    _bakingTaskPool.start(it.value().get());
+}
+
 static const QString BAKE_VERSION_KEY = "bake_version";
 static const QString FAILED_LAST_BAKE_KEY = "failed_last_bake";
 static const QString LAST_BAKE_ERRORS_KEY = "last_bake_errors";
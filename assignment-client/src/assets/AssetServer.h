@@ -14,9 +14,13 @@
 
 #include <QtCore/QDir>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QProcess>
 #include <QtCore/QThreadPool>
 #include <QRunnable>
 
+#include <deque>
+#include <memory>
+
 #include <ThreadedAssignment.h>
 
 #include "AssetUtils.h"
@@ -69,6 +73,14 @@ struct AssetMeta {
     QString redirectTarget;
 };
 
+struct BakeTiming {
+    AssetUtils::AssetPath assetPath;
+    QString result;
+    quint64 queueMsecs;
+    quint64 ovenQueueMsecs;
+    quint64 bakeMsecs;
+};
+
 class BakeAssetTask;
 
 class AssetServer : public ThreadedAssignment {
@@ -76,6 +88,9 @@ class AssetServer : public ThreadedAssignment {
 public:
     AssetServer(ReceivedMessage& message);
 
+    // Thread-safe, empty when bakes run in their own oven process
+    QString getOvenServerName() const;
+
     void aboutToFinish() override;
 
 public slots:
@@ -137,10 +152,17 @@ private:
     bool needsToBeBaked(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& assetHash);
     void bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath);
 
+    /// Start the oven server that bakes are sent to, falling back to an oven process per bake if it can't run
+    void startOvenServer();
+    void stopOvenServer();
+    void setOvenServerName(const QString& serverName);
+    void recordBakeTiming(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& result);
+
     /// Move baked content for asset to baked directory and update baked status
     void handleCompletedBake(QString originalAssetHash, QString assetPath, QString bakedTempOutputDir);
     void handleFailedBake(QString originalAssetHash, QString assetPath, QString errors);
     void handleAbortedBake(QString originalAssetHash, QString assetPath);
+    void handleUnreachableOvenServer(QString originalAssetHash, QString assetPath);
 
     /// Create meta file to describe baked content for original asset
     std::pair<bool, AssetMeta> readMetaFile(AssetUtils::AssetHash hash);
@@ -160,6 +182,16 @@ private:
     QHash<AssetUtils::AssetHash, std::shared_ptr<BakeAssetTask>> _pendingBakes;
     QThreadPool _bakingTaskPool;
 
+    std::unique_ptr<QProcess> _ovenServerProcess;
+    mutable QMutex _ovenServerNameMutex;
+    QString _ovenServerName;
+    int _ovenServerRestarts { 0 };
+
+    // the most recent bakes, for the stats page
+    std::deque<BakeTiming> _recentBakes;
+    int _completedBakeCount { 0 };
+    int _failedBakeCount { 0 };
+
     QMutex _queuedRequestsMutex;
     bool _isQueueingRequests { true };
     using RequestQueue = QVector<QPair<QSharedPointer<ReceivedMessage>, SharedNodePointer>>;
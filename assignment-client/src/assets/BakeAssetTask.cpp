@@ -13,21 +13,34 @@
 
 #include <mutex>
 
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
 #include <QtCore/QThread>
 #include <QCoreApplication>
 
+#include <NumericalConstants.h>
 #include <PathUtils.h>
+#include <SharedUtil.h>
+
+#include "AssetServer.h"
 
 static const int OVEN_STATUS_CODE_SUCCESS { 0 };
 static const int OVEN_STATUS_CODE_FAIL { 1 };
 static const int OVEN_STATUS_CODE_ABORT { 2 };
 
+static const int OVEN_SERVER_CONNECT_TIMEOUT_MSECS { 10 * MSECS_PER_SECOND };
+static const int OVEN_SERVER_POLL_INTERVAL_MSECS { 100 };
+
 std::once_flag registerMetaTypesFlag;
 
-BakeAssetTask::BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath) :
+BakeAssetTask::BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath,
+                             AssetServer* assetServer) :
     _assetHash(assetHash),
     _assetPath(assetPath),
-    _filePath(filePath)
+    _filePath(filePath),
+    _assetServer(assetServer),
+    _queuedTime(usecTimestampNow())
 {
 
     std::call_once(registerMetaTypesFlag, []() {
@@ -42,6 +55,9 @@ void BakeAssetTask::run() {
         return;
     }
 
+    auto startTime = usecTimestampNow();
+    _queueMsecs = (startTime - _queuedTime) / USECS_PER_MSEC;
+
     // Make a new temporary directory for the Oven to work in
     QString tempOutputDir = PathUtils::generateTemporaryDir();
     QString tempOutputDirName = QDir(tempOutputDir).dirName();
@@ -72,13 +88,34 @@ void BakeAssetTask::run() {
         "-t", extension,
     };
 
+    // The oven server may have been restarted or given up on since the task was queued
+    QString ovenServerName = _assetServer ? _assetServer->getOvenServerName() : QString();
+    QLocalSocket ovenServerSocket;
+    if (!ovenServerName.isEmpty()) {
+        if (connectToOvenServer(ovenServerSocket, ovenServerName)) {
+            bakeOnOvenServer(ovenServerSocket, tempAssetPath, tempOutputDir, extension);
+            return;
+        }
+        PathUtils::deleteMyTemporaryDir(tempOutputDirName);
+        if (_wasAborted) {
+            emit bakeAborted(_assetHash, _assetPath);
+        } else {
+            // Every task of the pool sized for the oven server would start its own oven process, leave it to the
+            // asset server to go back to baking one asset at a time and run the task again
+            _isBaking = false;
+            emit ovenServerUnreachable(_assetHash, _assetPath);
+        }
+        return;
+    }
+
     _ovenProcess.reset(new QProcess());
 
     QEventLoop loop;
 
     connect(_ovenProcess.get(), static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
-            this, [&loop, this, tempOutputDir, tempAssetPath, tempOutputDirName](int exitCode, QProcess::ExitStatus exitStatus) {
+            this, [&loop, this, startTime, tempOutputDir, tempAssetPath, tempOutputDirName](int exitCode, QProcess::ExitStatus exitStatus) {
         qDebug() << "Baking process finished: " << exitCode << exitStatus;
+        _bakeMsecs = (usecTimestampNow() - startTime) / USECS_PER_MSEC;
 
         if (exitStatus == QProcess::CrashExit) {
             PathUtils::deleteMyTemporaryDir(tempOutputDirName);
@@ -127,18 +164,98 @@ void BakeAssetTask::run() {
 
     _isBaking = true;
 
+    if (_wasAborted) {
+        // abort() arrived before there was a process to terminate, the finished handler reports the abort
+        _ovenProcess->terminate();
+    }
+
     loop.exec();
 }
 
+bool BakeAssetTask::connectToOvenServer(QLocalSocket& socket, const QString& ovenServerName) {
+    // the server may still be starting up
+    QElapsedTimer timer;
+    timer.start();
+    while (!_wasAborted) {
+        socket.connectToServer(ovenServerName);
+        if (socket.waitForConnected(OVEN_SERVER_CONNECT_TIMEOUT_MSECS)) {
+            return true;
+        }
+        if (timer.hasExpired(OVEN_SERVER_CONNECT_TIMEOUT_MSECS)) {
+            break;
+        }
+        QThread::msleep(OVEN_SERVER_POLL_INTERVAL_MSECS);
+    }
+    if (_wasAborted) {
+        return false;
+    }
+    qWarning() << "Could not connect to oven server" << ovenServerName << "-" << socket.errorString()
+        << "- while baking" << _assetPath;
+    return false;
+}
+
+void BakeAssetTask::bakeOnOvenServer(QLocalSocket& socket, const QString& tempAssetPath, const QString& tempOutputDir,
+                                     const QString& extension) {
+    QString tempOutputDirName = QDir(tempOutputDir).dirName();
+
+    QJsonObject job;
+    job["id"] = _assetHash;
+    job["input"] = tempAssetPath;
+    job["output"] = tempOutputDir;
+    job["type"] = extension;
+    socket.write(QJsonDocument(job).toJson(QJsonDocument::Compact) + '\n');
+
+    qDebug() << "Sent" << _assetPath << "to oven server";
+
+    // closing the connection aborts the job on the server
+    while (!socket.canReadLine()) {
+        if (_wasAborted) {
+            socket.abort();
+            PathUtils::deleteMyTemporaryDir(tempOutputDirName);
+            emit bakeAborted(_assetHash, _assetPath);
+            return;
+        }
+        if (socket.state() != QLocalSocket::ConnectedState) {
+            PathUtils::deleteMyTemporaryDir(tempOutputDirName);
+            QString errors = "Fatal error occurred while baking";
+            emit bakeFailed(_assetHash, _assetPath, errors);
+            return;
+        }
+        socket.waitForReadyRead(OVEN_SERVER_POLL_INTERVAL_MSECS);
+    }
+
+    auto reply = QJsonDocument::fromJson(socket.readLine()).object();
+    int statusCode = reply["status"].toInt(OVEN_STATUS_CODE_FAIL);
+    _ovenQueueMsecs = reply["queueMsecs"].toVariant().toULongLong();
+    _bakeMsecs = reply["bakeMsecs"].toVariant().toULongLong();
+    qDebug() << "Oven server finished baking" << _assetPath << "with status" << statusCode;
+
+    if (statusCode == OVEN_STATUS_CODE_SUCCESS) {
+        emit bakeComplete(_assetHash, _assetPath, tempOutputDir);
+    } else if (statusCode == OVEN_STATUS_CODE_ABORT) {
+        _wasAborted.store(true);
+        PathUtils::deleteMyTemporaryDir(tempOutputDirName);
+        emit bakeAborted(_assetHash, _assetPath);
+    } else {
+        QString errors = reply["errors"].toString();
+        if (errors.isEmpty()) {
+            errors = "Unknown error occurred while baking";
+        }
+        PathUtils::deleteMyTemporaryDir(tempOutputDirName);
+        emit bakeFailed(_assetHash, _assetPath, errors);
+    }
+}
+
 void BakeAssetTask::abort() {
     if (QThread::currentThread() != thread()) {
         QMetaObject::invokeMethod(this, "abort");
         return;
     }
     qDebug() << "Aborting BakeAssetTask for" << _assetHash;
-    if (_ovenProcess->state() != QProcess::NotRunning) {
+    // run() checks this before it starts an oven process, and the oven server job notices on its own
+    _wasAborted = true;
+    if (_ovenProcess && _ovenProcess->state() != QProcess::NotRunning) {
         qDebug() << "Teminating oven process for" << _assetHash;
-        _wasAborted = true;
         _ovenProcess->terminate();
     }
 }
@@ -18,19 +18,29 @@
 #include <QtCore/QObject>
 #include <QtCore/QRunnable>
 #include <QDir>
+#include <QLocalSocket>
 #include <QProcess>
 
 #include <AssetUtils.h>
 
+class AssetServer;
+
 class BakeAssetTask : public QObject, public QRunnable {
     Q_OBJECT
 public:
-    BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath);
+    /// Bakes through the asset server's oven server if it is running one when the task runs, otherwise in a new oven process
+    BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath,
+                  AssetServer* assetServer = nullptr);
 
     // Thread-safe inspection methods
     bool isBaking() { return _isBaking.load(); }
     bool wasAborted() const { return _wasAborted.load(); }
 
+    // How long the task waited for a thread, waited in the oven server's queue and baked, valid once it has finished
+    quint64 getQueueMsecs() const { return _queueMsecs.load(); }
+    quint64 getOvenQueueMsecs() const { return _ovenQueueMsecs.load(); }
+    quint64 getBakeMsecs() const { return _bakeMsecs.load(); }
+
     void run() override;
 
 public slots:
@@ -40,14 +50,27 @@ signals:
     void bakeComplete(QString assetHash, QString assetPath, QString tempOutputDir);
     void bakeFailed(QString assetHash, QString assetPath, QString errors);
     void bakeAborted(QString assetHash, QString assetPath);
-    
+    // The oven server couldn't be reached, the task can be started again once the asset server has dealt with it
+    void ovenServerUnreachable(QString assetHash, QString assetPath);
+
+
 private:
+    bool connectToOvenServer(QLocalSocket& socket, const QString& ovenServerName);
+    void bakeOnOvenServer(QLocalSocket& socket, const QString& tempAssetPath, const QString& tempOutputDir,
+                          const QString& extension);
+
     std::atomic<bool> _isBaking { false };
     AssetUtils::AssetHash _assetHash;
     AssetUtils::AssetPath _assetPath;
     QString _filePath;
     std::unique_ptr<QProcess> _ovenProcess { nullptr };
     std::atomic<bool> _wasAborted { false };
+    AssetServer* _assetServer;
+
+    quint64 _queuedTime;
+    std::atomic<quint64> _queueMsecs { 0 };
+    std::atomic<quint64> _ovenQueueMsecs { 0 };
+    std::atomic<quint64> _bakeMsecs { 0 };
 };
 
 #endif // hifi_BakeAssetTask_h
@@ -92,6 +92,8 @@ AvatarMixer::AvatarMixer(ReceivedMessage& message) :
         PacketReceiver::makeSourcedListenerReference<AvatarMixer>(this, &AvatarMixer::queueIncomingPacket));
     packetReceiver.registerListener(PacketType::BulkAvatarTraitsAck,
         PacketReceiver::makeSourcedListenerReference<AvatarMixer>(this, &AvatarMixer::queueIncomingPacket));
+    packetReceiver.registerListener(PacketType::AvatarTraitHashes,
+        PacketReceiver::makeSourcedListenerReference<AvatarMixer>(this, &AvatarMixer::queueIncomingPacket));
     packetReceiver.registerListenerForTypes({ PacketType::OctreeStats, PacketType::EntityData, PacketType::EntityErase },
         PacketReceiver::makeSourcedListenerReference<AvatarMixer>(this, &AvatarMixer::handleOctreePacket));
 
@@ -783,6 +785,9 @@ void AvatarMixer::sendStatsPacket() {
     QJsonObject singleCoreTasks;
     singleCoreTasks["processEvents"] = TIGHT_LOOP_STAT_UINT64(_processEventsElapsedTime);
     singleCoreTasks["queueIncomingPacket"] = TIGHT_LOOP_STAT_UINT64(_queueIncomingPacketElapsedTime);
+    quint64 spatialHashElapsedTime = _workerPool.getSpatialHashElapsedTime();
+    singleCoreTasks["rebuildSpatialHash"] = TIGHT_LOOP_STAT_UINT64(spatialHashElapsedTime);
+    _workerPool.resetSpatialHashElapsedTime();
 
     QJsonObject incomingPacketStats;
     incomingPacketStats["handleAvatarIdentityPacket"] = TIGHT_LOOP_STAT_UINT64(_handleAvatarIdentityPacketElapsedTime);
@@ -847,6 +852,13 @@ void AvatarMixer::sendStatsPacket() {
     workersAggregatObject["sent_5_averageTraitsBytes"] = TIGHT_LOOP_STAT(aggregateStats.numTraitsBytesSent);
     workersAggregatObject["sent_6_averageIdentityBytes"] = TIGHT_LOOP_STAT(aggregateStats.numIdentityBytesSent);
     workersAggregatObject["sent_7_averageHeroAvatars"] = TIGHT_LOOP_STAT(aggregateStats.numHeroesIncluded);
+    workersAggregatObject["sent_8_averageTraitsBytesDeduplicated"] =
+        TIGHT_LOOP_STAT(aggregateStats.numTraitsBytesDeduplicated);
+
+    float averageCandidates = averageNodes ? aggregateStats.numCandidatesConsidered / averageNodes : 0.0f;
+    workersAggregatObject["sort_1_averageCandidates"] = TIGHT_LOOP_STAT(averageCandidates);
+    float averageCandidatesCulled = averageNodes ? aggregateStats.numCandidatesCulled / averageNodes : 0.0f;
+    workersAggregatObject["sort_2_averageCandidatesCulled"] = TIGHT_LOOP_STAT(averageCandidatesCulled);
 
     workersAggregatObject["timing_1_processIncomingPackets"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processIncomingPacketsElapsedTime);
     workersAggregatObject["timing_2_ignoreCalculation"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.ignoreCalculationElapsedTime);
@@ -854,6 +866,7 @@ void AvatarMixer::sendStatsPacket() {
     workersAggregatObject["timing_4_avatarDataPacking"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.avatarDataPackingElapsedTime);
     workersAggregatObject["timing_5_packetSending"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.packetSendingElapsedTime);
     workersAggregatObject["timing_6_jobElapsedTime"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.jobElapsedTime);
+    workersAggregatObject["timing_7_prioritySort"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.prioritySortElapsedTime);
 
     statsObject["workers_aggregate (per frame)"] = workersAggregatObject;
 
@@ -1040,6 +1053,16 @@ void AvatarMixer::parseDomainServerSettings(const QJsonObject& domainSettings) {
         }
     }
 
+    {   // Number of other avatars each listener prioritizes exactly, the rest are culled by spatial hash cell:
+        static const QString MAX_CANDIDATES_KEY = "max_candidates_per_listener";
+        bool ok;
+        int maxCandidates = avatarMixerGroupObject[MAX_CANDIDATES_KEY].toString().toInt(&ok);
+        if (ok) {
+            _workerPool.setMaxCandidatesPerListener(std::max(0, maxCandidates));
+            qCDebug(avatars) << "Avatar mixer will prioritize at most" << maxCandidates << "avatars per listener";
+        }
+    }
+
     const QString AVATARS_SETTINGS_KEY = "avatars";
 
     static const QString MIN_HEIGHT_OPTION = "min_avatar_height";
@@ -45,6 +45,31 @@ void AvatarMixerClientData::setLastOtherAvatarEncodeTime(NLPacket::LocalID other
     }
 }
 
+uint64_t AvatarMixerClientData::getLastCellGatherTime(uint64_t cellKey) const {
+    const auto itr = _lastCellGatherTimes.find(cellKey);
+    if (itr != _lastCellGatherTimes.end()) {
+        return itr->second;
+    }
+    return 0;
+}
+
+void AvatarMixerClientData::pruneCellGatherTimes(uint64_t now) {
+    static const uint64_t CELL_GATHER_TIMES_PRUNE_INTERVAL = USECS_PER_SECOND;
+    static const uint64_t CELL_GATHER_TIME_EXPIRY = 10 * USECS_PER_SECOND;
+    if (now - _lastCellGatherTimesPrune < CELL_GATHER_TIMES_PRUNE_INTERVAL) {
+        return;
+    }
+    _lastCellGatherTimesPrune = now;
+
+    for (auto itr = _lastCellGatherTimes.begin(); itr != _lastCellGatherTimes.end();) {
+        if (now - itr->second > CELL_GATHER_TIME_EXPIRY) {
+            itr = _lastCellGatherTimes.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+}
+
 void AvatarMixerClientData::queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node) {
     if (!_packetQueue.node) {
         _packetQueue.node = node;
@@ -73,6 +98,9 @@ int AvatarMixerClientData::processPackets(const WorkerSharedData& workerSharedDa
             case PacketType::BulkAvatarTraitsAck:
                 processBulkAvatarTraitsAckMessage(*packet);
                 break;
+            case PacketType::AvatarTraitHashes:
+                processTraitHashesMessage(*packet);
+                break;
             default:
                 Q_UNREACHABLE();
         }
@@ -237,6 +265,9 @@ void AvatarMixerClientData::processSetTraitsMessage(ReceivedMessage& message,
                         // to track a deleted instance but keep version information
                         // the avatar mixer uses the negative value of the sent version
                         instanceVersionRef = -packetTraitVersion;
+
+                        std::lock_guard<std::mutex> lock(_encodedTraitsMutex);
+                        _encodedTraits[traitType].erase(instanceID);
                     } else {
                         // Don't accept avatar entity data for distribution unless sender has rez permissions on the domain.
                         // The sender shouldn't be sending avatar entity data, however this provides a back-up.
@@ -276,6 +307,10 @@ void AvatarMixerClientData::emulateDeleteEntitiesTraitsMessage(const QList<QUuid
         _avatar->processDeletedTraitInstance(traitType, entityID);
         // Mixer doesn't need deleted IDs.
         _avatar->getAndClearRecentlyRemovedIDs();
+        {
+            std::lock_guard<std::mutex> lock(_encodedTraitsMutex);
+            _encodedTraits[traitType].erase(entityID);
+        }
 
         // to track a deleted instance but keep version information
         // the avatar mixer uses the negative value of the sent version
@@ -344,6 +379,79 @@ void AvatarMixerClientData::processBulkAvatarTraitsAckMessage(ReceivedMessage& m
     }
 }
 
+void AvatarMixerClientData::processTraitHashesMessage(ReceivedMessage& message) {
+    if (message.getBytesLeftToRead() < qint64(sizeof(AvatarTraits::TraitHashesReport))) {
+        return;
+    }
+    AvatarTraits::TraitHashesReport report;
+    message.readPrimitive(&report);
+
+    switch (report) {
+        case AvatarTraits::KnownTraitHashes:
+            // a newly connected client reports the trait blobs it still has from earlier sessions
+            while (message.getBytesLeftToRead() >= qint64(sizeof(AvatarTraits::TraitHash)) &&
+                   _knownTraitHashes.size() < (size_t)AvatarTraits::MAX_REPORTED_TRAIT_HASHES) {
+                AvatarTraits::TraitHash traitHash;
+                message.readPrimitive(&traitHash);
+                _knownTraitHashes.insert(traitHash);
+            }
+            break;
+        case AvatarTraits::EvictedTraitHashes:
+            while (message.getBytesLeftToRead() >= qint64(sizeof(AvatarTraits::TraitHash))) {
+                AvatarTraits::TraitHash traitHash;
+                message.readPrimitive(&traitHash);
+                _knownTraitHashes.erase(traitHash);
+            }
+            break;
+        case AvatarTraits::MissingTraitHashes: {
+            // the client evicted these before it heard about them, so it dropped the traits we referenced them in
+            auto nodeList = DependencyManager::get<NodeList>();
+            while (message.getBytesLeftToRead() >= qint64(NUM_BYTES_RFC4122_UUID + sizeof(AvatarTraits::TraitHash))) {
+                auto avatarID = QUuid::fromRfc4122(message.readWithoutCopy(NUM_BYTES_RFC4122_UUID));
+                AvatarTraits::TraitHash traitHash;
+                message.readPrimitive(&traitHash);
+                _knownTraitHashes.erase(traitHash);
+
+                auto avatarNode = nodeList->nodeWithUUID(avatarID);
+                if (avatarNode) {
+                    resetSentTraitData(avatarNode->getLocalID());
+                }
+            }
+            break;
+        }
+        default:
+            qCDebug(avatars) << "Ignoring unknown trait hashes report" << (int)report;
+            break;
+    }
+}
+
+AvatarMixerClientData::EncodedTrait AvatarMixerClientData::getEncodedTrait(AvatarTraits::TraitType traitType,
+                                                                           AvatarTraits::TraitVersion traitVersion) const {
+    std::lock_guard<std::mutex> lock(_encodedTraitsMutex);
+    auto& encodedTrait = _encodedTraits[traitType][AvatarTraits::TraitInstanceID()];
+    if (encodedTrait.version != traitVersion) {
+        encodedTrait.version = traitVersion;
+        encodedTrait.data = _avatar->packTrait(traitType);
+        encodedTrait.hash = AvatarTraits::isHashableTraitData(encodedTrait.data) ?
+            AvatarTraits::hashTraitData(encodedTrait.data) : 0;
+    }
+    return encodedTrait;
+}
+
+AvatarMixerClientData::EncodedTrait AvatarMixerClientData::getEncodedTraitInstance(AvatarTraits::TraitType traitType,
+                                                                                   AvatarTraits::TraitInstanceID instanceID,
+                                                                                   AvatarTraits::TraitVersion traitVersion) const {
+    std::lock_guard<std::mutex> lock(_encodedTraitsMutex);
+    auto& encodedTrait = _encodedTraits[traitType][instanceID];
+    if (encodedTrait.version != traitVersion) {
+        encodedTrait.version = traitVersion;
+        encodedTrait.data = _avatar->packTraitInstance(traitType, instanceID);
+        encodedTrait.hash = AvatarTraits::isHashableTraitData(encodedTrait.data) ?
+            AvatarTraits::hashTraitData(encodedTrait.data) : 0;
+    }
+    return encodedTrait;
+}
+
 void AvatarMixerClientData::checkSkeletonURLAgainstAllowlist(const WorkerSharedData& workerSharedData,
                                                              Node& sendingNode,
                                                              AvatarTraits::TraitVersion traitVersion) {
@@ -507,6 +615,7 @@ void AvatarMixerClientData::cleanupKilledNode(const QUuid&, Node::LocalID nodeLo
     removeLastBroadcastSequenceNumber(nodeLocalID);
     removeLastBroadcastTime(nodeLocalID);
     _lastSentTraitsTimestamps.erase(nodeLocalID);
+    _lastOtherAvatarSentJointKeyframes.erase(nodeLocalID);
     _perNodeSentTraitVersions.erase(nodeLocalID);
     _perNodeAckedTraitVersions.erase(nodeLocalID);
     for (auto&& pendingTraitVersions : _perNodePendingTraitVersions) {
@@ -13,8 +13,11 @@
 #define hifi_AvatarMixerClientData_h
 
 #include <algorithm>
+#include <array>
 #include <cfloat>
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <queue>
 
@@ -128,6 +131,9 @@ public:
     void setLastOtherAvatarEncodeTime(NLPacket::LocalID otherAvatar, uint64_t time);
 
     QVector<JointData>& getLastOtherAvatarSentJoints(NLPacket::LocalID otherAvatar) { return _lastOtherAvatarSentJoints[otherAvatar]; }
+    AvatarDataPacket::JointKeyframe& getLastOtherAvatarSentJointKeyframe(NLPacket::LocalID otherAvatar) {
+        return _lastOtherAvatarSentJointKeyframes[otherAvatar];
+    }
 
     void queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node);
     int processPackets(const WorkerSharedData& workerSharedData); // returns number of packets processed
@@ -135,6 +141,7 @@ public:
     void processSetTraitsMessage(ReceivedMessage& message, const WorkerSharedData& workerSharedData, Node& sendingNode);
     void emulateDeleteEntitiesTraitsMessage(const QList<QUuid>& avatarEntityIDs);
     void processBulkAvatarTraitsAckMessage(ReceivedMessage& message);
+    void processTraitHashesMessage(ReceivedMessage& message);
     void checkSkeletonURLAgainstAllowlist(const WorkerSharedData& workerSharedData, Node& sendingNode,
                                           AvatarTraits::TraitVersion traitVersion);
 
@@ -160,6 +167,26 @@ public:
 
     void resetSentTraitData(Node::LocalID nodeID);
 
+    // trait blobs of this avatar, packed once per version and shared by all listeners
+    struct EncodedTrait {
+        AvatarTraits::TraitVersion version { AvatarTraits::NULL_TRAIT_VERSION };
+        QByteArray data;
+        AvatarTraits::TraitHash hash { 0 };
+    };
+    EncodedTrait getEncodedTrait(AvatarTraits::TraitType traitType, AvatarTraits::TraitVersion traitVersion) const;
+    EncodedTrait getEncodedTraitInstance(AvatarTraits::TraitType traitType, AvatarTraits::TraitInstanceID instanceID,
+                                         AvatarTraits::TraitVersion traitVersion) const;
+
+    // last time the avatars of a far away spatial hash cell were candidates for this listener
+    uint64_t getLastCellGatherTime(uint64_t cellKey) const;
+    void setLastCellGatherTime(uint64_t cellKey, uint64_t time) { _lastCellGatherTimes[cellKey] = time; }
+    // forgets cells that haven't been gathered for a while, which sort as if they had never been gathered
+    void pruneCellGatherTimes(uint64_t now);
+
+    // trait blobs this listener has, either reported by the client or sent to it by us
+    bool hasTraitHash(AvatarTraits::TraitHash traitHash) const { return _knownTraitHashes.count(traitHash) > 0; }
+    void addTraitHash(AvatarTraits::TraitHash traitHash) { _knownTraitHashes.insert(traitHash); }
+
 private:
     struct PacketQueue : public std::queue<QSharedPointer<ReceivedMessage>> {
         QWeakPointer<Node> node;
@@ -176,6 +203,14 @@ private:
     // sending to "this" node
     std::unordered_map<NLPacket::LocalID, uint64_t> _lastOtherAvatarEncodeTime;
     std::unordered_map<NLPacket::LocalID, QVector<JointData>> _lastOtherAvatarSentJoints;
+    // the joint rotations of the last SendAllData update of an "other" avatar, used to delta code later updates
+    std::unordered_map<NLPacket::LocalID, AvatarDataPacket::JointKeyframe> _lastOtherAvatarSentJointKeyframes;
+
+    std::unordered_map<uint64_t, uint64_t> _lastCellGatherTimes;
+    uint64_t _lastCellGatherTimesPrune { 0 };
+    std::unordered_set<AvatarTraits::TraitHash> _knownTraitHashes;
+    mutable std::mutex _encodedTraitsMutex;
+    mutable std::array<std::unordered_map<AvatarTraits::TraitInstanceID, EncodedTrait>, AvatarTraits::NUM_TRAITS> _encodedTraits;
 
     uint64_t _identityChangeTimestamp;
     bool _avatarSessionDisplayNameMustChange{ true };
@@ -33,6 +33,7 @@
 
 #include "AvatarMixer.h"
 #include "AvatarMixerClientData.h"
+#include "AvatarSpatialHash.h"
 
 namespace chrono = std::chrono;
 
@@ -44,13 +45,16 @@ void AvatarMixerWorker::configure(ConstIter begin, ConstIter end) {
 void AvatarMixerWorker::configureBroadcast(ConstIter begin, ConstIter end, 
                                 p_high_resolution_clock::time_point lastFrameTimestamp,
                                 float maxKbpsPerNode, float throttlingRatio,
-                                float priorityReservedFraction) {
+                                float priorityReservedFraction,
+                                const AvatarSpatialHash* spatialHash, int maxCandidatesPerListener) {
     _begin = begin;
     _end = end;
     _lastFrameTimestamp = lastFrameTimestamp;
     _maxKbpsPerNode = maxKbpsPerNode;
     _throttlingRatio = throttlingRatio;
     _avatarHeroFraction = priorityReservedFraction;
+    _spatialHash = spatialHash;
+    _maxCandidatesPerListener = maxCandidatesPerListener;
 }
 
 void AvatarMixerWorker::harvestStats(AvatarMixerWorkerStats& stats) {
@@ -98,6 +102,24 @@ qint64 AvatarMixerWorker::addTraitsNodeHeader(AvatarMixerClientData* listeningNo
     return bytesWritten;
 }
 
+qint64 AvatarMixerWorker::packEncodedTrait(AvatarMixerClientData* listeningNodeData,
+                                          const AvatarMixerClientData::EncodedTrait& encodedTrait,
+                                          const std::function<qint64(bool)>& packer) {
+    if (!AvatarTraits::isHashableTraitData(encodedTrait.data)) {
+        return packer(false);
+    }
+
+    // the traits packet list is reliable and ordered, so once we've written a blob the listener has it
+    bool sendHashOnly = listeningNodeData->hasTraitHash(encodedTrait.hash);
+    qint64 bytesWritten = packer(sendHashOnly);
+    if (sendHashOnly) {
+        _stats.numTraitsBytesDeduplicated += encodedTrait.data.size();
+    } else if (bytesWritten > 0) {
+        listeningNodeData->addTraitHash(encodedTrait.hash);
+    }
+    return bytesWritten;
+}
+
 qint64 AvatarMixerWorker::addChangedTraitsToBulkPacket(AvatarMixerClientData* listeningNodeData,
                                                       const AvatarMixerClientData* sendingNodeData,
                                                       NLPacketList& traitsPacketList) {
@@ -121,8 +143,6 @@ qint64 AvatarMixerWorker::addChangedTraitsToBulkPacket(AvatarMixerClientData* li
     if (timeOfLastTraitsChange > timeOfLastTraitsSent) {
         // there is definitely new traits data to send
 
-        auto sendingAvatar = sendingNodeData->getAvatarSharedPointer();
-
         // compare trait versions so we can see what exactly needs to go out
         auto& lastSentVersions = listeningNodeData->getLastSentTraitVersions(sendingNodeLocalID);
         auto& lastAckedVersions = listeningNodeData->getLastAckedTraitVersions(sendingNodeLocalID);
@@ -141,8 +161,11 @@ qint64 AvatarMixerWorker::addChangedTraitsToBulkPacket(AvatarMixerClientData* li
                 if (lastReceivedVersion > lastSentVersionRef) {
                     bytesWritten += addTraitsNodeHeader(listeningNodeData, sendingNodeData, traitsPacketList, bytesWritten);
                     // there is an update to this trait, add it to the traits packet
-                    bytesWritten += AvatarTraits::packVersionedTrait(traitType, traitsPacketList,
-                                                                     lastReceivedVersion, *sendingAvatar);
+                    auto encodedTrait = sendingNodeData->getEncodedTrait(traitType, lastReceivedVersion);
+                    bytesWritten += packEncodedTrait(listeningNodeData, encodedTrait, [&](bool sendHashOnly) {
+                        return AvatarTraits::packVersionedTraitData(traitType, traitsPacketList, lastReceivedVersion,
+                                                                    encodedTrait.data, encodedTrait.hash, sendHashOnly);
+                    });
                     // update the last sent version
                     lastSentVersionRef = lastReceivedVersion;
                     // Remember which versions we sent in this particular packet
@@ -197,8 +220,12 @@ qint64 AvatarMixerWorker::addChangedTraitsToBulkPacket(AvatarMixerClientData* li
                     bytesWritten += addTraitsNodeHeader(listeningNodeData, sendingNodeData, traitsPacketList, bytesWritten);
 
                     // this instance version exists and has never been sent or is newer so we need to send it
-                    bytesWritten += AvatarTraits::packVersionedTraitInstance(traitType, instanceID, traitsPacketList,
-                                                                             receivedVersion, *sendingAvatar);
+                    auto encodedTrait = sendingNodeData->getEncodedTraitInstance(traitType, instanceID, receivedVersion);
+                    bytesWritten += packEncodedTrait(listeningNodeData, encodedTrait, [&](bool sendHashOnly) {
+                        return AvatarTraits::packVersionedTraitInstanceData(traitType, instanceID, traitsPacketList,
+                                                                            receivedVersion, encodedTrait.data,
+                                                                            encodedTrait.hash, sendHashOnly);
+                    });
 
                     if (sentInstanceIt != sentIDValuePairs.end()) {
                         sentInstanceIt->value = receivedVersion;
@@ -309,8 +336,71 @@ namespace {
         uint64_t _lastEncodeTime;
     };
 
+    class SortableCell : public PrioritySortUtil::Sortable {
+    public:
+        SortableCell() = delete;
+        SortableCell(const AvatarSpatialHash::Cell* cell, uint64_t lastConsideredTime)
+            : _cell(cell), _lastConsideredTime(lastConsideredTime) {
+        }
+        glm::vec3 getPosition() const override { return _cell->center; }
+        float getRadius() const override { return 0.5f * SQUARE_ROOT_OF_3 * AvatarSpatialHash::CELL_SIZE; }
+        uint64_t getTimestamp() const override { return _lastConsideredTime; }
+        const AvatarSpatialHash::Cell* getCell() const { return _cell; }
+
+    private:
+        const AvatarSpatialHash::Cell* _cell;
+        uint64_t _lastConsideredTime;
+    };
+
 }  // Close anonymous namespace.
 
+void AvatarMixerWorker::gatherCandidateAvatars(AvatarMixerClientData* listeningNodeData, const glm::vec3& listenerPosition,
+                                               std::vector<Node*>& candidates) {
+    const auto& cells = _spatialHash->getCells();
+    const auto& heroes = _spatialHash->getHeroes();
+    candidates.insert(candidates.end(), heroes.begin(), heroes.end());
+
+    // the avatars around the listener are always candidates, they need the exact bubble and priority checks
+    std::vector<bool> isCellGathered(cells.size(), false);
+    glm::ivec3 listenerCoord = AvatarSpatialHash::getCellCoord(listenerPosition);
+    for (int x = -1; x <= 1; x++) {
+        for (int y = -1; y <= 1; y++) {
+            for (int z = -1; z <= 1; z++) {
+                int cellIndex = _spatialHash->getCellIndex(listenerCoord + glm::ivec3(x, y, z));
+                if (cellIndex >= 0) {
+                    candidates.insert(candidates.end(), cells[cellIndex].nodes.begin(), cells[cellIndex].nodes.end());
+                    isCellGathered[cellIndex] = true;
+                }
+            }
+        }
+    }
+
+    // far cells are sorted as a whole, with the same weights as individual avatars. Using the time each cell was
+    // last gathered for this listener as its age lets cells that lose out now win later.
+    PrioritySortUtil::PriorityQueue<SortableCell> cellQueue(listeningNodeData->getViewFrustums(),
+        AvatarData::_avatarSortCoefficientSize, AvatarData::_avatarSortCoefficientCenter,
+        AvatarData::_avatarSortCoefficientAge);
+    cellQueue.reserve(cells.size());
+    for (size_t i = 0; i < cells.size(); i++) {
+        if (!isCellGathered[i]) {
+            cellQueue.push(SortableCell(&cells[i], listeningNodeData->getLastCellGatherTime(cells[i].key)));
+        }
+    }
+
+    uint64_t now = usecTimestampNow();
+    for (const auto& sortedCell : cellQueue.getSortedVector()) {
+        if ((int)candidates.size() >= _maxCandidatesPerListener) {
+            break;
+        }
+        const auto& nodes = sortedCell.getCell()->nodes;
+        candidates.insert(candidates.end(), nodes.begin(), nodes.end());
+        listeningNodeData->setLastCellGatherTime(sortedCell.getCell()->key, now);
+    }
+    listeningNodeData->pruneCellGatherTimes(now);
+
+    _stats.numCandidatesCulled += _spatialHash->getNumAvatars() - (int)candidates.size();
+}
+
 void AvatarMixerWorker::broadcastAvatarDataToAgent(const SharedNodePointer& node) {
     const Node* destinationNode = node.data();
 
@@ -384,10 +474,25 @@ void AvatarMixerWorker::broadcastAvatarDataToAgent(const SharedNodePointer& node
             AvatarData::_avatarSortCoefficientCenter, AvatarData::_avatarSortCoefficientAge}
     };
 
-    avatarPriorityQueues[kNonhero].reserve(_end - _begin);
+    // With the PAL open (or just closed) every avatar has to be visited, otherwise only the candidates from the
+    // spatial hash get an exact priority.
+    auto startSort = usecTimestampNow();
+    std::vector<Node*> candidateNodes;
+    if (_spatialHash && !PALIsOpen && !PALWasOpen && _spatialHash->getNumAvatars() > _maxCandidatesPerListener) {
+        candidateNodes.reserve(_maxCandidatesPerListener);
+        gatherCandidateAvatars(destinationNodeData, destinationPosition, candidateNodes);
+    } else {
+        candidateNodes.reserve(_end - _begin);
+        std::for_each(_begin, _end, [&](const SharedNodePointer& listedNode) {
+            candidateNodes.push_back(listedNode.data());
+        });
+    }
+    _stats.numCandidatesConsidered += (int)candidateNodes.size();
+    _stats.prioritySortElapsedTime += usecTimestampNow() - startSort;
+
+    avatarPriorityQueues[kNonhero].reserve(candidateNodes.size());
 
-    for (auto listedNode = _begin; listedNode != _end; ++listedNode) {
-        Node* otherNodeRaw = (*listedNode).data();
+    for (Node* otherNodeRaw : candidateNodes) {
         if (otherNodeRaw->getType() != NodeType::Agent
             || !otherNodeRaw->getLinkedData()
             || otherNodeRaw == destinationNode) {
@@ -518,7 +623,9 @@ void AvatarMixerWorker::broadcastAvatarDataToAgent(const SharedNodePointer& node
 
     // Loop over two priorities - hero avatars then everyone else:
     for (PriorityVariants currentVariant = kHero; currentVariant <= kNonhero; ++((int&)currentVariant)) {
+        auto startSortedVector = usecTimestampNow();
         const auto& sortedAvatarVector = avatarPriorityQueues[currentVariant].getSortedVector(numToSendEst);
+        _stats.prioritySortElapsedTime += usecTimestampNow() - startSortedVector;
         for (const auto& sortedAvatar : sortedAvatarVector) {
             const Node* sourceNode = sortedAvatar.getNode();
             auto lastEncodeForOther = sortedAvatar.getTimestamp();
@@ -574,6 +681,8 @@ void AvatarMixerWorker::broadcastAvatarDataToAgent(const SharedNodePointer& node
             }
 
             QVector<JointData>& lastSentJointsForOther = destinationNodeData->getLastOtherAvatarSentJoints(sourceNode->getLocalID());
+            AvatarDataPacket::JointKeyframe& jointKeyframeForOther =
+                destinationNodeData->getLastOtherAvatarSentJointKeyframe(sourceNode->getLocalID());
 
             const bool distanceAdjust = true;
             const bool dropFaceTracking = false;
@@ -584,7 +693,7 @@ void AvatarMixerWorker::broadcastAvatarDataToAgent(const SharedNodePointer& node
                 auto startSerialize = chrono::high_resolution_clock::now();
                 QByteArray bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
                     sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
-                    &lastSentJointsForOther, avatarSpaceAvailable);
+                    &lastSentJointsForOther, avatarSpaceAvailable, nullptr, &jointKeyframeForOther);
                 auto endSerialize = chrono::high_resolution_clock::now();
                 _stats.toByteArrayElapsedTime +=
                     (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
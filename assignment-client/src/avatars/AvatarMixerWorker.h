@@ -12,9 +12,14 @@
 #ifndef hifi_AvatarMixerWorker_h
 #define hifi_AvatarMixerWorker_h
 
+#include <functional>
+
 #include <NodeList.h>
 
-class AvatarMixerClientData;
+#include "AvatarMixerClientData.h"
+
+// Per listener limit on the number of other avatars that get an exact priority, 0 disables the spatial hash
+const int DEFAULT_MAX_CANDIDATES_PER_LISTENER = 256;
 
 class AvatarMixerWorkerStats {
 public:
@@ -26,6 +31,7 @@ public:
     int downstreamMixersBroadcastedTo { 0 };
     int numDataBytesSent { 0 };
     int numTraitsBytesSent { 0 };
+    int numTraitsBytesDeduplicated { 0 };
     int numIdentityBytesSent { 0 };
     int numDataPacketsSent { 0 };
     int numTraitsPacketsSent { 0 };
@@ -33,8 +39,11 @@ public:
     int numOthersIncluded { 0 };
     int overBudgetAvatars { 0 };
     int numHeroesIncluded { 0 };
+    int numCandidatesConsidered { 0 };
+    int numCandidatesCulled { 0 };
 
     quint64 ignoreCalculationElapsedTime { 0 };
+    quint64 prioritySortElapsedTime { 0 };
     quint64 avatarDataPackingElapsedTime { 0 };
     quint64 packetSendingElapsedTime { 0 };
     quint64 toByteArrayElapsedTime { 0 };
@@ -52,6 +61,7 @@ public:
 
         numDataBytesSent = 0;
         numTraitsBytesSent = 0;
+        numTraitsBytesDeduplicated = 0;
         numIdentityBytesSent = 0;
         numDataPacketsSent = 0;
         numTraitsPacketsSent = 0;
@@ -59,8 +69,11 @@ public:
         numOthersIncluded = 0;
         overBudgetAvatars = 0;
         numHeroesIncluded = 0;
+        numCandidatesConsidered = 0;
+        numCandidatesCulled = 0;
 
         ignoreCalculationElapsedTime = 0;
+        prioritySortElapsedTime = 0;
         avatarDataPackingElapsedTime = 0;
         packetSendingElapsedTime = 0;
         toByteArrayElapsedTime = 0;
@@ -76,6 +89,7 @@ public:
         downstreamMixersBroadcastedTo += rhs.downstreamMixersBroadcastedTo;
         numDataBytesSent += rhs.numDataBytesSent;
         numTraitsBytesSent += rhs.numTraitsBytesSent;
+        numTraitsBytesDeduplicated += rhs.numTraitsBytesDeduplicated;
         numIdentityBytesSent += rhs.numIdentityBytesSent;
         numDataPacketsSent += rhs.numDataPacketsSent;
         numTraitsPacketsSent += rhs.numTraitsPacketsSent;
@@ -83,8 +97,11 @@ public:
         numOthersIncluded += rhs.numOthersIncluded;
         overBudgetAvatars += rhs.overBudgetAvatars;
         numHeroesIncluded += rhs.numHeroesIncluded;
+        numCandidatesConsidered += rhs.numCandidatesConsidered;
+        numCandidatesCulled += rhs.numCandidatesCulled;
 
         ignoreCalculationElapsedTime += rhs.ignoreCalculationElapsedTime;
+        prioritySortElapsedTime += rhs.prioritySortElapsedTime;
         avatarDataPackingElapsedTime += rhs.avatarDataPackingElapsedTime;
         packetSendingElapsedTime += rhs.packetSendingElapsedTime;
         toByteArrayElapsedTime += rhs.toByteArrayElapsedTime;
@@ -93,6 +110,7 @@ public:
     }
 };
 
+class AvatarSpatialHash;
 class EntityTree;
 using EntityTreePointer = std::shared_ptr<EntityTree>;
 
@@ -111,7 +129,8 @@ public:
     void configureBroadcast(ConstIter begin, ConstIter end, 
                     p_high_resolution_clock::time_point lastFrameTimestamp, 
                     float maxKbpsPerNode, float throttlingRatio,
-                    float priorityReservedFraction);
+                    float priorityReservedFraction,
+                    const AvatarSpatialHash* spatialHash, int maxCandidatesPerListener);
 
     void processIncomingPackets(const SharedNodePointer& node);
     void broadcastAvatarData(const SharedNodePointer& node);
@@ -127,10 +146,20 @@ private:
                                NLPacketList& traitsPacketList,
                                qint64 bytesWritten);
 
+    // writes a trait blob, or just its hash if the listener already has it
+    qint64 packEncodedTrait(AvatarMixerClientData* listeningNodeData,
+                            const AvatarMixerClientData::EncodedTrait& encodedTrait,
+                            const std::function<qint64(bool)>& packer);
+
     qint64 addChangedTraitsToBulkPacket(AvatarMixerClientData* listeningNodeData,
                                         const AvatarMixerClientData* sendingNodeData,
                                         NLPacketList& traitsPacketList);
 
+    // collects the other avatars worth sorting for this listener: heroes, avatars in nearby cells and then whole
+    // cells in coarse priority order, until maxCandidatesPerListener is reached
+    void gatherCandidateAvatars(AvatarMixerClientData* listeningNodeData, const glm::vec3& listenerPosition,
+                                std::vector<Node*>& candidates);
+
     void broadcastAvatarDataToAgent(const SharedNodePointer& node);
     void broadcastAvatarDataToDownstreamMixer(const SharedNodePointer& node);
 
@@ -142,6 +171,8 @@ private:
     float _maxKbpsPerNode { 0.0f };
     float _throttlingRatio { 0.0f };
     float _avatarHeroFraction { 0.4f };
+    const AvatarSpatialHash* _spatialHash { nullptr };
+    int _maxCandidatesPerListener { 0 };
 
     AvatarMixerWorkerStats _stats;
     WorkerSharedData* _sharedData;
@@ -74,10 +74,19 @@ void AvatarMixerWorkerPool::processIncomingPackets(ConstIter begin, ConstIter en
 void AvatarMixerWorkerPool::broadcastAvatarData(ConstIter begin, ConstIter end,
                                                p_high_resolution_clock::time_point lastFrameTimestamp,
                                                float maxKbpsPerNode, float throttlingRatio) {
+    // bucket the avatars once, each listener then only evaluates the nearby and highest priority cells
+    const AvatarSpatialHash* spatialHash = nullptr;
+    if (_maxCandidatesPerListener > 0) {
+        auto start = usecTimestampNow();
+        _spatialHash.rebuild(begin, end);
+        _spatialHashElapsedTime += usecTimestampNow() - start;
+        spatialHash = &_spatialHash;
+    }
+
     _function = &AvatarMixerWorker::broadcastAvatarData;
     _configure = [=, this](AvatarMixerWorker& worker) {
         worker.configureBroadcast(begin, end, lastFrameTimestamp, maxKbpsPerNode, throttlingRatio,
-            _priorityReservedFraction);
+            _priorityReservedFraction, spatialHash, _maxCandidatesPerListener);
    };
     run(begin, end);
 }
@@ -23,6 +23,7 @@
 #include <shared/QtHelpers.h>
 
 #include "AvatarMixerWorker.h"
+#include "AvatarSpatialHash.h"
 
 
 class AvatarMixerWorkerPool;
@@ -84,6 +85,12 @@ public:
     void setPriorityReservedFraction(float fraction) { _priorityReservedFraction = fraction; }
     float getPriorityReservedFraction() const { return  _priorityReservedFraction; }
 
+    void setMaxCandidatesPerListener(int maxCandidates) { _maxCandidatesPerListener = maxCandidates; }
+    int getMaxCandidatesPerListener() const { return _maxCandidatesPerListener; }
+
+    quint64 getSpatialHashElapsedTime() const { return _spatialHashElapsedTime; }
+    void resetSpatialHashElapsedTime() { _spatialHashElapsedTime = 0; }
+
 private:
     void run(ConstIter begin, ConstIter end);
     void resize(int numThreads);
@@ -103,8 +110,12 @@ private:
 
     // Set from Domain Settings:
     float _priorityReservedFraction { 0.4f };
+    int _maxCandidatesPerListener { DEFAULT_MAX_CANDIDATES_PER_LISTENER };
     int _numThreads { 0 };
 
+    AvatarSpatialHash _spatialHash;
+    quint64 _spatialHashElapsedTime { 0 };
+
     int _numStarted { 0 }; // guarded by _mutex
     int _numFinished { 0 }; // guarded by _mutex
     int _numStopped { 0 }; // guarded by _mutex
@@ -0,0 +1,74 @@
+//
+//  AvatarSpatialHash.cpp
+//  assignment-client/src/avatars
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "AvatarSpatialHash.h"
+
+#include <algorithm>
+
+#include "AvatarMixerClientData.h"
+
+glm::ivec3 AvatarSpatialHash::getCellCoord(const glm::vec3& position) {
+    return glm::ivec3(glm::floor(position / CELL_SIZE));
+}
+
+AvatarSpatialHash::CellKey AvatarSpatialHash::getCellKey(const glm::ivec3& coord) {
+    // 21 bits per axis covers +/- 16000 km with 16 m cells
+    const CellKey AXIS_MASK = (1 << 21) - 1;
+    return (((CellKey)coord.x & AXIS_MASK) << 42) | (((CellKey)coord.y & AXIS_MASK) << 21) | ((CellKey)coord.z & AXIS_MASK);
+}
+
+int AvatarSpatialHash::getCellIndex(const glm::ivec3& coord) const {
+    auto it = _cellIndices.find(getCellKey(coord));
+    return it != _cellIndices.end() ? it->second : -1;
+}
+
+void AvatarSpatialHash::rebuild(ConstIter begin, ConstIter end) {
+    // keep the cell vectors around, the same cells tend to be occupied frame to frame
+    for (auto& cell : _cells) {
+        cell.nodes.clear();
+    }
+    _heroes.clear();
+    _numAvatars = 0;
+
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        if (node->getType() != NodeType::Agent || !node->getLinkedData()) {
+            return;
+        }
+        const auto nodeData = reinterpret_cast<const AvatarMixerClientData*>(node->getLinkedData());
+        const MixerAvatar& avatar = nodeData->getAvatar();
+        ++_numAvatars;
+
+        if (avatar.getHasPriority()) {
+            _heroes.push_back(node.data());
+            return;
+        }
+
+        glm::ivec3 coord = getCellCoord(avatar.getClientGlobalPosition());
+        CellKey key = getCellKey(coord);
+        auto it = _cellIndices.find(key);
+        if (it == _cellIndices.end()) {
+            it = _cellIndices.emplace(key, (int)_cells.size()).first;
+            _cells.push_back({ key, coord, (glm::vec3(coord) + 0.5f) * CELL_SIZE, {} });
+        }
+        _cells[it->second].nodes.push_back(node.data());
+    });
+
+    // drop the cells that emptied out
+    bool hasEmptyCells = std::any_of(_cells.begin(), _cells.end(), [](const Cell& cell) { return cell.nodes.empty(); });
+    if (hasEmptyCells) {
+        _cells.erase(std::remove_if(_cells.begin(), _cells.end(), [](const Cell& cell) { return cell.nodes.empty(); }),
+                     _cells.end());
+        _cellIndices.clear();
+        for (int i = 0; i < (int)_cells.size(); i++) {
+            _cellIndices[_cells[i].key] = i;
+        }
+    }
+}
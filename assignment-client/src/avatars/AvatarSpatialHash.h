@@ -0,0 +1,58 @@
+//
+//  AvatarSpatialHash.h
+//  assignment-client/src/avatars
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_AvatarSpatialHash_h
+#define hifi_AvatarSpatialHash_h
+
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <NodeList.h>
+
+// Buckets the avatars of a frame into a uniform grid, so that each listener can prioritize whole cells of far away
+// avatars instead of every other avatar. Rebuilt once per frame, before the broadcast, and read-only while the
+// workers run.
+class AvatarSpatialHash {
+public:
+    using ConstIter = NodeList::const_iterator;
+    using CellKey = uint64_t;
+
+    static constexpr float CELL_SIZE = 16.0f; // meters
+
+    struct Cell {
+        CellKey key;
+        glm::ivec3 coord;
+        glm::vec3 center;
+        std::vector<Node*> nodes;
+    };
+
+    void rebuild(ConstIter begin, ConstIter end);
+
+    const std::vector<Cell>& getCells() const { return _cells; }
+    // avatars in hero zones are kept out of the cells, they are always candidates
+    const std::vector<Node*>& getHeroes() const { return _heroes; }
+    int getNumAvatars() const { return _numAvatars; }
+
+    static glm::ivec3 getCellCoord(const glm::vec3& position);
+    static CellKey getCellKey(const glm::ivec3& coord);
+    // returns -1 if there is no avatar in that cell
+    int getCellIndex(const glm::ivec3& coord) const;
+
+private:
+    std::vector<Cell> _cells;
+    std::unordered_map<CellKey, int> _cellIndices;
+    std::vector<Node*> _heroes;
+    int _numAvatars { 0 };
+};
+
+#endif // hifi_AvatarSpatialHash_h
@@ -12,6 +12,7 @@ class Overte(ConanFile):
     }
     default_options = {
         "qt_source": "system",
+        "bullet3*:bt2_thread_locks": "True",  # BT_THREADSAFE, required for the multithreaded physics step
         "sdl*:alsa": "False",
         "sdl*:pulse": "False",
         "sdl*:wayland": "False",
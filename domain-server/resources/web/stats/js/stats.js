@@ -1,11 +1,17 @@
 $(document).ready(function(){
 
+  var uuid = qs("uuid");
+
+  // ask the node for a trace of its last seconds, the links show up with the stats once it arrives
+  $('#dump-trace-btn').click(function(){
+    $.post("/nodes/" + uuid + "/trace?seconds=" + $('#trace-seconds').val()).fail(function() {
+      bootbox.alert("Could not ask this node for a trace.");
+    });
+  });
 
   // setup a function to grab the nodeStats
   function getNodeStats() {
 
-    var uuid = qs("uuid");
-
     $.getJSON("/nodes/" + uuid + ".json", function(json){
 
       // update the table header with the right node type
@@ -13,6 +19,15 @@ $(document).ready(function(){
 
       delete json.node_type;
 
+      if (json.trace_dump) {
+        $('#trace-dump-time').text(new Date(json.trace_dump).toLocaleString());
+        $('#trace-json-link').attr('href', "/nodes/" + uuid + "/trace.json.gz");
+        $('#trace-binary-link').attr('href', "/nodes/" + uuid + "/trace.hftrace");
+        $('#trace-links').show();
+      }
+
+      delete json.trace_dump;
+
       var stats = JsonHuman.format(json);
 
       $('#stats-container').html(stats);
@@ -872,6 +872,8 @@ void DomainServer::setupNodeListAndAssignments() {
         PacketReceiver::makeUnsourcedListenerReference<DomainServer>(this, &DomainServer::processPathQueryPacket));
     packetReceiver.registerListener(PacketType::NodeJsonStats,
         PacketReceiver::makeSourcedListenerReference<DomainServer>(this, &DomainServer::processNodeJSONStatsPacket));
+    packetReceiver.registerListener(PacketType::TraceDump,
+        PacketReceiver::makeSourcedListenerReference<DomainServer>(this, &DomainServer::processTraceDumpPacket));
     packetReceiver.registerListener(PacketType::DomainDisconnectRequest,
         PacketReceiver::makeUnsourcedListenerReference<DomainServer>(this, &DomainServer::processNodeDisconnectRequestPacket));
     packetReceiver.registerListener(PacketType::AvatarZonePresence,
@@ -1989,6 +1991,15 @@ void DomainServer::processNodeJSONStatsPacket(QSharedPointer<ReceivedMessage> pa
     }
 }
 
+void DomainServer::processTraceDumpPacket(QSharedPointer<ReceivedMessage> packetList, SharedNodePointer sendingNode) {
+    auto nodeData = static_cast<DomainServerNodeData*>(sendingNode->getLinkedData());
+    QByteArray traceDump;
+    if (nodeData && gunzip(packetList->getMessage(), traceDump)) {
+        qCDebug(domain_server) << "Received" << traceDump.size() << "bytes of trace from" << sendingNode->getUUID();
+        nodeData->setTraceDump(traceDump);
+    }
+}
+
 QJsonObject DomainServer::jsonForSocket(const SockAddr& socket) {
     QJsonObject socketJSON;
 
@@ -2349,6 +2360,12 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
                     // add the node type to the JSON data for output purposes
                     statsObject["node_type"] = NodeType::getNodeTypeName(matchingNode->getType()).toLower().replace(' ', '-');
 
+                    // and when the last trace dump of the node arrived, if any did
+                    auto traceDumpTime = static_cast<DomainServerNodeData*>(matchingNode->getLinkedData())->getTraceDumpTime();
+                    if (traceDumpTime.isValid()) {
+                        statsObject["trace_dump"] = traceDumpTime.toString(Qt::ISODate);
+                    }
+
                     QJsonDocument statsDocument(statsObject);
 
                     // send the response
@@ -2360,6 +2377,39 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
 
                 return false;
             }
+
+            // check if this is for the last trace dump of a node, as sent or converted for chrome://tracing
+            const QString NODE_TRACE_REGEX_STRING =
+                QString("\\%1\\/(%2)\\/trace\\.(hftrace|json\\.gz)$").arg(URI_NODES).arg(UUID_REGEX_STRING);
+            QRegExp nodeTraceRegex(NODE_TRACE_REGEX_STRING);
+
+            if (nodeTraceRegex.indexIn(url.path()) != -1) {
+                SharedNodePointer matchingNode = nodeList->nodeWithUUID(QUuid(nodeTraceRegex.cap(1)));
+                if (!matchingNode) {
+                    return false;
+                }
+
+                QByteArray traceDump = static_cast<DomainServerNodeData*>(matchingNode->getLinkedData())->getTraceDump();
+                if (traceDump.isEmpty()) {
+                    connection->respond(HTTPConnection::StatusCode404, "No trace has been dumped for this node");
+                    return true;
+                }
+
+                QString contentType = "application/octet-stream";
+                if (nodeTraceRegex.cap(2) != "hftrace") {
+                    QByteArray compressed;
+                    gzip(tracing::Tracer::toChromeTrace(traceDump), compressed);
+                    traceDump = compressed;
+                    contentType = "application/gzip";
+                }
+
+                auto nodeTypeName = NodeType::getNodeTypeName(matchingNode->getType()).toLower().replace(' ', '-');
+                auto contentDisposition = "attachment; filename=\"" + nodeTypeName + "-trace." + nodeTraceRegex.cap(2) + "\"";
+                connection->respond(HTTPConnection::StatusCode200, traceDump, qPrintable(contentType), {
+                    { "Content-Disposition", contentDisposition.toUtf8() }
+                });
+                return true;
+            }
         }
     } else if (connection->requestOperation() == QNetworkAccessManager::PostOperation) {
         if (url.path() == URI_ASSIGNMENT) {
@@ -2485,6 +2535,33 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
             });
             _contentManager->recoverFromBackup(deferred, id, username);
             return true;
+
+        } else {
+            // check if this is asking a node to dump the trace of its last seconds
+            const QString NODE_TRACE_REGEX_STRING = QString("\\%1\\/(%2)\\/trace\\/?$").arg(URI_NODES).arg(UUID_REGEX_STRING);
+            QRegExp nodeTraceRegex(NODE_TRACE_REGEX_STRING);
+
+            if (nodeTraceRegex.indexIn(url.path()) != -1) {
+                SharedNodePointer matchingNode = nodeList->nodeWithUUID(QUuid(nodeTraceRegex.cap(1)));
+                if (!matchingNode || !matchingNode->getActiveSocket()) {
+                    return false;
+                }
+
+                static const quint32 DEFAULT_TRACE_DUMP_SECONDS = 10;
+                bool isNumber = false;
+                quint32 seconds = QUrlQuery(url).queryItemValue("seconds").toUInt(&isNumber);
+                if (!isNumber || seconds == 0) {
+                    seconds = DEFAULT_TRACE_DUMP_SECONDS;
+                }
+
+                // the node answers with a TraceDump packet, which the stats page polls for
+                auto packet = NLPacket::create(PacketType::TraceDumpRequest, sizeof(seconds), true);
+                packet->writePrimitive(seconds);
+                nodeList->sendPacket(std::move(packet), *matchingNode);
+
+                connection->respond(HTTPConnection::StatusCode200);
+                return true;
+            }
         }
     } else if (connection->requestOperation() == QNetworkAccessManager::PutOperation) {
         if (url.path() == URI_API_DOMAINS) {
@@ -13,6 +13,7 @@
 #ifndef hifi_DomainServerNodeData_h
 #define hifi_DomainServerNodeData_h
 
+#include <QtCore/QDateTime>
 #include <QtCore/QElapsedTimer>
 #include <QtCore/QHash>
 #include <QtCore/QUuid>
@@ -31,6 +32,11 @@ public:
 
     void updateJSONStats(const QByteArray& statsByteArray);
 
+    // the binary trace of the node's last events, as sent in answer to a trace dump request
+    void setTraceDump(const QByteArray& traceDump) { _traceDump = traceDump; _traceDumpTime = QDateTime::currentDateTimeUtc(); }
+    const QByteArray& getTraceDump() const { return _traceDump; }
+    const QDateTime& getTraceDumpTime() const { return _traceDumpTime; }
+
     void setAssignmentUUID(const QUuid& assignmentUUID) { _assignmentUUID = assignmentUUID; }
     const QUuid& getAssignmentUUID() const { return _assignmentUUID; }
 
@@ -86,6 +92,9 @@ private:
     using StringPairHash = QHash<QPair<QString, QString>, QString>;
     QJsonObject _statsJSONObject;
     static StringPairHash _overrideHash;
+
+    QByteArray _traceDump;
+    QDateTime _traceDumpTime;
     
     SockAddr _sendingSockAddr;
     bool _isAuthenticated = true;
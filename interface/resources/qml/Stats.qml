@@ -71,6 +71,21 @@ Item {
                     StatText {
                         text: "Physics Object Count: " + root.physicsObjectCount
                     }
+                    StatText {
+                        visible: root.expanded
+                        text: "    Mesh shapes build/load: " + root.meshShapeBuildTime.toFixed(1) + "/" +
+                              root.meshShapeLoadTime.toFixed(1) + " ms, cache hits " + root.meshShapeCacheHitRate + "%"
+                    }
+                    StatText {
+                        visible: root.expanded
+                        text: "    Physics step: " + root.physicsStepTime.toFixed(2) + " ms"
+                    }
+                    StatText {
+                        visible: root.expanded
+                        text: "    Bodies R1: " + root.physicsR1BodyCount + " (" + root.physicsR1ActiveBodyCount + " awake)" +
+                              ", R2: " + root.physicsR2BodyCount + " (" + root.physicsR2ActiveBodyCount + " awake, " +
+                              root.physicsReducedLODBodyCount + " reduced)"
+                    }
                     StatText {
                         visible: root.expanded
                         text: root.gameUpdateStats
@@ -131,6 +146,10 @@ Item {
                         visible: root.expanded
                         text: "Avatars NOT Updated: " + root.notUpdatedAvatarCount
                     }
+                    StatText {
+                        visible: root.expanded
+                        text: "Avatar Anim LOD Medium/Low: " + root.mediumAnimationLODAvatarCount + "/" + root.lowAnimationLODAvatarCount
+                    }
                     StatText {
                         visible: root.expanded
                         text: "Total picks:\n    " +
@@ -405,6 +424,18 @@ Item {
                         visible: root.expanded;
                         text: "  Memory: " + root.gpuBufferMemory + " MB";
                     }
+                    StatText {
+                        visible: root.expanded;
+                        text: "GPU Batches: "
+                    }
+                    StatText {
+                        visible: root.expanded;
+                        text: "  Pooled: " + root.gpuPooledBatches;
+                    }
+                    StatText {
+                        visible: root.expanded;
+                        text: "  Allocated / Grown: " + root.gpuBatchAllocations + " / " + root.gpuBatchGrowths;
+                    }
                     StatText {
                         visible: root.expanded;
                         text: "GL Swapchain Memory: " + root.glContextSwapchainMemory + " MB";
@@ -421,7 +452,8 @@ Item {
                     StatText {
                         visible: root.expanded;
                         text: " out of view: " + root.itemOutOfView +
-                            " too small: " + root.itemTooSmall;
+                            " too small: " + root.itemTooSmall +
+                            " cull: " + root.itemCullTime.toFixed(2) + " ms";
                     }
                     StatText {
                         visible: root.expanded;
@@ -431,7 +463,8 @@ Item {
                     StatText {
                         visible: root.expanded;
                         text: " out of view: " + root.shadowOutOfView +
-                            " too small: " + root.shadowTooSmall;
+                            " too small: " + root.shadowTooSmall +
+                            " cull: " + root.shadowCullTime.toFixed(2) + " ms";
                     }
                     StatText {
                         visible: root.expanded
@@ -17,7 +17,7 @@ PreferencesDialog {
     id: root
     objectName: "GeneralPreferencesDialog"
     title: "General Settings"
-    showCategories: ["User Interface", "Mouse Sensitivity", "HMD", "Snapshots", "Privacy", "Plugins"]
+    showCategories: ["User Interface", "Mouse Sensitivity", "HMD", "Snapshots", "Privacy", "Physics", "Plugins"]
     property var settings: Settings {
         category: root.objectName
         property alias x: root.x
@@ -2537,6 +2537,13 @@ void Application::queryAvatars() {
     }
 }
 
+void Application::setPhysicsSimulationThreads(int numThreads) {
+    _physicsSimulationThreadsSetting.set(numThreads);
+    if (_physicsEngine) {
+        _physicsEngine->setNumSimulationThreads(numThreads);
+    }
+}
+
 void Application::tryToEnablePhysics() {
     bool enableInterstitial = DependencyManager::get<NodeList>()->getDomainHandler().getInterstitialModeEnabled();
 
@@ -330,11 +330,15 @@ public:
     // Physics
     bool isPhysicsEnabled() const { return _physicsEnabled; }
     PhysicsEnginePointer getPhysicsEngine() { return _physicsEngine; }
+    PhysicalEntitySimulationPointer getEntitySimulation() const { return _entitySimulation; }
     const GameWorkload& getGameWorkload() const { return _gameWorkload; }
 
     float getNumCollisionObjects() const { return _physicsEngine ? _physicsEngine->getNumCollisionObjects() : 0; }
     void saveNextPhysicsStats(QString filename) { _physicsEngine->saveNextPhysicsStats(filename); }
 
+    int getPhysicsSimulationThreads() const { return _physicsEngine ? _physicsEngine->getNumSimulationThreads() : 1; }
+    void setPhysicsSimulationThreads(int numThreads);
+
 
     // Avatar
     virtual glm::vec3 getAvatarPosition() const override { return getMyAvatar()->getWorldPosition(); }
@@ -816,6 +820,7 @@ private:
     Setting::Handle<bool> _miniTabletEnabledSetting;
     Setting::Handle<bool> _keepLogWindowOnTop { "keepLogWindowOnTop", false };
     Setting::Handle<bool> _menuBarVisible { "menuBarVisible", true };
+    Setting::Handle<int> _physicsSimulationThreadsSetting { "physicsSimulationThreads", 1 };
 
     void updateThemeColors();
 
@@ -27,6 +27,7 @@
 #include <AccountManager.h>
 #include <AddressManager.h>
 #include <AnimationCacheScriptingInterface.h>
+#include <ArtifactCache.h>
 #include <AvatarBookmarks.h>
 #include <avatar/AvatarPackager.h>
 #include <avatar/GrabManager.h>
@@ -1317,6 +1318,11 @@ void Application::init() {
 
     qCDebug(interfaceapp) << "Loaded settings";
 
+    // processed resources from earlier sessions let a domain we've visited before load without reprocessing them
+    auto artifactCache = std::make_shared<ArtifactCache>();
+    artifactCache->initialize();
+    ResourceCache::setArtifactCache(artifactCache);
+
     // fire off an immediate domain-server check in now that settings are loaded
     QMetaObject::invokeMethod(DependencyManager::get<NodeList>().data(), "sendDomainServerCheckIn");
 
@@ -1327,7 +1333,11 @@ void Application::init() {
     getEntities()->init();
 
     ObjectMotionState::setShapeManager(&_shapeManager);
+    auto shapeCache = std::make_shared<ShapeCache>();
+    shapeCache->initialize();
+    _shapeManager.setShapeCache(shapeCache);
     _physicsEngine->init();
+    _physicsEngine->setNumSimulationThreads(_physicsSimulationThreadsSetting.get());
 
     EntityTreePointer tree = getEntities()->getTree();
     _entitySimulation->init(tree, _physicsEngine, _entityEditSender.get());
@@ -1584,6 +1594,16 @@ void Application::setupSignalsAndOperators() {
                 const float OUT_OF_VIEW_PENALTY = -M_PI_2;
                 result += OUT_OF_VIEW_PENALTY;
             }
+
+            // what's in the workload's physics regions is what the avatar is about to bump into
+            uint8_t region = getEntities()->getWorkloadSpace()->getRegion(item.getSpaceIndex());
+            if (region <= workload::Region::R2) {
+                const float PHYSICS_REGION_BONUS = 0.25f;
+                result += PHYSICS_REGION_BONUS;
+            } else if (region == workload::Region::R4) {
+                const float OUTER_REGION_PENALTY = -0.25f;
+                result += OUTER_REGION_PENALTY;
+            }
             return result;
         });
 
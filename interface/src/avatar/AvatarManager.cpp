@@ -296,6 +296,18 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
     int numAvatarsUpdated = 0;
     int numAvatarsNotUpdated = 0;
 
+    // animation LOD is driven by the workload region of each avatar
+    const uint8_t animationLODMediumRegion = (uint8_t)_animationLODMediumRegionSetting.get();
+    const uint8_t animationLODLowRegion = (uint8_t)_animationLODLowRegionSetting.get();
+    const float animationLODSmoothingTime = _animationLODSmoothingTimeSetting.get();
+    const float MIN_ANIMATION_LOD_RATE = 1.0f;
+    const float animationLODPeriods[OtherAvatar::NumAnimationLODs] = {
+        0.0f,
+        1.0f / glm::max(_animationLODMediumRateSetting.get(), MIN_ANIMATION_LOD_RATE),
+        1.0f / glm::max(_animationLODLowRateSetting.get(), MIN_ANIMATION_LOD_RATE)
+    };
+    int numAvatarsAtAnimationLOD[OtherAvatar::NumAnimationLODs] = { 0, 0, 0 };
+
     render::Transaction renderTransaction;
     workload::Transaction workloadTransaction;
 
@@ -343,6 +355,18 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
                     avatar->_transit.reset();
                     avatar->setIsNewAvatar(false);
                 }
+                uint8_t region = avatar->getWorkloadRegion();
+                OtherAvatar::AnimationLOD animationLOD = OtherAvatar::AnimationLODHigh;
+                // heroes are always animated at full detail, as are avatars the workload hasn't classified yet
+                if (!avatar->getHasPriority() && region < workload::Region::UNKNOWN) {
+                    if (region >= animationLODLowRegion) {
+                        animationLOD = OtherAvatar::AnimationLODLow;
+                    } else if (region >= animationLODMediumRegion) {
+                        animationLOD = OtherAvatar::AnimationLODMedium;
+                    }
+                }
+                avatar->setAnimationLOD(animationLOD, animationLODPeriods[animationLOD], animationLODSmoothingTime);
+                numAvatarsAtAnimationLOD[animationLOD]++;
                 avatar->simulate(deltaTime, inView);
                 if (avatar->getSkeletonModel()->isLoaded() && avatar->getWorkloadRegion() == workload::Region::R1) {
                     _myAvatar->addAvatarHandsToFlow(avatar);
@@ -398,6 +422,9 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
     _numAvatarsUpdated = numAvatarsUpdated;
     _numAvatarsNotUpdated = numAvatarsNotUpdated;
     _numHeroAvatarsUpdated = numHerosUpdated;
+    for (int i = 0; i < OtherAvatar::NumAnimationLODs; i++) {
+        _numAvatarsAtAnimationLOD[i] = numAvatarsAtAnimationLOD[i];
+    }
 
     _avatarSimulationTime = (float)(usecTimestampNow() - startTime) / (float)USECS_PER_MSEC;
 }
@@ -999,6 +1026,36 @@ float AvatarManager::getAvatarSortCoefficient(const QString& name) {
     return 0.0f;
 }
 
+QVariantMap AvatarManager::getAnimationLODConfig() const {
+    QVariantMap config;
+    config["mediumRegion"] = _animationLODMediumRegionSetting.get();
+    config["lowRegion"] = _animationLODLowRegionSetting.get();
+    config["mediumRate"] = _animationLODMediumRateSetting.get();
+    config["lowRate"] = _animationLODLowRateSetting.get();
+    config["smoothingTime"] = _animationLODSmoothingTimeSetting.get();
+    return config;
+}
+
+void AvatarManager::setAnimationLODConfig(const QVariantMap& config) {
+    if (config.contains("mediumRegion")) {
+        _animationLODMediumRegionSetting.set(glm::clamp(config["mediumRegion"].toInt(), (int)workload::Region::R1,
+                                                        (int)workload::Region::R4));
+    }
+    if (config.contains("lowRegion")) {
+        _animationLODLowRegionSetting.set(glm::clamp(config["lowRegion"].toInt(), (int)workload::Region::R1,
+                                                     (int)workload::Region::R4));
+    }
+    if (config.contains("mediumRate")) {
+        _animationLODMediumRateSetting.set(config["mediumRate"].toFloat());
+    }
+    if (config.contains("lowRate")) {
+        _animationLODLowRateSetting.set(config["lowRate"].toFloat());
+    }
+    if (config.contains("smoothingTime")) {
+        _animationLODSmoothingTimeSetting.set(glm::max(config["smoothingTime"].toFloat(), 0.0f));
+    }
+}
+
 // HACK
 void AvatarManager::setAvatarSortCoefficient(const QString& name, const ScriptValue& value) {
     bool somethingChanged = false;
@@ -29,6 +29,7 @@
 #include <workload/Space.h>
 #include <EntitySimulation.h> // for SetOfEntities
 #include <ScriptValue.h>
+#include <SettingHandle.h>
 
 #include "AvatarMotionState.h"
 #include "DetailedMotionState.h"
@@ -120,6 +121,7 @@ public:
     int getNumHeroAvatars() const { return _numHeroAvatars; }
     int getNumHeroAvatarsUpdated() const { return _numHeroAvatarsUpdated; }
     float getAvatarSimulationTime() const { return _avatarSimulationTime; }
+    int getNumAvatarsAtAnimationLOD(OtherAvatar::AnimationLOD lod) const { return _numAvatarsAtAnimationLOD[lod]; }
 
     void updateMyAvatar(float deltaTime);
     void updateOtherAvatars(float deltaTime);
@@ -234,6 +236,34 @@ public:
      */
     Q_INVOKABLE void setAvatarSortCoefficient(const QString& name, const ScriptValue& value);
 
+    /*@jsdoc
+     * Gets the animation level of detail settings used for avatars other than your own. Avatars whose workload region is 
+     * at or beyond <code>mediumRegion</code> update their joints at <code>mediumRate</code>; those at or beyond 
+     * <code>lowRegion</code> update at <code>lowRate</code> and skip their finger joints and eye lookAt correction.
+     * @function AvatarManager.getAnimationLODConfig
+     * @returns {AvatarManager.AnimationLODConfig} The animation LOD settings.
+     */
+    /*@jsdoc
+     * @typedef {object} AvatarManager.AnimationLODConfig
+     * @property {number} mediumRegion - The first workload region animated at medium LOD: <code>0</code> for R1 through 
+     *     <code>3</code> for R4.
+     * @property {number} lowRegion - The first workload region animated at low LOD: <code>0</code> for R1 through 
+     *     <code>3</code> for R4.
+     * @property {number} mediumRate - The joint update rate at medium LOD, in Hz.
+     * @property {number} lowRate - The joint update rate at low LOD, in Hz.
+     * @property {number} smoothingTime - The time constant used to interpolate toward received poses at reduced LOD, in 
+     *     seconds.
+     */
+    Q_INVOKABLE QVariantMap getAnimationLODConfig() const;
+
+    /*@jsdoc
+     * Sets the animation level of detail settings used for avatars other than your own. The settings persist between sessions.
+     * @function AvatarManager.setAnimationLODConfig
+     * @param {AvatarManager.AnimationLODConfig} config - The animation LOD settings to change. Properties that are not 
+     *     specified keep their current values.
+     */
+    Q_INVOKABLE void setAnimationLODConfig(const QVariantMap& config);
+
     /*@jsdoc
      * Gets PAL (People Access List) data for one or more avatars. Using this method is faster than iterating over each avatar 
      * and obtaining data about each individually.
@@ -307,6 +337,7 @@ private:
     int _numHeroAvatars{ 0 };
     int _numHeroAvatarsUpdated{ 0 };
     float _avatarSimulationTime { 0.0f };
+    int _numAvatarsAtAnimationLOD[OtherAvatar::NumAnimationLODs] { 0, 0, 0 };
     bool _shouldRender { true };
     bool _myAvatarDataPacketsPaused { false };
 
@@ -314,6 +345,12 @@ private:
     workload::SpacePointer _space;
 
     AvatarTransit::TransitConfig  _transitConfig;
+
+    Setting::Handle<int> _animationLODMediumRegionSetting { "avatarAnimationLODMediumRegion", workload::Region::R2 };
+    Setting::Handle<int> _animationLODLowRegionSetting { "avatarAnimationLODLowRegion", workload::Region::R3 };
+    Setting::Handle<float> _animationLODMediumRateSetting { "avatarAnimationLODMediumRate", 30.0f };
+    Setting::Handle<float> _animationLODLowRateSetting { "avatarAnimationLODLowRate", 10.0f };
+    Setting::Handle<float> _animationLODSmoothingTimeSetting { "avatarAnimationLODSmoothingTime", 0.05f };
     bool _drawOtherAvatarSkeletons { false };
 };
 
@@ -120,6 +120,9 @@ void OtherAvatar::updateSpaceProxy(workload::Transaction& transaction) const {
 
 int OtherAvatar::parseDataFromBuffer(const QByteArray& buffer) {
     int32_t bytesRead = Avatar::parseDataFromBuffer(buffer);
+    if (_hasNewJointData) {
+        _jointBlendResidual = 1.0f;
+    }
     for (auto& detailedMotionState : _detailedMotionStates) {
         // NOTE: we activate _detailedMotionStates is because they are KINEMATIC
         // and Bullet will automagically call DetailedMotionState::getWorldTransform() when active.
@@ -221,6 +224,15 @@ void OtherAvatar::computeShapeLOD() {
     }
 }
 
+void OtherAvatar::setAnimationLOD(AnimationLOD lod, float updatePeriod, float smoothingTime) {
+    if (lod != _animationLOD) {
+        _animationLOD = lod;
+        _skeletonModel->setEnableEyeLookAt(lod != AnimationLODLow);
+    }
+    _animationLODUpdatePeriod = (lod == AnimationLODHigh) ? 0.0f : updatePeriod;
+    _animationLODSmoothingTime = (lod == AnimationLODHigh) ? 0.0f : smoothingTime;
+}
+
 bool OtherAvatar::isInPhysicsSimulation() const {
     return _motionState && _motionState->getRigidBody();
 }
@@ -264,10 +276,22 @@ void OtherAvatar::simulate(float deltaTime, bool inView) {
     PerformanceTimer perfTimer("simulate");
     {
         PROFILE_RANGE(simulation, "updateJoints");
+        _timeSinceJointUpdate += deltaTime;
         if (inView) {
             Head* head = getHead();
-            if (_hasNewJointData || _transit.isActive()) {
-                _skeletonModel->getRig().copyJointsFromJointData(_jointData);
+            bool jointUpdateDue = _timeSinceJointUpdate >= _animationLODUpdatePeriod || _transit.isActive();
+            if ((_hasNewJointData || _transit.isActive()) && jointUpdateDue) {
+                // at reduced animation LOD we only move part of the way toward the received pose each update
+                // so the lower rate shows up as smooth motion rather than as discrete steps
+                float alpha = 1.0f;
+                if (_jointBlendResidual == 0.0f) {
+                    _jointBlendResidual = 1.0f;
+                }
+                if (_animationLODSmoothingTime > 0.0f) {
+                    alpha = _timeSinceJointUpdate / (_timeSinceJointUpdate + _animationLODSmoothingTime);
+                }
+                _timeSinceJointUpdate = 0.0f;
+                _skeletonModel->getRig().copyJointsFromJointData(_jointData, alpha, _animationLOD == AnimationLODLow);
                 glm::mat4 rootTransform = glm::scale(_skeletonModel->getScale()) * glm::translate(_skeletonModel->getOffset());
                 _skeletonModel->getRig().computeExternalPoses(rootTransform);
                 _jointDataSimulationRate.increment();
@@ -276,7 +300,14 @@ void OtherAvatar::simulate(float deltaTime, bool inView) {
                 _skeletonModel->simulate(deltaTime, true);
 
                 locationChanged(); // joints changed, so if there are any children, update them.
-                _hasNewJointData = false;
+
+                // keep blending at the LOD rate until the pose has (nearly) caught up with the received one
+                const float MIN_JOINT_BLEND_RESIDUAL = 0.01f;
+                _jointBlendResidual *= (1.0f - alpha);
+                if (_jointBlendResidual < MIN_JOINT_BLEND_RESIDUAL) {
+                    _jointBlendResidual = 0.0f;
+                }
+                _hasNewJointData = _jointBlendResidual > 0.0f;
 
                 glm::vec3 headPosition = getWorldPosition();
                 if (!_skeletonModel->getHeadPosition(headPosition)) {
@@ -32,6 +32,13 @@ public:
         MultiSphereHigh // All joints
     };
 
+    enum AnimationLOD {
+        AnimationLODHigh = 0, // joints copied from the wire every frame
+        AnimationLODMedium, // joints copied at a reduced rate, interpolated toward the received pose
+        AnimationLODLow, // as medium, but skips finger joints and eye lookAt correction
+        NumAnimationLODs
+    };
+
     virtual void instantiableAvatar() override { };
     virtual void createOrb() override;
     virtual void indicateLoadingStatus(LoadingStatus loadingStatus) override;
@@ -58,6 +65,9 @@ public:
     BodyLOD getBodyLOD() { return _bodyLOD; }
     void computeShapeLOD();
 
+    void setAnimationLOD(AnimationLOD lod, float updatePeriod, float smoothingTime);
+    AnimationLOD getAnimationLOD() const { return _animationLOD; }
+
     void updateCollisionGroup(bool myAvatarCollide);
     bool getCollideWithOtherAvatars() const { return _collideWithOtherAvatars; } 
 
@@ -92,6 +102,11 @@ protected:
     int32_t _spaceIndex { -1 };
     uint8_t _workloadRegion { workload::Region::INVALID };
     BodyLOD _bodyLOD { BodyLOD::Sphere };
+    AnimationLOD _animationLOD { AnimationLODHigh };
+    float _animationLODUpdatePeriod { 0.0f };
+    float _animationLODSmoothingTime { 0.0f };
+    float _timeSinceJointUpdate { 0.0f };
+    float _jointBlendResidual { 0.0f };
     bool _needsDetailedRebuild { false };
 
 private:
@@ -668,6 +668,17 @@ void setupPreferences() {
         }
     }
 
+    static const QString PHYSICS_CATEGORY{ "Physics" };
+    {
+        auto getter = []()->int { return qApp->getPhysicsSimulationThreads(); };
+        auto setter = [](int value) { qApp->setPhysicsSimulationThreads(value); };
+        auto preference = new IntSpinnerPreference(PHYSICS_CATEGORY, "Simulation threads (1 = main thread only)", getter, setter);
+        preference->setMin(1);
+        preference->setMax(MAX_PHYSICS_SIMULATION_THREADS);
+        preference->setStep(1);
+        preferences->addPreference(preference);
+    }
+
     static const QString PLUGIN_CATEGORY{ "Plugins" };
     auto pluginManager = PluginManager::getInstance();
     {
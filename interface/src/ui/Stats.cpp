@@ -23,8 +23,10 @@
 #include <AudioClient.h>
 #include <GeometryCache.h>
 #include <LODManager.h>
+#include <ObjectMotionState.h>
 #include <OffscreenUi.h>
 #include <PerfStat.h>
+#include <PhysicalEntitySimulation.h>
 #include <plugins/DisplayPlugin.h>
 #include <PickManager.h>
 
@@ -127,9 +129,33 @@ void Stats::updateStats(bool force) {
     STAT_UPDATE(avatarCount, avatarManager->size() - 1);
     STAT_UPDATE(heroAvatarCount, avatarManager->getNumHeroAvatars());
     STAT_UPDATE(physicsObjectCount, qApp->getNumCollisionObjects());
+    ShapeManager* shapeManager = ObjectMotionState::getShapeManager();
+    if (shapeManager) {
+        uint32_t numMeshShapes = shapeManager->getNumShapesBuilt() + shapeManager->getNumShapesLoadedFromCache();
+        STAT_UPDATE_FLOAT(meshShapeBuildTime, shapeManager->getAverageShapeBuildTime(), 0.1f);
+        STAT_UPDATE_FLOAT(meshShapeLoadTime, shapeManager->getAverageShapeLoadTime(), 0.1f);
+        STAT_UPDATE(meshShapeCacheHitRate, numMeshShapes > 0 ?
+            (int)((100 * shapeManager->getNumShapesLoadedFromCache()) / numMeshShapes) : 0);
+    }
+    PhysicsEnginePointer physicsEngine = qApp->getPhysicsEngine();
+    if (physicsEngine) {
+        STAT_UPDATE_FLOAT(physicsStepTime, physicsEngine->getAverageStepTime(), 0.01f);
+    }
+    PhysicalEntitySimulationPointer entitySimulation = qApp->getEntitySimulation();
+    if (entitySimulation && (_expanded || force)) {
+        PhysicalEntitySimulation::RegionStats r1Stats = entitySimulation->getRegionStats(workload::Region::R1);
+        PhysicalEntitySimulation::RegionStats r2Stats = entitySimulation->getRegionStats(workload::Region::R2);
+        STAT_UPDATE(physicsR1BodyCount, (int)r1Stats.numBodies);
+        STAT_UPDATE(physicsR1ActiveBodyCount, (int)r1Stats.numActiveBodies);
+        STAT_UPDATE(physicsR2BodyCount, (int)r2Stats.numBodies);
+        STAT_UPDATE(physicsR2ActiveBodyCount, (int)r2Stats.numActiveBodies);
+        STAT_UPDATE(physicsReducedLODBodyCount, (int)r2Stats.numReducedLODBodies);
+    }
     STAT_UPDATE(updatedAvatarCount, avatarManager->getNumAvatarsUpdated());
     STAT_UPDATE(updatedHeroAvatarCount, avatarManager->getNumHeroAvatarsUpdated());
     STAT_UPDATE(notUpdatedAvatarCount, avatarManager->getNumAvatarsNotUpdated());
+    STAT_UPDATE(mediumAnimationLODAvatarCount, avatarManager->getNumAvatarsAtAnimationLOD(OtherAvatar::AnimationLODMedium));
+    STAT_UPDATE(lowAnimationLODAvatarCount, avatarManager->getNumAvatarsAtAnimationLOD(OtherAvatar::AnimationLODLow));
     STAT_UPDATE(serverCount, (int)nodeList->size());
     STAT_UPDATE_FLOAT(renderrate, qApp->getRenderLoopRate(), 0.1f);
     RefreshRateManager& refreshRateManager = qApp->getRefreshRateManager();
@@ -401,6 +427,9 @@ void Stats::updateStats(bool force) {
     if (_expanded) {
         STAT_UPDATE(gpuBuffers, (int)gpu::Context::getBufferGPUCount());
         STAT_UPDATE(gpuBufferMemory, (int)BYTES_TO_MB(gpu::Context::getBufferGPUMemSize()));
+        STAT_UPDATE(gpuBatchAllocations, (int)gpu::Context::getFrameBatchAllocations());
+        STAT_UPDATE(gpuBatchGrowths, (int)gpu::Context::getFrameBatchGrowths());
+        STAT_UPDATE(gpuPooledBatches, (int)gpu::Context::getNumPooledBatches());
         STAT_UPDATE(gpuTextures, (int)gpu::Context::getTextureGPUCount());
 
         STAT_UPDATE(glContextSwapchainMemory, (int)BYTES_TO_MB(gl::Context::getSwapchainMemoryUsage()));
@@ -594,6 +623,8 @@ void Stats::setRenderDetails(const render::RenderDetails& details) {
         STAT_UPDATE(shadowOutOfView, details._shadow._outOfView);
         STAT_UPDATE(shadowTooSmall, details._shadow._tooSmall);
         STAT_UPDATE(shadowRendered, details._shadow._rendered);
+        STAT_UPDATE_FLOAT(itemCullTime, details._item._cullTime + details._other._cullTime, 0.01f);
+        STAT_UPDATE_FLOAT(shadowCullTime, details._shadow._cullTime, 0.01f);
     }
 }
 
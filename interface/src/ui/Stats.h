@@ -87,6 +87,27 @@ private: \
  *     <em>Read-only.</em>
  * @property {number} physicsObjectCount - The number of objects that have collisions enabled.
  *     <em>Read-only.</em>
+ * @property {number} meshShapeBuildTime - The average time taken to build a static mesh collision shape from scratch, in ms.
+ *     <em>Read-only.</em>
+ * @property {number} meshShapeLoadTime - The average time taken to load a static mesh collision shape from the shape cache, 
+ *     in ms.
+ *     <em>Read-only.</em>
+ * @property {number} meshShapeCacheHitRate - The percentage of static mesh collision shapes that were loaded from the shape 
+ *     cache rather than built from scratch.
+ *     <em>Read-only.</em>
+ * @property {number} physicsStepTime - The average time taken to step the physics simulation, in ms.
+ *     <em>Read-only.</em>
+ * @property {number} physicsR1BodyCount - The number of entities simulated at full rate in the inner physics region.
+ *     <em>Read-only.</em>
+ * @property {number} physicsR1ActiveBodyCount - The number of entities in the inner physics region that are awake.
+ *     <em>Read-only.</em>
+ * @property {number} physicsR2BodyCount - The number of entities simulated in the outer physics region.
+ *     <em>Read-only.</em>
+ * @property {number} physicsR2ActiveBodyCount - The number of entities in the outer physics region that are awake.
+ *     <em>Read-only.</em>
+ * @property {number} physicsReducedLODBodyCount - The number of entities in the outer physics region that are simulated at 
+ *     reduced fidelity because they're owned by someone else.
+ *     <em>Read-only.</em>
  * @property {number} updatedAvatarCount - The number of avatars in the domain, other than the client's, that were updated in 
  *     the most recent game loop.
  *     <em>Read-only.</em>
@@ -96,6 +117,12 @@ private: \
  * @property {number} notUpdatedAvatarCount - The number of avatars in the domain, other than the client's, that weren't able 
  *     to be updated in the most recent game loop because there wasn't enough time to.
  *     <em>Read-only.</em>
+ * @property {number} mediumAnimationLODAvatarCount - The number of avatars in the domain, other than the client's, that were 
+ *     animated at medium level of detail in the most recent game loop.
+ *     <em>Read-only.</em>
+ * @property {number} lowAnimationLODAvatarCount - The number of avatars in the domain, other than the client's, that were 
+ *     animated at low level of detail in the most recent game loop.
+ *     <em>Read-only.</em>
  * @property {number} packetInCount - The number of packets being received from the domain server, in packets per second.
  *     <em>Read-only.</em>
  * @property {number} packetOutCount - The number of packets being sent to the domain server, in packets per second.
@@ -241,6 +268,10 @@ private: \
  *     <em>Read-only.</em>
  * @property {number} shadowRendered - The number of shadows rendered.
  *     <em>Read-only.</em>
+ * @property {number} itemCullTime - The time taken to cull items for the main, secondary camera and mirror views, in ms.
+ *     <em>Read-only.</em>
+ * @property {number} shadowCullTime - The time taken to cull items for the shadow cascades, in ms.
+ *     <em>Read-only.</em>
  * @property {string} sendingMode - Description of the octree sending mode.
  *     <em>Read-only.</em>
  * @property {string} packetStats - Description of the octree packet processing state.
@@ -283,6 +314,14 @@ private: \
  *     <em>Read-only.</em>
  * @property {number} gpuBufferMemory - The total memory size of the <code>gpuBuffers</code>, in MB. 
  *     <em>Read-only.</em>
+ * @property {number} gpuBatchAllocations - The number of <code>gpu::Batch</code>es that had to be created last frame because
+ *     the batch pool was empty.
+ *     <em>Read-only.</em>
+ * @property {number} gpuBatchGrowths - The number of pooled <code>gpu::Batch</code>es that had to grow their storage last
+ *     frame.
+ *     <em>Read-only.</em>
+ * @property {number} gpuPooledBatches - The number of <code>gpu::Batch</code>es waiting in the batch pool.
+ *     <em>Read-only.</em>
  * @property {number} gpuTextures - The number of OpenGL textures managed by the GPU back-end. This is the sum of the number of 
  *     textures managed for <code>gpuTextureResidentMemory</code>,  <code>gpuTextureResourceMemory</code>, and
  *     <code>gpuTextureFramebufferMemory</code>.
@@ -488,9 +527,20 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(QString, uxMode, QString())
     STATS_PROPERTY(int, heroAvatarCount, 0)
     STATS_PROPERTY(int, physicsObjectCount, 0)
+    STATS_PROPERTY(float, meshShapeBuildTime, 0)
+    STATS_PROPERTY(float, meshShapeLoadTime, 0)
+    STATS_PROPERTY(int, meshShapeCacheHitRate, 0)
+    STATS_PROPERTY(float, physicsStepTime, 0)
+    STATS_PROPERTY(int, physicsR1BodyCount, 0)
+    STATS_PROPERTY(int, physicsR1ActiveBodyCount, 0)
+    STATS_PROPERTY(int, physicsR2BodyCount, 0)
+    STATS_PROPERTY(int, physicsR2ActiveBodyCount, 0)
+    STATS_PROPERTY(int, physicsReducedLODBodyCount, 0)
     STATS_PROPERTY(int, updatedAvatarCount, 0)
     STATS_PROPERTY(int, updatedHeroAvatarCount, 0)
     STATS_PROPERTY(int, notUpdatedAvatarCount, 0)
+    STATS_PROPERTY(int, mediumAnimationLODAvatarCount, 0)
+    STATS_PROPERTY(int, lowAnimationLODAvatarCount, 0)
     STATS_PROPERTY(int, packetInCount, 0)
     STATS_PROPERTY(int, packetOutCount, 0)
     STATS_PROPERTY(float, mbpsIn, 0)
@@ -547,6 +597,8 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(int, shadowOutOfView, 0)
     STATS_PROPERTY(int, shadowTooSmall, 0)
     STATS_PROPERTY(int, shadowRendered, 0)
+    STATS_PROPERTY(float, itemCullTime, 0)
+    STATS_PROPERTY(float, shadowCullTime, 0)
     STATS_PROPERTY(QString, sendingMode, QString())
     STATS_PROPERTY(QString, packetStats, QString())
     STATS_PROPERTY(int, lodAngle, 0)
@@ -567,6 +619,9 @@ class Stats : public QQuickItem {
 
     STATS_PROPERTY(int, gpuBuffers, 0)
     STATS_PROPERTY(int, gpuBufferMemory, 0)
+    STATS_PROPERTY(int, gpuBatchAllocations, 0)
+    STATS_PROPERTY(int, gpuBatchGrowths, 0)
+    STATS_PROPERTY(int, gpuPooledBatches, 0)
     STATS_PROPERTY(int, gpuTextures, 0)
     STATS_PROPERTY(int, glContextSwapchainMemory, 0)
     STATS_PROPERTY(int, qmlTextureMemory, 0)
@@ -802,6 +857,69 @@ signals:
      */
     void physicsObjectCountChanged();
 
+    /*@jsdoc
+     * Triggered when the value of the <code>meshShapeBuildTime</code> property changes.
+     * @function Stats.meshShapeBuildTimeChanged
+     * @returns {Signal}
+     */
+    void meshShapeBuildTimeChanged();
+
+    /*@jsdoc
+     * Triggered when the value of the <code>meshShapeLoadTime</code> property changes.
+     * @function Stats.meshShapeLoadTimeChanged
+     * @returns {Signal}
+     */
+    void meshShapeLoadTimeChanged();
+
+    /*@jsdoc
+     * Triggered when the value of the <code>meshShapeCacheHitRate</code> property changes.
+     * @function Stats.meshShapeCacheHitRateChanged
+     * @returns {Signal}
+     */
+    void meshShapeCacheHitRateChanged();
+
+    /*@jsdoc
+     * Triggered when the value of the <code>physicsStepTime</code> property changes.
+     * @function Stats.physicsStepTimeChanged
+     * @returns {Signal}
+     */
+    void physicsStepTimeChanged();
+
+    /*@jsdoc
+     * Triggered when the value of the <code>physicsR1BodyCount</code> property changes.
+     * @function Stats.physicsR1BodyCountChanged
+     * @returns {Signal}
+     */
+    void physicsR1BodyCountChanged();
+
+    /*@jsdoc
+     * Triggered when the value of the <code>physicsR1ActiveBodyCount</code> property changes.
+     * @function Stats.physicsR1ActiveBodyCountChanged
+     * @returns {Signal}
+     */
+    void physicsR1ActiveBodyCountChanged();
+
+    /*@jsdoc
+     * Triggered when the value of the <code>physicsR2BodyCount</code> property changes.
+     * @function Stats.physicsR2BodyCountChanged
+     * @returns {Signal}
+     */
+    void physicsR2BodyCountChanged();
+
+    /*@jsdoc
+     * Triggered when the value of the <code>physicsR2ActiveBodyCount</code> property changes.
+     * @function Stats.physicsR2ActiveBodyCountChanged
+     * @returns {Signal}
+     */
+    void physicsR2ActiveBodyCountChanged();
+
+    /*@jsdoc
+     * Triggered when the value of the <code>physicsReducedLODBodyCount</code> property changes.
+     * @function Stats.physicsReducedLODBodyCountChanged
+     * @returns {Signal}
+     */
+    void physicsReducedLODBodyCountChanged();
+
     /*@jsdoc
      * Triggered when the value of the <code>updatedAvatarCount</code> property changes.
      * @function Stats.updatedAvatarCountChanged
@@ -823,6 +941,20 @@ signals:
      */
     void notUpdatedAvatarCountChanged();
 
+    /*@jsdoc
+     * Triggered when the value of the <code>mediumAnimationLODAvatarCount</code> property changes.
+     * @function Stats.mediumAnimationLODAvatarCountChanged
+     * @returns {Signal}
+     */
+    void mediumAnimationLODAvatarCountChanged();
+
+    /*@jsdoc
+     * Triggered when the value of the <code>lowAnimationLODAvatarCount</code> property changes.
+     * @function Stats.lowAnimationLODAvatarCountChanged
+     * @returns {Signal}
+     */
+    void lowAnimationLODAvatarCountChanged();
+
     /*@jsdoc
      * Triggered when the value of the <code>packetInCount</code> property changes.
      * @function Stats.packetInCountChanged
@@ -1203,6 +1335,20 @@ signals:
      */
     void shadowRenderedChanged();
 
+    /*@jsdoc
+     * Triggered when the value of the <code>itemCullTime</code> property changes.
+     * @function Stats.itemCullTimeChanged
+     * @returns {Signal}
+     */
+    void itemCullTimeChanged();
+
+    /*@jsdoc
+     * Triggered when the value of the <code>shadowCullTime</code> property changes.
+     * @function Stats.shadowCullTimeChanged
+     * @returns {Signal}
+     */
+    void shadowCullTimeChanged();
+
     /*@jsdoc
      * Triggered when the value of the <code>sendingMode</code> property changes.
      * @function Stats.sendingModeChanged
@@ -1336,6 +1482,27 @@ signals:
      */
     void gpuBufferMemoryChanged();
 
+    /*@jsdoc
+     * Triggered when the value of the <code>gpuBatchAllocations</code> property changes.
+     * @function Stats.gpuBatchAllocationsChanged
+     * @returns {Signal}
+     */
+    void gpuBatchAllocationsChanged();
+
+    /*@jsdoc
+     * Triggered when the value of the <code>gpuBatchGrowths</code> property changes.
+     * @function Stats.gpuBatchGrowthsChanged
+     * @returns {Signal}
+     */
+    void gpuBatchGrowthsChanged();
+
+    /*@jsdoc
+     * Triggered when the value of the <code>gpuPooledBatches</code> property changes.
+     * @function Stats.gpuPooledBatchesChanged
+     * @returns {Signal}
+     */
+    void gpuPooledBatchesChanged();
+
     /*@jsdoc
      * Triggered when the value of the <code>gpuTextures</code> property changes.
      * @function Stats.gpuTexturesChanged
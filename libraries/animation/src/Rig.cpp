@@ -667,6 +667,14 @@ void Rig::initJointStates(const HFMModel& hfmModel, const glm::mat4& modelOffset
 
     _leftEyeJointChildren = _animSkeleton->getChildrenOfJoint(indexOfJoint("LeftEye"));
     _rightEyeJointChildren = _animSkeleton->getChildrenOfJoint(indexOfJoint("RightEye"));
+
+    _handChildJointFlags.clear();
+    _handChildJointFlags.resize(_animSkeleton->getNumJoints(), false);
+    for (int handIndex : { _leftHandJointIndex, _rightHandJointIndex }) {
+        for (int childIndex : _animSkeleton->getChildrenOfJoint(handIndex)) {
+            _handChildJointFlags[childIndex] = true;
+        }
+    }
 }
 
 void Rig::reset(const HFMModel& hfmModel) {
@@ -2657,7 +2665,7 @@ void Rig::copyJointsIntoJointData(QVector<JointData>& jointDataVec) const {
     }
 }
 
-void Rig::copyJointsFromJointData(const QVector<JointData>& jointDataVec) {
+void Rig::copyJointsFromJointData(const QVector<JointData>& jointDataVec, float alpha, bool skipHandChildren) {
     DETAILED_PROFILE_RANGE(simulation_animation_detail, "copyJoints");
     DETAILED_PERFORMANCE_TIMER("copyJoints");
 
@@ -2694,15 +2702,27 @@ void Rig::copyJointsFromJointData(const QVector<JointData>& jointDataVec) {
         _internalPoseSet._relativePoses = _animSkeleton->getRelativeDefaultPoses();
     }
     const AnimPoseVec& relativeDefaultPoses = _animSkeleton->getRelativeDefaultPoses();
+    const bool shouldBlend = alpha < 1.0f;
+    skipHandChildren = skipHandChildren && (int)_handChildJointFlags.size() == numJoints;
     for (int i = 0; i < numJoints; i++) {
+        if (skipHandChildren && _handChildJointFlags[i]) {
+            continue;
+        }
         const JointData& data = jointDataVec.at(i);
-        _internalPoseSet._relativePoses[i].rot() = rotations[i];
+        AnimPose& relativePose = _internalPoseSet._relativePoses[i];
+        AnimPose targetPose = relativePose;
+        targetPose.rot() = rotations[i];
         if (data.translationIsDefaultPose) {
-            _internalPoseSet._relativePoses[i].trans() = relativeDefaultPoses[i].trans();
+            targetPose.trans() = relativeDefaultPoses[i].trans();
         } else {
             // JointData translations are in relative-frame
-            _internalPoseSet._relativePoses[i].trans() = data.translation;
+            targetPose.trans() = data.translation;
+        }
+        if (shouldBlend) {
+            // AnimPose::blend(src, alpha) yields lerp(src, this, alpha)
+            targetPose.blend(relativePose, alpha);
         }
+        relativePose = targetPose;
     }
 }
 
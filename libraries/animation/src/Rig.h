@@ -225,7 +225,9 @@ public:
     bool getRelativeDefaultJointTranslation(int index, glm::vec3& translationOut) const;
 
     void copyJointsIntoJointData(QVector<JointData>& jointDataVec) const;
-    void copyJointsFromJointData(const QVector<JointData>& jointDataVec);
+    // alpha < 1.0 moves the current pose only part of the way toward the network pose (used to hide the steps
+    // of avatars animated at a reduced rate) and skipHandChildren leaves the finger joints as they are.
+    void copyJointsFromJointData(const QVector<JointData>& jointDataVec, float alpha = 1.0f, bool skipHandChildren = false);
     void computeExternalPoses(const glm::mat4& modelOffsetMat);
 
     void computeAvatarBoundingCapsule(const HFMModel& hfmModel, float& radiusOut, float& heightOut, glm::vec3& offsetOut) const;
@@ -335,6 +337,8 @@ protected:
     int _rightElbowJointIndex { -1 };
     int _rightShoulderJointIndex { -1 };
 
+    std::vector<bool> _handChildJointFlags;
+
     glm::vec3 _lastForward;
     glm::vec3 _lastPosition;
     glm::vec3 _lastVelocity;
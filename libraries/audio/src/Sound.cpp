@@ -25,6 +25,7 @@
 #include <QtNetwork/QNetworkReply>
 #include <qendian.h>
 
+#include <ArtifactCache.h>
 #include <LimitedNodeList.h>
 #include <NetworkAccessManager.h>
 #include <SharedUtil.h>
@@ -41,6 +42,15 @@ int audioDataPointerMetaTypeID = qRegisterMetaType<AudioDataPointer>("AudioDataP
 
 using AudioConstants::AudioSample;
 
+// decoded sounds are kept in the artifact cache as a SoundArtifactHeader followed by the resampled samples
+const uint32_t SOUND_ARTIFACT_TYPE = 0x444E5553; // "SUND"
+const uint32_t SOUND_ARTIFACT_VERSION = 1;
+
+struct SoundArtifactHeader {
+    uint32_t numChannels;
+    uint32_t numSamples;
+};
+
 AudioDataPointer AudioData::make(uint32_t numSamples, uint32_t numChannels,
                                  const AudioSample* samples) {
     // Compute the amount of memory required for the audio data object
@@ -125,6 +135,14 @@ void SoundProcessor::run() {
     static const QString STEREO_RAW_EXTENSION = ".stereo.raw";
     QString fileType;
 
+    // the extension decides how the data is interpreted, so it's part of the key
+    QString extension = fileName.endsWith(STEREO_RAW_EXTENSION) ? STEREO_RAW_EXTENSION : fileName.mid(fileName.lastIndexOf('.'));
+    std::string artifactKey = ArtifactCache::computeKey(SOUND_ARTIFACT_TYPE, SOUND_ARTIFACT_VERSION, _data, extension.toUtf8());
+    if (auto audioData = loadAudioData(sound, artifactKey)) {
+        emit onSuccess(audioData);
+        return;
+    }
+
     QByteArray outputAudioByteArray;
     AudioProperties properties;
 
@@ -164,9 +182,36 @@ void SoundProcessor::run() {
     int numSamples = data.size() / AudioConstants::SAMPLE_SIZE;
     auto audioData = AudioData::make(numSamples, properties.numChannels,
                                      (const AudioSample*)data.constData());
+    saveAudioData(sound, artifactKey, audioData);
     emit onSuccess(audioData);
 }
 
+AudioDataPointer SoundProcessor::loadAudioData(const QSharedPointer<Sound>& sound, const std::string& key) {
+    auto artifact = sound->loadArtifact(key, SOUND_ARTIFACT_TYPE, SOUND_ARTIFACT_VERSION);
+    if (!artifact || artifact->size() < sizeof(SoundArtifactHeader)) {
+        return nullptr;
+    }
+    SoundArtifactHeader header;
+    memcpy(&header, artifact->data(), sizeof(SoundArtifactHeader));
+    if (header.numChannels == 0 || artifact->size() != sizeof(SoundArtifactHeader) + header.numSamples * sizeof(AudioSample)) {
+        return nullptr;
+    }
+    return AudioData::make(header.numSamples, header.numChannels,
+                           (const AudioSample*)(artifact->data() + sizeof(SoundArtifactHeader)));
+}
+
+void SoundProcessor::saveAudioData(const QSharedPointer<Sound>& sound, const std::string& key, const AudioDataPointer& audioData) {
+    SoundArtifactHeader header;
+    header.numChannels = audioData->getNumChannels();
+    header.numSamples = audioData->getNumSamples();
+
+    QByteArray artifact;
+    artifact.reserve((int)sizeof(SoundArtifactHeader) + (int)audioData->getNumBytes());
+    artifact.append((const char*)&header, sizeof(SoundArtifactHeader));
+    artifact.append(audioData->rawData(), audioData->getNumBytes());
+    sound->saveArtifact(key, SOUND_ARTIFACT_TYPE, SOUND_ARTIFACT_VERSION, artifact);
+}
+
 QByteArray SoundProcessor::downSample(const QByteArray& rawAudioByteArray,
                                       AudioProperties properties) {
 
@@ -119,6 +119,9 @@ signals:
     void onError(int error, QString str);
 
 private:
+    AudioDataPointer loadAudioData(const QSharedPointer<Sound>& sound, const std::string& key);
+    void saveAudioData(const QSharedPointer<Sound>& sound, const std::string& key, const AudioDataPointer& audioData);
+
     const QWeakPointer<Resource> _sound;
     const QByteArray _data;
 };
@@ -109,13 +109,17 @@ glm::vec3 SkeletonModel::avoidCrossedEyes(const glm::vec3& lookAt) {
 void SkeletonModel::updateRig(float deltaTime, glm::mat4 parentTransform) {
     assert(!_owningAvatar->isMyAvatar());
 
-    Head* head = _owningAvatar->getHead();
-    glm::vec3 lookAt = avoidCrossedEyes(head->getCorrectedLookAtPosition());
-
     // no need to call Model::updateRig() because otherAvatars get their joint state
     // copied directly from AvtarData::_jointData (there are no Rig animations to blend)
     _needsUpdateClusterMatrices = true;
 
+    if (!_enableEyeLookAt) {
+        return;
+    }
+
+    Head* head = _owningAvatar->getHead();
+    glm::vec3 lookAt = avoidCrossedEyes(head->getCorrectedLookAtPosition());
+
     // This is a little more work than we really want.
     //
     // Other avatars joint, including their eyes, should already be set just like any other joints
@@ -41,6 +41,10 @@ public:
     void updateRig(float deltaTime, glm::mat4 parentTransform) override;
     void updateAttitude(const glm::quat& orientation);
 
+    // when disabled the eyes keep the rotations received from the wire instead of tracking the corrected lookAt
+    void setEnableEyeLookAt(bool enable) { _enableEyeLookAt = enable; }
+    bool getEnableEyeLookAt() const { return _enableEyeLookAt; }
+
     bool getIsJointOverridden(int jointIndex) const;
 
     /// Returns the index of the left hand joint, or -1 if not found.
@@ -114,6 +118,7 @@ protected:
 
 private:
     bool _texturesLoaded { false };
+    bool _enableEyeLookAt { true };
 };
 
 #endif // hifi_SkeletonModel_h
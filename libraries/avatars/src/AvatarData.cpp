@@ -46,6 +46,7 @@
 #include <AudioHelpers.h>
 #include <Profile.h>
 #include <VariantMapToScriptValue.h>
+#include <BitStream.h>
 #include <BitVectorHelpers.h>
 
 #include "AvatarLogging.h"
@@ -87,7 +88,8 @@ size_t AvatarDataPacket::maxJointDataSize(size_t numJoints) {
     size_t totalSize = sizeof(uint8_t); // numJoints
 
     totalSize += validityBitsSize; // Orientations mask
-    totalSize += numJoints * sizeof(SixByteQuat); // Orientations
+    totalSize += sizeof(uint8_t); // Orientations keyframe info
+    totalSize += (numJoints * MAX_JOINT_ROTATION_BITS + BITS_IN_BYTE - 1) / BITS_IN_BYTE; // Orientations
     totalSize += validityBitsSize; // Translations mask
     totalSize += sizeof(float); // maxTranslationDimension
     totalSize += numJoints * sizeof(SixByteTrans); // Translations
@@ -100,6 +102,7 @@ size_t AvatarDataPacket::minJointDataSize(size_t numJoints) {
     size_t totalSize = sizeof(uint8_t); // numJoints
 
     totalSize += validityBitsSize; // Orientations mask
+    totalSize += sizeof(uint8_t); // Orientations keyframe info
     // assume no valid rotations
     totalSize += validityBitsSize; // Translations mask
     totalSize += sizeof(float); // maxTranslationDimension
@@ -301,7 +304,8 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
                                    const QVector<JointData>& lastSentJointData, AvatarDataPacket::SendStatus& sendStatus,
                                    bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
                                    QVector<JointData>* sentJointDataOut,
-                                   int maxDataSize, AvatarDataRate* outboundDataRateOut) const {
+                                   int maxDataSize, AvatarDataRate* outboundDataRateOut,
+                                   AvatarDataPacket::JointKeyframe* jointKeyframe) const {
 
     bool cullSmallChanges = (dataDetail == CullSmallData);
     bool sendAll = (dataDetail == SendAllData);
@@ -706,7 +710,8 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
     IF_AVATAR_SPACE(PACKET_HAS_JOINT_DATA, AvatarDataPacket::minJointDataSize(numJoints)) {
         // Minimum space required for another rotation joint -
         // size of joint + following translation bit-vector + translation scale:
-        const ptrdiff_t minSizeForJoint = sizeof(AvatarDataPacket::SixByteQuat) + jointBitVectorSize + sizeof(float);
+        const ptrdiff_t minSizeForJoint = (AvatarDataPacket::MAX_JOINT_ROTATION_BITS + BITS_IN_BYTE - 1) / BITS_IN_BYTE +
+            jointBitVectorSize + sizeof(float);
 
         auto startSection = destinationBuffer;
 
@@ -734,6 +739,41 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         destinationBuffer += jointBitVectorSize; // Move pointer past the validity bytes
 
+        // a SendAllData update starts a new keyframe, later updates to this listener can be delta coded against it
+        bool isKeyframe = false;
+        bool canDeltaCode = false;
+        if (jointKeyframe) {
+            if (sendAll) {
+                if (sendStatus.rotationsSent == 0) {
+                    jointKeyframe->generation = (jointKeyframe->generation + 1) & AvatarDataPacket::JOINT_KEYFRAME_GENERATION_MASK;
+                    jointKeyframe->rotations.assign(numJoints, Quaternions::IDENTITY);
+                    jointKeyframe->isValid.assign(numJoints, false);
+                }
+                isKeyframe = true;
+            } else {
+                canDeltaCode = cullSmallChanges &&
+                    jointKeyframe->generation != AvatarDataPacket::INVALID_JOINT_KEYFRAME_GENERATION &&
+                    (int)jointKeyframe->rotations.size() == numJoints;
+            }
+        }
+        *destinationBuffer++ = (isKeyframe ? AvatarDataPacket::JOINT_KEYFRAME_FLAG : 0) |
+            (jointKeyframe ? (jointKeyframe->generation & AvatarDataPacket::JOINT_KEYFRAME_GENERATION_MASK) : 0);
+
+        // pick the precision of absolute rotations from the distance to the listener, fingers get one level less
+        int distancePrecision = AvatarDataPacket::JOINT_ROTATION_HIGH;
+        std::vector<bool> detailJointFlags;
+        if (distanceAdjust) {
+            float distance = glm::distance(_globalPosition, viewerPosition);
+            if (distance >= AVATAR_DISTANCE_LEVEL_3) {
+                distancePrecision = AvatarDataPacket::JOINT_ROTATION_LOW;
+            } else if (distance >= AVATAR_DISTANCE_LEVEL_1) {
+                distancePrecision = AvatarDataPacket::JOINT_ROTATION_MEDIUM;
+            }
+            _avatarSkeletonDataLock.withReadLock([&] {
+                detailJointFlags = _detailJointFlags;
+            });
+        }
+
         // sentJointDataOut and lastSentJointData might be the same vector
         if (sentJointDataOut) {
             sentJointDataOut->resize(numJoints); // Make sure the destination is resized before using it
@@ -743,12 +783,13 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         float minRotationDOT = (distanceAdjust && cullSmallChanges) ? getDistanceBasedMinRotationDOT(viewerPosition) : AVATAR_MIN_ROTATION_DOT;
 
+        BitWriter rotationWriter(destinationBuffer, (int)(packetEnd - destinationBuffer));
         int i = sendStatus.rotationsSent;
         for (; i < numJoints; ++i) {
             const JointData& data = joints[i];
             const JointData& last = lastSentJointData[i];
 
-            if (packetEnd - destinationBuffer >= minSizeForJoint) {
+            if (packetEnd - (destinationBuffer + rotationWriter.getNumBytes()) >= minSizeForJoint) {
                 if (!data.rotationIsDefaultPose) {
                     // The dot product for larger rotations is a lower number,
                     // so if the dot() is less than the value, then the rotation is a larger angle of rotation
@@ -758,7 +799,31 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 #ifdef WANT_DEBUG
                         rotationSentCount++;
 #endif
-                        destinationBuffer += packOrientationQuatToSixBytes(destinationBuffer, data.rotation);
+                        if (canDeltaCode && jointKeyframe->isValid[i] &&
+                            isOrientationQuatDeltaInRange(jointKeyframe->rotations[i], data.rotation,
+                                                          AvatarDataPacket::JOINT_ROTATION_DELTA_MAX_COMPONENT)) {
+                            rotationWriter.write(AvatarDataPacket::JOINT_ROTATION_DELTA, AvatarDataPacket::JOINT_ROTATION_CODE_BITS);
+                            packOrientationQuatDeltaToBits(rotationWriter, jointKeyframe->rotations[i], data.rotation,
+                                                           AvatarDataPacket::JOINT_ROTATION_DELTA_BITS_PER_COMPONENT,
+                                                           AvatarDataPacket::JOINT_ROTATION_DELTA_MAX_COMPONENT);
+                        } else {
+                            int precision = distancePrecision;
+                            if (i < (int)detailJointFlags.size() && detailJointFlags[i]) {
+                                precision = std::min(precision + 1, (int)AvatarDataPacket::JOINT_ROTATION_LOW);
+                            }
+                            int bitsPerComponent = AvatarDataPacket::JOINT_ROTATION_BITS_PER_COMPONENT[precision];
+                            int startBit = rotationWriter.getNumBits();
+                            rotationWriter.write(precision, AvatarDataPacket::JOINT_ROTATION_CODE_BITS);
+                            packOrientationQuatToBits(rotationWriter, data.rotation, bitsPerComponent);
+
+                            if (isKeyframe) {
+                                // keep the rotation the listener will decode, so that deltas don't accumulate error
+                                BitReader reader(destinationBuffer, rotationWriter.getNumBytes());
+                                reader.skip(startBit + AvatarDataPacket::JOINT_ROTATION_CODE_BITS);
+                                unpackOrientationQuatFromBits(reader, jointKeyframe->rotations[i], bitsPerComponent);
+                                jointKeyframe->isValid[i] = true;
+                            }
+                        }
 
                         if (sentJoints) {
                             sentJoints[i].rotation = data.rotation;
@@ -775,6 +840,7 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         }
         sendStatus.rotationsSent = i;
+        destinationBuffer += rotationWriter.getNumBytes();
 
         // joint translation data
         validityPosition = destinationBuffer;
@@ -1362,20 +1428,62 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
             }
         }
 
-        // each joint rotation is stored in 6 bytes.
+        PACKET_READ_CHECK(JointRotationKeyframeInfo, sizeof(uint8_t));
+        uint8_t keyframeInfo = *sourceBuffer++;
+        uint8_t keyframeGeneration = keyframeInfo & AvatarDataPacket::JOINT_KEYFRAME_GENERATION_MASK;
+        bool isKeyframe = (keyframeInfo & AvatarDataPacket::JOINT_KEYFRAME_FLAG) != 0;
+        if (isKeyframe && (_receivedJointKeyframe.generation != keyframeGeneration ||
+                           (int)_receivedJointKeyframe.rotations.size() != numJoints)) {
+            _receivedJointKeyframe.generation = keyframeGeneration;
+            _receivedJointKeyframe.rotations.assign(numJoints, Quaternions::IDENTITY);
+            _receivedJointKeyframe.isValid.assign(numJoints, false);
+        }
+        bool hasKeyframe = _receivedJointKeyframe.generation == keyframeGeneration &&
+            (int)_receivedJointKeyframe.rotations.size() == numJoints;
+
+        // each joint rotation is a 2 bit code followed by a variable number of bits.
         QWriteLocker writeLock(&_jointDataLock);
         _jointData.resize(numJoints);
 
-        const int COMPRESSED_QUATERNION_SIZE = 6;
-        PACKET_READ_CHECK(JointRotations, numValidJointRotations * COMPRESSED_QUATERNION_SIZE);
+        PACKET_READ_CHECK(JointRotations, (numValidJointRotations * AvatarDataPacket::MIN_JOINT_ROTATION_BITS +
+            BITS_IN_BYTE - 1) / BITS_IN_BYTE);
+        BitReader rotationReader(sourceBuffer, (int)(endPosition - sourceBuffer));
         for (int i = 0; i < numJoints; i++) {
             JointData& data = _jointData[i];
             if (validRotations[i]) {
-                sourceBuffer += unpackOrientationQuatFromSixBytes(sourceBuffer, data.rotation);
+                uint32_t code = rotationReader.read(AvatarDataPacket::JOINT_ROTATION_CODE_BITS);
+                if (code == AvatarDataPacket::JOINT_ROTATION_DELTA) {
+                    glm::quat reference = hasKeyframe && _receivedJointKeyframe.isValid[i] ?
+                        _receivedJointKeyframe.rotations[i] : Quaternions::IDENTITY;
+                    glm::quat rotation;
+                    unpackOrientationQuatDeltaFromBits(rotationReader, reference, rotation,
+                                                       AvatarDataPacket::JOINT_ROTATION_DELTA_BITS_PER_COMPONENT,
+                                                       AvatarDataPacket::JOINT_ROTATION_DELTA_MAX_COMPONENT);
+                    if (!hasKeyframe || !_receivedJointKeyframe.isValid[i]) {
+                        // we missed the keyframe this delta refers to, wait for the next one
+                        continue;
+                    }
+                    data.rotation = rotation;
+                } else {
+                    unpackOrientationQuatFromBits(rotationReader, data.rotation,
+                                                  AvatarDataPacket::JOINT_ROTATION_BITS_PER_COMPONENT[code]);
+                    if (isKeyframe) {
+                        _receivedJointKeyframe.rotations[i] = data.rotation;
+                        _receivedJointKeyframe.isValid[i] = true;
+                    }
+                }
                 _hasNewJointData = true;
                 data.rotationIsDefaultPose = false;
             }
         }
+        if (rotationReader.hasOverflowed()) {
+            if (shouldLogError(now)) {
+                qCWarning(avatars) << "AvatarData packet too small, attempting to read JointRotations, only"
+                    << (endPosition - sourceBuffer) << "bytes left," << getSessionUUID();
+            }
+            return buffer.size();
+        }
+        sourceBuffer += rotationReader.getNumBytes();
 
         PACKET_READ_CHECK(JointTranslationValidityBits, bytesOfValidity);
 
@@ -2956,8 +3064,23 @@ AABox AvatarData::computeBubbleBox(float bubbleScale) const {
 }
 
 void AvatarData::setSkeletonData(const std::vector<AvatarSkeletonTrait::UnpackedJointData>& skeletonData) {
+    // joints below the hands (fingers) are sent with less precision than the rest of the skeleton
+    std::vector<bool> detailJointFlags(skeletonData.size(), false);
+    for (size_t i = 0; i < skeletonData.size(); i++) {
+        int parentIndex = skeletonData[i].parentIndex;
+        for (size_t depth = 0; depth < skeletonData.size() && parentIndex >= 0 && parentIndex < (int)skeletonData.size(); depth++) {
+            const QString& parentName = skeletonData[parentIndex].jointName;
+            if (parentName == "LeftHand" || parentName == "RightHand") {
+                detailJointFlags[i] = true;
+                break;
+            }
+            parentIndex = skeletonData[parentIndex].parentIndex;
+        }
+    }
+
     _avatarSkeletonDataLock.withWriteLock([&] {
         _avatarSkeletonData = skeletonData;
+        _detailJointFlags = detailJointFlags;
     });
 }
 
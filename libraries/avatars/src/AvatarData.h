@@ -15,6 +15,7 @@
 #ifndef hifi_AvatarData_h
 #define hifi_AvatarData_h
 
+#include <algorithm>
 #include <string>
 #include <memory>
 #include <queue>
@@ -345,7 +346,8 @@ namespace AvatarDataPacket {
     struct JointData {
         uint8_t numJoints;
         uint8_t rotationValidityBits[ceil(numJoints / 8)];     // one bit per joint, if true then a compressed rotation follows.
-        SixByteQuat rotation[numValidRotations];               // encodeded and compressed by packOrientationQuatToSixBytes()
+        uint8_t rotationKeyframeInfo;                          // JOINT_KEYFRAME_FLAG | keyframe generation
+        CompactQuat rotation[numValidRotations];               // bit packed, see JointRotationCode, padded to a whole byte
         uint8_t translationValidityBits[ceil(numJoints / 8)];  // one bit per joint, if true then a compressed translation follows.
         float maxTranslationDimension;                         // used to normalize fixed point translation values.
         SixByteTrans translation[numValidTranslations];        // normalized and compressed by packFloatVec3ToSignedTwoByteFixed()
@@ -358,6 +360,37 @@ namespace AvatarDataPacket {
     size_t maxJointDataSize(size_t numJoints);
     size_t minJointDataSize(size_t numJoints);
 
+    // Each compact joint rotation starts with a 2 bit code. The precision of absolute rotations is picked from the
+    // importance of the joint (fingers are less important) and the distance to the listener.
+    enum JointRotationCode : uint8_t {
+        JOINT_ROTATION_HIGH = 0, // smallest three, 15 bits per component
+        JOINT_ROTATION_MEDIUM, // smallest three, 12 bits per component
+        JOINT_ROTATION_LOW, // smallest three, 9 bits per component
+        JOINT_ROTATION_DELTA // delta from the rotation in the last keyframe, 10 bits per component
+    };
+    const int JOINT_ROTATION_CODE_BITS = 2;
+    const int JOINT_ROTATION_BITS_PER_COMPONENT[JOINT_ROTATION_DELTA] = { 15, 12, 9 };
+    const int JOINT_ROTATION_DELTA_BITS_PER_COMPONENT = 10;
+    const float JOINT_ROTATION_DELTA_MAX_COMPONENT = 0.125f; // sin(halfAngle), deltas up to about 14 degrees
+    // absolute rotations also carry the index of the largest component, which isn't sent
+    const int JOINT_ROTATION_LARGEST_COMPONENT_BITS = 2;
+    const int MAX_JOINT_ROTATION_BITS = JOINT_ROTATION_CODE_BITS + JOINT_ROTATION_LARGEST_COMPONENT_BITS +
+        3 * JOINT_ROTATION_BITS_PER_COMPONENT[JOINT_ROTATION_HIGH];
+    const int MIN_JOINT_ROTATION_BITS = JOINT_ROTATION_CODE_BITS +
+        std::min(JOINT_ROTATION_LARGEST_COMPONENT_BITS + 3 * JOINT_ROTATION_BITS_PER_COMPONENT[JOINT_ROTATION_LOW],
+                 3 * JOINT_ROTATION_DELTA_BITS_PER_COMPONENT);
+
+    // A keyframe is the set of rotations sent in a SendAllData update. Later updates for the same listener can
+    // delta code against it; the receiver drops delta coded rotations whose keyframe generation it didn't get.
+    const uint8_t JOINT_KEYFRAME_FLAG = 0x80;
+    const uint8_t JOINT_KEYFRAME_GENERATION_MASK = 0x7f;
+    const uint8_t INVALID_JOINT_KEYFRAME_GENERATION = 0xff;
+    struct JointKeyframe {
+        uint8_t generation { INVALID_JOINT_KEYFRAME_GENERATION };
+        std::vector<glm::quat> rotations; // as decoded by the receiver
+        std::vector<bool> isValid;
+    };
+
     /*
     struct JointDefaultPoseFlags {
        uint8_t numJoints;
@@ -628,7 +661,8 @@ public:
 
     virtual QByteArray toByteArray(AvatarDataDetail dataDetail, quint64 lastSentTime, const QVector<JointData>& lastSentJointData,
         AvatarDataPacket::SendStatus& sendStatus, bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
-        QVector<JointData>* sentJointDataOut, int maxDataSize = 0, AvatarDataRate* outboundDataRateOut = nullptr) const;
+        QVector<JointData>* sentJointDataOut, int maxDataSize = 0, AvatarDataRate* outboundDataRateOut = nullptr,
+        AvatarDataPacket::JointKeyframe* jointKeyframe = nullptr) const;
 
     virtual void doneEncoding(bool cullSmallChanges);
 
@@ -1594,6 +1628,7 @@ protected:
 
     QVector<JointData> _jointData; ///< the state of the skeleton joints
     QVector<JointData> _lastSentJointData; ///< the state of the skeleton joints last time we transmitted
+    AvatarDataPacket::JointKeyframe _receivedJointKeyframe; ///< reference for delta coded joint rotations
     mutable QReadWriteLock _jointDataLock;
 
     // key state
@@ -1693,6 +1728,7 @@ protected:
 
     mutable ReadWriteLockable _avatarSkeletonDataLock;
     std::vector<AvatarSkeletonTrait::UnpackedJointData> _avatarSkeletonData;
+    std::vector<bool> _detailJointFlags; // joints sent at reduced precision (fingers), guarded by _avatarSkeletonDataLock
 
     // used to transform any sensor into world space, including the _hmdSensorMat, or hand controllers.
     ThreadSafeValueCache<glm::mat4> _sensorToWorldMatrixCache { glm::mat4() };
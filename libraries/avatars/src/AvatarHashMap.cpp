@@ -13,6 +13,7 @@
 
 #include <QtCore/QDataStream>
 
+#include <NLPacketList.h>
 #include <NodeList.h>
 #include <udt/PacketHeaders.h>
 #include <PerfStat.h>
@@ -139,6 +140,54 @@ AvatarHashMap::AvatarHashMap() {
             clearOtherAvatars();
         }
     });
+
+    connect(nodeList.data(), &NodeList::nodeActivated, this, [this](SharedNodePointer activatedNode) {
+        if (activatedNode->getType() == NodeType::AvatarMixer) {
+            sendKnownTraitHashes(activatedNode);
+        }
+    });
+}
+
+void AvatarHashMap::sendKnownTraitHashes(const SharedNodePointer& avatarMixer) {
+    auto hashes = _traitBlobCache.getHashes();
+    if (hashes.empty()) {
+        return;
+    }
+    if (hashes.size() > (size_t)AvatarTraits::MAX_REPORTED_TRAIT_HASHES) {
+        hashes.resize(AvatarTraits::MAX_REPORTED_TRAIT_HASHES);
+    }
+
+    auto nodeList = DependencyManager::get<NodeList>();
+    auto hashesPacketList = NLPacketList::create(PacketType::AvatarTraitHashes, QByteArray(), true, true);
+    hashesPacketList->writePrimitive(AvatarTraits::KnownTraitHashes);
+    for (auto traitHash : hashes) {
+        hashesPacketList->writePrimitive(traitHash);
+    }
+    nodeList->sendPacketList(std::move(hashesPacketList), *avatarMixer);
+}
+
+void AvatarHashMap::sendTraitHashesReport(AvatarTraits::TraitHashesReport report, const QByteArray& entries) {
+    auto nodeList = DependencyManager::get<NodeList>();
+    SharedNodePointer avatarMixer = nodeList->soloNodeOfType(NodeType::AvatarMixer);
+    if (avatarMixer.isNull() || entries.isEmpty()) {
+        return;
+    }
+
+    auto reportPacketList = NLPacketList::create(PacketType::AvatarTraitHashes, QByteArray(), true, true);
+    reportPacketList->writePrimitive(report);
+    reportPacketList->write(entries);
+    nodeList->sendPacketList(std::move(reportPacketList), *avatarMixer);
+}
+
+void AvatarHashMap::trimTraitBlobCache() {
+    if (_traitBlobCache.getTotalSize() <= MAX_TRAIT_BLOB_CACHE_SIZE) {
+        return;
+    }
+
+    // the mixer would otherwise keep sending the hashes of the blobs we just dropped
+    auto evicted = _traitBlobCache.trim(TRIMMED_TRAIT_BLOB_CACHE_SIZE);
+    QByteArray entries(reinterpret_cast<const char*>(evicted.data()), (int)(evicted.size() * sizeof(AvatarTraits::TraitHash)));
+    sendTraitHashesReport(AvatarTraits::EvictedTraitHashes, entries);
 }
 
 QVector<QUuid> AvatarHashMap::getAvatarIdentifiers() {
@@ -339,6 +388,33 @@ void AvatarHashMap::processAvatarIdentityPacket(QSharedPointer<ReceivedMessage>
     }
 }
 
+bool AvatarHashMap::readTraitData(ReceivedMessage& message, AvatarTraits::TraitWireSize traitBinarySize,
+                                  QByteArray& traitData, const QUuid& avatarID, QByteArray& missingTraitHashes) {
+    if (traitBinarySize == AvatarTraits::HASHED_TRAIT_SIZE) {
+        if (message.getBytesLeftToRead() < qint64(sizeof(AvatarTraits::TraitHash))) {
+            qWarning() << "Malformed bulk trait packet, bailling";
+            return false;
+        }
+        AvatarTraits::TraitHash traitHash;
+        message.readPrimitive(&traitHash);
+        traitData = _traitBlobCache.find(traitHash);
+        if (traitData.isNull()) {
+            // evicted before the mixer heard about it, ask for the avatar's traits in full
+            qCDebug(avatars) << "Avatar mixer referenced trait data" << traitHash << "that is not in the cache";
+            missingTraitHashes.append(avatarID.toRfc4122());
+            missingTraitHashes.append(reinterpret_cast<const char*>(&traitHash), sizeof(AvatarTraits::TraitHash));
+        }
+    } else if (traitBinarySize >= 0) {
+        traitData = message.read(traitBinarySize);
+        // the mixer will assume we have this blob from now on, even if we don't use it
+        if (AvatarTraits::isHashableTraitData(traitData)) {
+            _traitBlobCache.insert(AvatarTraits::hashTraitData(traitData), traitData);
+            trimTraitBlobCache();
+        }
+    }
+    return true;
+}
+
 void AvatarHashMap::processBulkAvatarTraits(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
     AvatarTraits::TraitMessageSequence seq;
 
@@ -360,6 +436,7 @@ void AvatarHashMap::processBulkAvatarTraits(QSharedPointer<ReceivedMessage> mess
         nodeList->sendPacket(std::move(traitsAckPacket), *avatarMixer);
     }
 
+    QByteArray missingTraitHashes;
     while (message->getBytesLeftToRead() > 0) {
         // Trying to read more bytes than available, bail
         if (message->getBytesLeftToRead() < qint64(NUM_BYTES_RFC4122_UUID +
@@ -393,7 +470,6 @@ void AvatarHashMap::processBulkAvatarTraits(QSharedPointer<ReceivedMessage> mess
             message->readPrimitive(&packetTraitVersion);
 
             AvatarTraits::TraitWireSize traitBinarySize;
-            bool skipBinaryTrait = false;
 
             if (AvatarTraits::isSimpleTrait(traitType)) {
                 // Trying to read more bytes than available, bail
@@ -405,19 +481,21 @@ void AvatarHashMap::processBulkAvatarTraits(QSharedPointer<ReceivedMessage> mess
                 message->readPrimitive(&traitBinarySize);
 
                 // Trying to read more bytes than available, bail
-                if (message->getBytesLeftToRead() < traitBinarySize) {
+                if (traitBinarySize < AvatarTraits::HASHED_TRAIT_SIZE || message->getBytesLeftToRead() < traitBinarySize) {
                     qWarning() << "Malformed bulk trait packet, bailling";
                     return;
                 }
 
+                QByteArray traitData;
+                if (!readTraitData(*message, traitBinarySize, traitData, avatarID, missingTraitHashes)) {
+                    return;
+                }
+
                 // check if this trait version is newer than what we already have for this avatar
-                if (packetTraitVersion > lastProcessedVersions[traitType]) {
-                    auto traitData = message->read(traitBinarySize);
+                if (packetTraitVersion > lastProcessedVersions[traitType] && !traitData.isNull()) {
                     avatar->processTrait(traitType, traitData);
                     _replicas.processTrait(avatarID, traitType, traitData);
                     lastProcessedVersions[traitType] = packetTraitVersion;
-                } else {
-                    skipBinaryTrait = true;
                 }
             } else {
                 // Trying to read more bytes than available, bail
@@ -433,36 +511,37 @@ void AvatarHashMap::processBulkAvatarTraits(QSharedPointer<ReceivedMessage> mess
                 message->readPrimitive(&traitBinarySize);
 
                 // Trying to read more bytes than available, bail
-                if (traitBinarySize < -1 || message->getBytesLeftToRead() < traitBinarySize) {
+                if (traitBinarySize < AvatarTraits::HASHED_TRAIT_SIZE || message->getBytesLeftToRead() < traitBinarySize) {
                     qWarning() << "Malformed bulk trait packet, bailling";
                     return;
                 }
 
+                QByteArray traitData;
+                if (traitBinarySize != AvatarTraits::DELETED_TRAIT_SIZE &&
+                    !readTraitData(*message, traitBinarySize, traitData, avatarID, missingTraitHashes)) {
+                    return;
+                }
+
                 auto& processedInstanceVersion = lastProcessedVersions.getInstanceValueRef(traitType, traitInstanceID);
                 if (packetTraitVersion > processedInstanceVersion) {
                     if (traitBinarySize == AvatarTraits::DELETED_TRAIT_SIZE) {
                         avatar->processDeletedTraitInstance(traitType, traitInstanceID);
                         _replicas.processDeletedTraitInstance(avatarID, traitType, traitInstanceID);
-                    } else {
-                        auto traitData = message->read(traitBinarySize);
+                        processedInstanceVersion = packetTraitVersion;
+                    } else if (!traitData.isNull()) {
                         avatar->processTraitInstance(traitType, traitInstanceID, traitData);
                         _replicas.processTraitInstance(avatarID, traitType, traitInstanceID, traitData);
+                        processedInstanceVersion = packetTraitVersion;
                     }
-                    processedInstanceVersion = packetTraitVersion;
-                } else {
-                    skipBinaryTrait = true;
                 }
             }
 
-            if (skipBinaryTrait && traitBinarySize > 0) {
-                // we didn't read this trait because it was older or because we didn't have an avatar to process it for
-                message->seek(message->getPosition() + traitBinarySize);
-            }
-
             // read the next trait type, which is null if there are no more traits for this avatar
             message->readPrimitive(&traitType);
         }
     }
+
+    sendTraitHashesReport(AvatarTraits::MissingTraitHashes, missingTraitHashes);
 }
 
 void AvatarHashMap::processKillAvatar(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
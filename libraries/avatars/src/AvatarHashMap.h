@@ -30,6 +30,7 @@
 #include "ScriptAvatarData.h"
 
 #include "AvatarData.h"
+#include "AvatarTraitBlobCache.h"
 #include "AssociatedTraitValues.h"
 
 const int CLIENT_TO_AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND = 50;
@@ -235,12 +236,21 @@ protected:
     virtual void removeAvatar(const QUuid& sessionUUID, KillAvatarReason removalReason = KillAvatarReason::NoReason);
     
     virtual void handleRemovedAvatar(const AvatarSharedPointer& removedAvatar, KillAvatarReason removalReason = KillAvatarReason::NoReason);
+
+    void sendKnownTraitHashes(const SharedNodePointer& avatarMixer);
+    void sendTraitHashesReport(AvatarTraits::TraitHashesReport report, const QByteArray& entries);
+    // reads the binary data of a trait, or looks it up in the blob cache if the mixer only sent its hash
+    // the hashes of blobs that aren't in the cache are added to missingTraitHashes, along with the avatar ID
+    bool readTraitData(ReceivedMessage& message, AvatarTraits::TraitWireSize traitBinarySize, QByteArray& traitData,
+                       const QUuid& avatarID, QByteArray& missingTraitHashes);
+    void trimTraitBlobCache();
     
     mutable QReadWriteLock _hashLock;
     AvatarHash _avatarHash;
 
     std::unordered_map<QUuid, AvatarTraits::TraitVersions> _processedTraitVersions;
     AvatarReplicas _replicas;
+    AvatarTraitBlobCache _traitBlobCache;
 
 private:
     QUuid _lastOwnerSessionUUID;
@@ -0,0 +1,75 @@
+//
+//  AvatarTraitBlobCache.cpp
+//  libraries/avatars/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "AvatarTraitBlobCache.h"
+
+#include <algorithm>
+
+void AvatarTraitBlobCache::insert(AvatarTraits::TraitHash traitHash, const QByteArray& traitBinaryData) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& entry = _entries[traitHash];
+    if (entry.data.isNull()) {
+        entry.data = traitBinaryData;
+        _totalSize += traitBinaryData.size();
+    }
+    entry.lastUsed = ++_useCounter;
+}
+
+QByteArray AvatarTraitBlobCache::find(AvatarTraits::TraitHash traitHash) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entries.find(traitHash);
+    if (it == _entries.end()) {
+        return QByteArray();
+    }
+    it->second.lastUsed = ++_useCounter;
+    return it->second.data;
+}
+
+std::vector<AvatarTraits::TraitHash> AvatarTraitBlobCache::getHashes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<AvatarTraits::TraitHash> hashes;
+    hashes.reserve(_entries.size());
+    for (const auto& entry : _entries) {
+        hashes.push_back(entry.first);
+    }
+    return hashes;
+}
+
+size_t AvatarTraitBlobCache::getTotalSize() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _totalSize;
+}
+
+std::vector<AvatarTraits::TraitHash> AvatarTraitBlobCache::trim(size_t maxSize) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<AvatarTraits::TraitHash> evicted;
+    if (_totalSize <= maxSize) {
+        return evicted;
+    }
+
+    std::vector<std::pair<uint64_t, AvatarTraits::TraitHash>> byAge;
+    byAge.reserve(_entries.size());
+    for (const auto& entry : _entries) {
+        byAge.emplace_back(entry.second.lastUsed, entry.first);
+    }
+    std::sort(byAge.begin(), byAge.end());
+
+    for (const auto& oldest : byAge) {
+        if (_totalSize <= maxSize) {
+            break;
+        }
+        auto it = _entries.find(oldest.second);
+        _totalSize -= it->second.data.size();
+        _entries.erase(it);
+        evicted.push_back(oldest.second);
+    }
+    return evicted;
+}
@@ -0,0 +1,56 @@
+//
+//  AvatarTraitBlobCache.h
+//  libraries/avatars/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_AvatarTraitBlobCache_h
+#define hifi_AvatarTraitBlobCache_h
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QByteArray>
+
+#include "AvatarTraits.h"
+
+const size_t MAX_TRAIT_BLOB_CACHE_SIZE = 32 * 1024 * 1024;
+// once full, the cache is trimmed further than its maximum so that it isn't sorted again for every new blob
+const size_t TRIMMED_TRAIT_BLOB_CACHE_SIZE = 24 * 1024 * 1024;
+
+// Content addressed store of the trait blobs received from the avatar mixer.
+// The hashes of the cached blobs are reported to a newly connected mixer, which then sends a hash instead of the
+// blob for any trait it knows we have. The mixer assumes we keep every blob it sends us, so the hashes of evicted
+// blobs must be reported to it.
+class AvatarTraitBlobCache {
+public:
+    void insert(AvatarTraits::TraitHash traitHash, const QByteArray& traitBinaryData);
+    // returns a null QByteArray if the blob isn't in the cache
+    QByteArray find(AvatarTraits::TraitHash traitHash);
+
+    std::vector<AvatarTraits::TraitHash> getHashes() const;
+    size_t getTotalSize() const;
+
+    // evicts the least recently used blobs until the cache holds at most maxSize bytes
+    // returns the hashes of the evicted blobs
+    std::vector<AvatarTraits::TraitHash> trim(size_t maxSize);
+
+private:
+    struct Entry {
+        QByteArray data;
+        uint64_t lastUsed { 0 };
+    };
+
+    mutable std::mutex _mutex;
+    std::unordered_map<AvatarTraits::TraitHash, Entry> _entries;
+    uint64_t _useCounter { 0 };
+    size_t _totalSize { 0 };
+};
+
+#endif // hifi_AvatarTraitBlobCache_h
@@ -11,12 +11,71 @@
 
 #include "AvatarTraits.h"
 
+#include <QtCore/QCryptographicHash>
+
 #include <ExtendedIODevice.h>
 
 #include "AvatarData.h"
 
 namespace AvatarTraits {
 
+    TraitHash hashTraitData(const QByteArray& traitBinaryData) {
+        // 64 bits of a cryptographic hash, so that a client can't craft a blob that shadows another avatar's
+        auto digest = QCryptographicHash::hash(traitBinaryData, QCryptographicHash::Sha256);
+        TraitHash traitHash;
+        memcpy(&traitHash, digest.constData(), sizeof(TraitHash));
+        return traitHash;
+    }
+
+    static qint64 packTraitData(ExtendedIODevice& destination, const QByteArray& traitBinaryData,
+                                TraitHash traitHash, bool sendHashOnly) {
+        qint64 bytesWritten = 0;
+        if (sendHashOnly) {
+            bytesWritten += destination.writePrimitive(HASHED_TRAIT_SIZE);
+            bytesWritten += destination.writePrimitive(traitHash);
+        } else {
+            bytesWritten += destination.writePrimitive((TraitWireSize)traitBinaryData.size());
+            bytesWritten += destination.write(traitBinaryData);
+        }
+        return bytesWritten;
+    }
+
+    qint64 packVersionedTraitData(TraitType traitType, ExtendedIODevice& destination, TraitVersion traitVersion,
+                                  const QByteArray& traitBinaryData, TraitHash traitHash, bool sendHashOnly) {
+        if (traitBinaryData.size() > MAXIMUM_TRAIT_SIZE) {
+            qWarning() << "Refusing to pack simple trait" << traitType << "of size" << traitBinaryData.size()
+                        << "bytes since it exceeds the maximum size" << MAXIMUM_TRAIT_SIZE << "bytes";
+            return 0;
+        }
+
+        qint64 bytesWritten = 0;
+        bytesWritten += destination.writePrimitive((TraitType)traitType);
+        bytesWritten += destination.writePrimitive((TraitVersion)traitVersion);
+        bytesWritten += packTraitData(destination, traitBinaryData, traitHash, sendHashOnly);
+        return bytesWritten;
+    }
+
+    qint64 packVersionedTraitInstanceData(TraitType traitType, TraitInstanceID traitInstanceID,
+                                          ExtendedIODevice& destination, TraitVersion traitVersion,
+                                          const QByteArray& traitBinaryData, TraitHash traitHash, bool sendHashOnly) {
+        if (traitBinaryData.size() > MAXIMUM_TRAIT_SIZE) {
+            qWarning() << "Refusing to pack instanced trait" << traitType << "of size" << traitBinaryData.size()
+                        << "bytes since it exceeds the maximum size " << MAXIMUM_TRAIT_SIZE << "bytes";
+            return 0;
+        }
+
+        qint64 bytesWritten = 0;
+        bytesWritten += destination.writePrimitive((TraitType)traitType);
+        bytesWritten += destination.writePrimitive((TraitVersion)traitVersion);
+        bytesWritten += destination.write(traitInstanceID.toRfc4122());
+        if (!traitBinaryData.isNull()) {
+            bytesWritten += packTraitData(destination, traitBinaryData, traitHash, sendHashOnly);
+        } else {
+            bytesWritten += destination.writePrimitive(DELETED_TRAIT_SIZE);
+        }
+        return bytesWritten;
+    }
+
     qint64 packTrait(TraitType traitType, ExtendedIODevice& destination, const AvatarData& avatar) {
         // Call packer function
         auto traitBinaryData = avatar.packTrait(traitType);
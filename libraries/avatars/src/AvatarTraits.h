@@ -17,6 +17,7 @@
 #include <array>
 #include <vector>
 
+#include <QtCore/QByteArray>
 #include <QtCore/QUuid>
 
 class ExtendedIODevice;
@@ -55,8 +56,26 @@ namespace AvatarTraits {
 
     using TraitWireSize = int16_t;
     const TraitWireSize DELETED_TRAIT_SIZE = -1;
+    const TraitWireSize HASHED_TRAIT_SIZE = -2; // the binary data is replaced by the TraitHash of a blob the receiver has
     const TraitWireSize MAXIMUM_TRAIT_SIZE = INT16_MAX;
 
+    // Trait blobs are content addressed so that the mixer can avoid sending the same blob (e.g. a popular wearable)
+    // to a listener more than once. Smaller blobs are always sent in full.
+    using TraitHash = uint64_t;
+    const int MIN_HASHED_TRAIT_SIZE = 64;
+    const int MAX_REPORTED_TRAIT_HASHES = 4096;
+    // AvatarTraitHashes packets start with one of these, followed by the hashes (and for missing blobs, the avatar ID
+    // before each hash)
+    enum TraitHashesReport : uint8_t {
+        KnownTraitHashes = 0, // blobs the client has, sent when a mixer activates
+        EvictedTraitHashes,   // blobs the client dropped from its cache, the mixer must send them in full again
+        MissingTraitHashes,   // blobs the mixer referenced that the client didn't have, the mixer resends that avatar's traits
+    };
+    TraitHash hashTraitData(const QByteArray& traitBinaryData);
+    inline bool isHashableTraitData(const QByteArray& traitBinaryData) {
+        return traitBinaryData.size() >= MIN_HASHED_TRAIT_SIZE;
+    }
+
     using TraitMessageSequence = int64_t;
     const TraitMessageSequence FIRST_TRAIT_SEQUENCE = 0;
     const TraitMessageSequence MAX_TRAIT_SEQUENCE = INT64_MAX;
@@ -74,6 +93,14 @@ namespace AvatarTraits {
     qint64 packInstancedTraitDelete(TraitType traitType, TraitInstanceID instanceID, ExtendedIODevice& destination,
                                            TraitVersion traitVersion = NULL_TRAIT_VERSION);
 
+    // versions of the above used by the mixer, which packs trait data once and sends it to many listeners.
+    // If sendHashOnly is true only the hash of traitBinaryData is written.
+    qint64 packVersionedTraitData(TraitType traitType, ExtendedIODevice& destination, TraitVersion traitVersion,
+                                  const QByteArray& traitBinaryData, TraitHash traitHash, bool sendHashOnly);
+    qint64 packVersionedTraitInstanceData(TraitType traitType, TraitInstanceID traitInstanceID,
+                                          ExtendedIODevice& destination, TraitVersion traitVersion,
+                                          const QByteArray& traitBinaryData, TraitHash traitHash, bool sendHashOnly);
+
 };
 
 #endif // hifi_AvatarTraits_h
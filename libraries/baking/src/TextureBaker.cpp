@@ -26,6 +26,12 @@
 #include <TextureMeta.h>
 
 #include <OwningBuffer.h>
+#include <Finally.h>
+
+#include <future>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 
 #include "ModelBakingLoggingCategory.h"
 
@@ -131,6 +137,111 @@ void TextureBaker::handleTextureNetworkReply() {
     }
 }
 
+namespace {
+
+// The files a texture bake produced besides the copy of the original, named by what follows the base filename
+struct BakedTextureFile {
+    bool isUncompressed;
+    khronos::gl::texture::InternalFormat internalFormat;
+    QString fileSuffix;
+    QByteArray data;
+};
+using BakedTextureFiles = std::vector<BakedTextureFile>;
+using BakedTextureFilesPointer = std::shared_ptr<const BakedTextureFiles>;
+
+// Baked textures by source hash.  A texture that's still being baked is waited on rather than baked again.
+class BakedTextureCache {
+public:
+    void setMaxSize(size_t maxSize) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _maxSize = maxSize;
+        evict();
+    }
+
+    // \return the files of an earlier bake of the same texture, or nullptr if there's none.  When isOwner is set the
+    // caller bakes the texture and must pass the result, or nullptr if it failed, to finish().
+    BakedTextureFilesPointer find(const std::string& hash, bool& isOwner) {
+        isOwner = false;
+        std::shared_future<BakedTextureFilesPointer> future;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_maxSize == 0) {
+                return nullptr;
+            }
+            auto it = _entries.find(hash);
+            if (it == _entries.end()) {
+                Entry& entry = _entries[hash];
+                entry.future = entry.promise.get_future().share();
+                isOwner = true;
+                return nullptr;
+            }
+            future = it->second.future;
+            // a texture still being baked isn't in the list yet, and can't be evicted
+            if (it->second.isFinished) {
+                _recentlyUsed.splice(_recentlyUsed.end(), _recentlyUsed, it->second.recentlyUsedPosition);
+            }
+        }
+        return future.get();
+    }
+
+    void finish(const std::string& hash, const BakedTextureFilesPointer& files) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _entries.find(hash);
+        if (it == _entries.end()) {
+            return;
+        }
+        it->second.promise.set_value(files);
+        if (!files) {
+            // the next texture with this hash gets a fresh try
+            _entries.erase(it);
+            return;
+        }
+        for (const auto& file : *files) {
+            it->second.size += file.data.size();
+        }
+        _size += it->second.size;
+        it->second.isFinished = true;
+        it->second.recentlyUsedPosition = _recentlyUsed.insert(_recentlyUsed.end(), hash);
+        evict();
+    }
+
+private:
+    struct Entry {
+        std::promise<BakedTextureFilesPointer> promise;
+        std::shared_future<BakedTextureFilesPointer> future;
+        size_t size { 0 };
+        bool isFinished { false };
+        std::list<std::string>::iterator recentlyUsedPosition;
+    };
+
+    // Only finished entries are evicted, the bakers waiting on an unfinished one still get its result
+    void evict() {
+        while (_size > _maxSize && !_recentlyUsed.empty()) {
+            auto it = _entries.find(_recentlyUsed.front());
+            _recentlyUsed.pop_front();
+            if (it == _entries.end()) {
+                continue;
+            }
+            _size -= it->second.size;
+            _entries.erase(it);
+        }
+    }
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, Entry> _entries;
+    std::list<std::string> _recentlyUsed; // finished entries, least recently used first
+    size_t _size { 0 };
+    size_t _maxSize { 0 };
+};
+
+BakedTextureCache bakedTextureCache;
+
+}
+
+void TextureBaker::setBakeCacheSize(size_t maxSize) {
+    bakedTextureCache.setMaxSize(maxSize);
+}
+
 void TextureBaker::processTexture() {
     // the baked textures need to have the source hash added for cache checks in Interface
     // so we add that to the processed texture before handling it off to be serialized
@@ -140,6 +251,20 @@ void TextureBaker::processTexture() {
     auto hashData = hasher.result();
     std::string hash = hashData.toHex().toStdString();
 
+    bool isBakeOwner;
+    auto cachedFiles = bakedTextureCache.find(hash, isBakeOwner);
+    // collected as they're baked when this baker is the one the cache waits on
+    std::shared_ptr<BakedTextureFiles> bakedFiles;
+    if (isBakeOwner) {
+        bakedFiles = std::make_shared<BakedTextureFiles>();
+    }
+    bool bakeSucceeded = false;
+    Finally finishCachedBake([&] {
+        if (isBakeOwner) {
+            bakedTextureCache.finish(hash, bakeSucceeded ? bakedFiles : nullptr);
+        }
+    });
+
     TextureMeta meta;
 
     QString originalCopyFilePath = _originalCopyFilePath.toString();
@@ -157,6 +282,22 @@ void TextureBaker::processTexture() {
         meta.original = _originalCopyFilePath.fileName();
     }
 
+    // The same texture was baked for another asset, so its results only need to be written out under our name
+    if (cachedFiles) {
+        for (const auto& file : *cachedFiles) {
+            if (!writeBakedTexture(file.fileSuffix, file.data.constData(), file.data.size())) {
+                return;
+            }
+            if (file.isUncompressed) {
+                meta.uncompressed = _baseFilename + file.fileSuffix;
+            } else {
+                meta.availableTextureTypes[file.internalFormat] = _baseFilename + file.fileSuffix;
+            }
+        }
+        writeMetaTexture(meta);
+        return;
+    }
+
     // Load the copy of the original file from the baked output directory. New images will be created using the original as the source data.
     auto buffer = std::static_pointer_cast<QIODevice>(std::make_shared<QFile>(originalCopyFilePath));
     if (!buffer->open(QIODevice::ReadOnly)) {
@@ -199,15 +340,14 @@ void TextureBaker::processTexture() {
             const char* data = reinterpret_cast<const char*>(memKTX->_storage->data());
             const size_t length = memKTX->_storage->size();
 
-            auto fileName = _baseFilename + "_" + name + ".ktx";
-            auto filePath = _outputDirectory.absoluteFilePath(fileName);
-            QFile bakedTextureFile { filePath };
-            if (!bakedTextureFile.open(QIODevice::WriteOnly) || bakedTextureFile.write(data, length) == -1) {
-                handleError("Could not write baked texture for " + _textureURL.toString());
+            auto fileSuffix = QString("_") + name + ".ktx";
+            if (!writeBakedTexture(fileSuffix, data, length)) {
                 return;
             }
-            _outputFiles.push_back(filePath);
-            meta.availableTextureTypes[memKTX->_header.getGLInternaFormat()] = fileName;
+            meta.availableTextureTypes[memKTX->_header.getGLInternaFormat()] = _baseFilename + fileSuffix;
+            if (bakedFiles) {
+                bakedFiles->push_back({ false, memKTX->_header.getGLInternaFormat(), fileSuffix, QByteArray(data, (int)length) });
+            }
         }
     }
 
@@ -235,29 +375,41 @@ void TextureBaker::processTexture() {
         const char* data = reinterpret_cast<const char*>(memKTX->_storage->data());
         const size_t length = memKTX->_storage->size();
 
-        auto fileName = _baseFilename + ".ktx";
-        auto filePath = _outputDirectory.absoluteFilePath(fileName);
-        QFile bakedTextureFile { filePath };
-        if (!bakedTextureFile.open(QIODevice::WriteOnly) || bakedTextureFile.write(data, length) == -1) {
-            handleError("Could not write baked texture for " + _textureURL.toString());
+        if (!writeBakedTexture(BAKED_TEXTURE_KTX_EXT, data, length)) {
             return;
         }
-        _outputFiles.push_back(filePath);
-        meta.uncompressed = fileName;
+        meta.uncompressed = _baseFilename + BAKED_TEXTURE_KTX_EXT;
+        if (bakedFiles) {
+            bakedFiles->push_back({ true, memKTX->_header.getGLInternaFormat(), BAKED_TEXTURE_KTX_EXT, QByteArray(data, (int)length) });
+        }
     } else {
         buffer.reset();
     }
 
-    {
-        auto data = meta.serialize();
-        _metaTextureFileName = _outputDirectory.absoluteFilePath(_baseFilename + BAKED_META_TEXTURE_SUFFIX);
-        QFile file { _metaTextureFileName };
-        if (!file.open(QIODevice::WriteOnly) || file.write(data) == -1) {
-            handleError("Could not write meta texture for " + _textureURL.toString());
-            return;
-        } else {
-            _outputFiles.push_back(_metaTextureFileName);
-        }
+    bakeSucceeded = true;
+    writeMetaTexture(meta);
+}
+
+bool TextureBaker::writeBakedTexture(const QString& fileSuffix, const char* data, size_t length) {
+    auto filePath = _outputDirectory.absoluteFilePath(_baseFilename + fileSuffix);
+    QFile bakedTextureFile { filePath };
+    if (!bakedTextureFile.open(QIODevice::WriteOnly) || bakedTextureFile.write(data, length) == -1) {
+        handleError("Could not write baked texture for " + _textureURL.toString());
+        return false;
+    }
+    _outputFiles.push_back(filePath);
+    return true;
+}
+
+void TextureBaker::writeMetaTexture(TextureMeta& meta) {
+    auto data = meta.serialize();
+    _metaTextureFileName = _outputDirectory.absoluteFilePath(_baseFilename + BAKED_META_TEXTURE_SUFFIX);
+    QFile file { _metaTextureFileName };
+    if (!file.open(QIODevice::WriteOnly) || file.write(data) == -1) {
+        handleError("Could not write meta texture for " + _textureURL.toString());
+        return;
+    } else {
+        _outputFiles.push_back(_metaTextureFileName);
     }
 
     qCDebug(model_baking) << "Baked texture" << _textureURL;
@@ -24,6 +24,8 @@
 
 #include <graphics/Material.h>
 
+struct TextureMeta;
+
 extern const QString BAKED_TEXTURE_KTX_EXT;
 extern const QString BAKED_META_TEXTURE_SUFFIX;
 
@@ -47,6 +49,10 @@ public:
 
     static void setCompressionEnabled(bool enabled) { _compressionEnabled = enabled; }
 
+    /// Keeps up to maxSize bytes of baked textures around, so that a texture shared between assets baked by the same
+    /// process is only baked once.  Off (0) by default.
+    static void setBakeCacheSize(size_t maxSize);
+
     void setMapChannel(graphics::Material::MapChannel mapChannel) { _mapChannel = mapChannel; }
     graphics::Material::MapChannel getMapChannel() const { return _mapChannel; }
     image::TextureUsage::Type getTextureType() const { return _textureType; }
@@ -64,6 +70,8 @@ private slots:
 private:
     void loadTexture();
     void handleTextureNetworkReply();
+    bool writeBakedTexture(const QString& fileSuffix, const char* data, size_t length);
+    void writeMetaTexture(TextureMeta& meta);
 
     QUrl _textureURL;
     QByteArray _originalTexture;
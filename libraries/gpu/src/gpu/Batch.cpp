@@ -110,6 +110,29 @@ void Batch::clear() {
     _mustUpdatePreviousModels = true;
 }
 
+size_t Batch::getCapacityBytes() const {
+    size_t capacity = _commands.capacity() * sizeof(Commands::value_type) +
+        _commandOffsets.capacity() * sizeof(CommandOffsets::value_type) +
+        _params.capacity() * sizeof(Params::value_type) +
+        _data.capacity() +
+        _objects.capacity() * sizeof(TransformObjects::value_type) +
+        _drawCallInfos.capacity() * sizeof(DrawCallInfoBuffer::value_type);
+    capacity += _buffers.capacityBytes() +
+        _textures.capacityBytes() +
+        _textureTables.capacityBytes() +
+        _samplers.capacityBytes() +
+        _streamFormats.capacityBytes() +
+        _transforms.capacityBytes() +
+        _pipelines.capacityBytes() +
+        _framebuffers.capacityBytes() +
+        _swapChains.capacityBytes() +
+        _queries.capacityBytes() +
+        _lambdas.capacityBytes() +
+        _profileRanges.capacityBytes() +
+        _names.capacityBytes();
+    return capacity;
+}
+
 size_t Batch::cacheData(size_t size, const void* data) {
     size_t offset = _data.size();
     size_t numBytes = size;
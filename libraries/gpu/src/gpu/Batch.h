@@ -107,6 +107,10 @@ public:
     const std::string& getName() const { return _name; }
     void clear();
 
+    // The memory reserved for recording commands, kept across clear() so that a recycled batch can record without
+    // allocating
+    size_t getCapacityBytes() const;
+
     // Batches may need to override the context level stereo settings
     // if they're performing framebuffer copy operations, like the
     // deferred lighting resolution mechanism
@@ -446,6 +450,7 @@ public:
 
 
             size_t size() const { return _items.size(); }
+            size_t capacityBytes() const { return _items.capacity() * sizeof(Cache<T>); }
             size_t cache(const Data& data) {
                 size_t offset = _items.size();
                 _items.emplace_back(data);
@@ -556,6 +561,9 @@ public:
 protected:
     std::string _name;
 
+    // The capacity when the batch was last returned to the Context's pool, to detect pooled batches that had to grow
+    size_t _pooledCapacity { 0 };
+
     friend class Context;
     friend class Frame;
 
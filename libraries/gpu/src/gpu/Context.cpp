@@ -102,6 +102,9 @@ FramePointer Context::endFrame() {
 
     result->stereoState = _stereo;
     result->finish();
+
+    _frameBatchAllocations = _batchAllocations.exchange(0);
+    _frameBatchGrowths = _batchGrowths.exchange(0);
     return result;
 }
 
@@ -327,39 +330,120 @@ void Context::processProgramsToSync() {
 }
 
 std::mutex Context::_batchPoolMutex;
-std::list<Batch*> Context::_batchPool;
+std::vector<Batch*> Context::_batchPool;
+std::atomic<uint32_t> Context::_batchAllocations { 0 };
+std::atomic<uint32_t> Context::_batchGrowths { 0 };
+std::atomic<uint32_t> Context::_frameBatchAllocations { 0 };
+std::atomic<uint32_t> Context::_frameBatchGrowths { 0 };
+
+// The shared_ptr control blocks of the pooled batches are all the same size, so recycle them as well
+// rather than allocating a new one every time a batch is acquired
+static std::mutex batchControlBlockMutex;
+static std::vector<void*> batchControlBlocks;
+static size_t batchControlBlockSize { 0 };
+
+template <typename T>
+class BatchControlBlockAllocator {
+public:
+    using value_type = T;
+
+    BatchControlBlockAllocator() = default;
+    template <typename U>
+    BatchControlBlockAllocator(const BatchControlBlockAllocator<U>& other) {}
+
+    T* allocate(size_t n) {
+        size_t size = n * sizeof(T);
+        {
+            Lock lock(batchControlBlockMutex);
+            if (size == batchControlBlockSize && !batchControlBlocks.empty()) {
+                void* block = batchControlBlocks.back();
+                batchControlBlocks.pop_back();
+                return static_cast<T*>(block);
+            }
+        }
+        return static_cast<T*>(::operator new(size));
+    }
+
+    void deallocate(T* block, size_t n) {
+        size_t size = n * sizeof(T);
+        Lock lock(batchControlBlockMutex);
+        if (batchControlBlockSize == 0) {
+            batchControlBlockSize = size;
+        }
+        if (size == batchControlBlockSize) {
+            batchControlBlocks.push_back(block);
+        } else {
+            ::operator delete(block);
+        }
+    }
+
+    template <typename U>
+    bool operator==(const BatchControlBlockAllocator<U>& other) const { return true; }
+    template <typename U>
+    bool operator!=(const BatchControlBlockAllocator<U>& other) const { return false; }
+};
 
 void Context::clearBatches() {
-    for (auto batch : _batchPool) {
-        delete batch;
+    {
+        Lock lock(_batchPoolMutex);
+        for (auto batch : _batchPool) {
+            delete batch;
+        }
+        _batchPool.clear();
+    }
+    Lock lock(batchControlBlockMutex);
+    for (auto block : batchControlBlocks) {
+        ::operator delete(block);
     }
-    _batchPool.clear();
+    batchControlBlocks.clear();
 }
 
 BatchPointer Context::acquireBatch(const char* name) {
     Batch* rawBatch = nullptr;
     {
         Lock lock(_batchPoolMutex);
+        // Most recently released first, its storage is the most likely to still be in cache
         if (!_batchPool.empty()) {
-            rawBatch = _batchPool.front();
-            _batchPool.pop_front();
+            rawBatch = _batchPool.back();
+            _batchPool.pop_back();
         }
     }
     if (!rawBatch) {
+        // New batches reserve the high water marks of all the batches recorded so far
         rawBatch = new Batch();
+        rawBatch->_pooledCapacity = rawBatch->getCapacityBytes();
+        ++_batchAllocations;
     }
     if (name) {
         rawBatch->setName(name);
     }
-    return BatchPointer(rawBatch, [](Batch* batch) { releaseBatch(batch); });
+    return BatchPointer(rawBatch, [](Batch* batch) { releaseBatch(batch); }, BatchControlBlockAllocator<Batch>());
 }
 
 void Context::releaseBatch(Batch* batch) {
     batch->clear();
+    size_t capacity = batch->getCapacityBytes();
+    if (capacity > batch->_pooledCapacity) {
+        batch->_pooledCapacity = capacity;
+        ++_batchGrowths;
+    }
     Lock lock(_batchPoolMutex);
     _batchPool.push_back(batch);
 }
 
+uint32_t Context::getFrameBatchAllocations() {
+    return _frameBatchAllocations.load();
+}
+
+uint32_t Context::getFrameBatchGrowths() {
+    return _frameBatchGrowths.load();
+}
+
+size_t Context::getNumPooledBatches() {
+    Lock lock(_batchPoolMutex);
+    return _batchPool.size();
+}
+
 void gpu::doInBatch(const char* name,
                     const std::shared_ptr<gpu::Context>& context,
                     const std::function<void(Batch& batch)>& f) {
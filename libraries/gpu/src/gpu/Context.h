@@ -13,8 +13,10 @@
 #define hifi_gpu_Context_h
 
 #include <assert.h>
+#include <atomic>
 #include <mutex>
 #include <queue>
+#include <vector>
 
 #include "Texture.h"
 #include "Pipeline.h"
@@ -48,9 +50,16 @@ public:
     void appendFrameBatch(const BatchPointer& batch);
     FramePointer endFrame();
 
+    // Batches are recycled through a pool: once it has warmed up, acquiring a batch and recording into it allocates nothing
     static BatchPointer acquireBatch(const char* name = nullptr);
     static void releaseBatch(Batch* batch);
 
+    // Batch pool counters over the last frame ended: the batches that had to be created, and the pooled batches that
+    // had to grow their storage while recording
+    static uint32_t getFrameBatchAllocations();
+    static uint32_t getFrameBatchGrowths();
+    static size_t getNumPooledBatches();
+
     // MUST only be called on the rendering thread
     //
     // Handle any pending operations to clean up (recycle / deallocate) resources no longer in use
@@ -177,7 +186,11 @@ protected:
     // Should probably move this functionality to Batch
     static void clearBatches();
     static std::mutex _batchPoolMutex;
-    static std::list<Batch*> _batchPool;
+    static std::vector<Batch*> _batchPool;
+    static std::atomic<uint32_t> _batchAllocations;
+    static std::atomic<uint32_t> _batchGrowths;
+    static std::atomic<uint32_t> _frameBatchAllocations;
+    static std::atomic<uint32_t> _frameBatchGrowths;
 
     friend class Shader;
     friend class Backend;
@@ -148,6 +148,10 @@ namespace gpu {
         class GLESBackend;
         class GLESBuffer;
     }
+
+    namespace null {
+        class Backend;
+    }
 }
 
 #endif
@@ -215,8 +215,13 @@ KtxStorage::KtxStorage(const cache::FilePointer& cacheEntry) : KtxStorage(cacheE
 
 KtxStorage::KtxStorage(const std::string& filename) : _filename(filename) {
     {
-        // We are doing a lot of work here just to get descriptor data
-        ktx::StoragePointer storage{ new storage::FileStorage(_filename.c_str()) };
+        // We are doing a lot of work here just to get descriptor data.  Only the header and the image size fields
+        // are touched, so this pages in a few pages of the file, and the mapping is reused by the first mip reads.
+        ktx::StoragePointer storage;
+        {
+            std::lock_guard<std::mutex> lock(*_cacheFileMutex);
+            storage = maybeOpenFile();
+        }
         auto ktxPointer = ktx::KTX::create(storage);
         _ktxDescriptor.reset(new ktx::KTXDescriptor(ktxPointer->toDescriptor()));
         if (_ktxDescriptor->images.size() < _ktxDescriptor->header.numberOfMipmapLevels) {
@@ -252,6 +257,9 @@ std::shared_ptr<storage::FileStorage> KtxStorage::maybeOpenFile() const {
 
     // If the file isn't open, create it and save a weak_ptr to it
     file = std::make_shared<storage::FileStorage>(_filename.c_str());
+    // Mips are read one at a time as the residency manager asks for them, so read-ahead would only page in mips
+    // that may never be needed
+    file->adviseRandomAccess();
     _cacheFile = file;
 
     {
@@ -283,9 +291,16 @@ PixelsPointer KtxStorage::getMipFace(uint16 level, uint8 face) const {
         if (_storage) {
             storageView = _storage->createView(faceSize, faceOffset);
         } else {
-            std::lock_guard<std::mutex> lock(*_cacheFileMutex);
-            auto file = maybeOpenFile();
+            std::shared_ptr<storage::FileStorage> file;
+            {
+                std::lock_guard<std::mutex> lock(*_cacheFileMutex);
+                file = maybeOpenFile();
+            }
             if (file) {
+                // The view is a zero-copy slice of the mapping, which it keeps alive for as long as the mip is in use.
+                // Callers access mips from a buffering thread, so the pages are brought in here rather than on the
+                // first read, which may happen on the render thread.
+                file->pageIn(faceOffset, faceSize);
                 storageView = file->createView(faceSize, faceOffset);
             } else {
                 qWarning() << "Failed to get a valid file out of maybeOpenFile " << QString::fromStdString(_filename);
@@ -296,7 +311,7 @@ PixelsPointer KtxStorage::getMipFace(uint16 level, uint8 face) const {
         qWarning() << "Failed to get a valid storageView for faceSize=" << faceSize << "  faceOffset=" << faceOffset
                     << "out of valid file " << QString::fromStdString(_filename);
     }
-    return storageView->toMemoryStorage();
+    return storageView;
 }
 
 Size KtxStorage::getMipFaceSize(uint16 level, uint8 face) const {
@@ -0,0 +1,348 @@
+//
+//  NullBackend.cpp
+//  libraries/gpu/src/gpu/null
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "NullBackend.h"
+
+#include <chrono>
+#include <cstring>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include "../FrameIOKeys.h"
+
+using namespace gpu;
+using namespace gpu::null;
+
+Backend::AllocationCounter Backend::_allocationCounter = nullptr;
+
+Backend::CommandCall Backend::_commandCalls[Batch::NUM_COMMANDS] =
+{
+    (&::gpu::null::Backend::do_draw),
+    (&::gpu::null::Backend::do_drawIndexed),
+    (&::gpu::null::Backend::do_drawInstanced),
+    (&::gpu::null::Backend::do_drawIndexedInstanced),
+    (&::gpu::null::Backend::do_multiDrawIndirect),
+    (&::gpu::null::Backend::do_multiDrawIndirect),
+
+    (&::gpu::null::Backend::do_setInputFormat),
+    (&::gpu::null::Backend::do_setInputBuffer),
+    (&::gpu::null::Backend::do_setIndexBuffer),
+    (&::gpu::null::Backend::do_nothing), // setIndirectBuffer
+
+    (&::gpu::null::Backend::do_nothing), // setModelTransform
+    (&::gpu::null::Backend::do_setViewTransform),
+    (&::gpu::null::Backend::do_setProjectionTransform),
+    (&::gpu::null::Backend::do_nothing), // setProjectionJitterEnabled
+    (&::gpu::null::Backend::do_nothing), // setProjectionJitterSequence
+    (&::gpu::null::Backend::do_nothing), // setProjectionJitterScale
+    (&::gpu::null::Backend::do_setViewportTransform),
+    (&::gpu::null::Backend::do_nothing), // setDepthRangeTransform
+
+    (&::gpu::null::Backend::do_nothing), // saveViewProjectionTransform
+    (&::gpu::null::Backend::do_nothing), // setSavedViewProjectionTransform
+    (&::gpu::null::Backend::do_nothing), // copySavedViewProjectionTransformToBuffer
+
+    (&::gpu::null::Backend::do_setPipeline),
+    (&::gpu::null::Backend::do_nothing), // setStateBlendFactor
+    (&::gpu::null::Backend::do_nothing), // setStateScissorRect
+
+    (&::gpu::null::Backend::do_setUniformBuffer),
+    (&::gpu::null::Backend::do_setResourceBuffer),
+    (&::gpu::null::Backend::do_setResourceTexture),
+    (&::gpu::null::Backend::do_nothing), // setResourceTextureTable
+    (&::gpu::null::Backend::do_nothing), // setResourceFramebufferSwapChainTexture
+
+    (&::gpu::null::Backend::do_setFramebuffer),
+    (&::gpu::null::Backend::do_nothing), // setFramebufferSwapChain
+    (&::gpu::null::Backend::do_nothing), // clearFramebuffer
+    (&::gpu::null::Backend::do_nothing), // blit
+    (&::gpu::null::Backend::do_nothing), // generateTextureMips
+    (&::gpu::null::Backend::do_nothing), // generateTextureMipsWithPipeline
+
+    (&::gpu::null::Backend::do_nothing), // advance
+
+    (&::gpu::null::Backend::do_nothing), // beginQuery
+    (&::gpu::null::Backend::do_nothing), // endQuery
+    (&::gpu::null::Backend::do_getQuery),
+
+    (&::gpu::null::Backend::do_resetStages),
+
+    (&::gpu::null::Backend::do_nothing), // disableContextViewCorrection
+    (&::gpu::null::Backend::do_nothing), // restoreContextViewCorrection
+    (&::gpu::null::Backend::do_nothing), // setContextMirrorViewCorrection
+    (&::gpu::null::Backend::do_disableContextStereo),
+    (&::gpu::null::Backend::do_restoreContextStereo),
+
+    (&::gpu::null::Backend::do_runLambda),
+
+    (&::gpu::null::Backend::do_nothing), // startNamedCall
+    (&::gpu::null::Backend::do_nothing), // stopNamedCall
+
+    (&::gpu::null::Backend::do_nothing), // glUniform1i
+    (&::gpu::null::Backend::do_nothing), // glUniform1f
+    (&::gpu::null::Backend::do_nothing), // glUniform2f
+    (&::gpu::null::Backend::do_nothing), // glUniform3f
+    (&::gpu::null::Backend::do_nothing), // glUniform4f
+    (&::gpu::null::Backend::do_nothing), // glUniform3fv
+    (&::gpu::null::Backend::do_nothing), // glUniform4fv
+    (&::gpu::null::Backend::do_nothing), // glUniform4iv
+    (&::gpu::null::Backend::do_nothing), // glUniformMatrix3fv
+    (&::gpu::null::Backend::do_nothing), // glUniformMatrix4fv
+
+    (&::gpu::null::Backend::do_nothing), // pushProfileRange
+    (&::gpu::null::Backend::do_nothing), // popProfileRange
+};
+
+const char* Backend::getCommandName(Batch::Command command) {
+    return keys::COMMAND_NAMES[command];
+}
+
+const std::string& Backend::getVersion() const {
+    static const std::string VERSION { "null" };
+    return VERSION;
+}
+
+void Backend::render(const Batch& batch) {
+    _stereo._skybox = batch.isSkyboxEnabled();
+    bool savedStereo = _stereo._enable;
+    if (!batch.isStereoEnabled()) {
+        _stereo._enable = false;
+    }
+    _cameras.clear();
+
+    syncBuffers(batch);
+
+    using Clock = std::chrono::steady_clock;
+    const size_t numCommands = batch.getCommands().size();
+    const Batch::Commands::value_type* command = batch.getCommands().data();
+    const Batch::CommandOffsets::value_type* offset = batch.getCommandOffsets().data();
+    for (size_t commandIndex = 0; commandIndex < numCommands; ++commandIndex) {
+        uint64_t allocationsBefore = _allocationCounter ? _allocationCounter() : 0;
+        auto start = Clock::now();
+
+        CommandCall call = _commandCalls[(*command)];
+        (this->*(call))(batch, *offset);
+
+        auto end = Clock::now();
+        CommandStats& stats = _commandStats[(*command)];
+        ++stats.count;
+        stats.nsecs += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        if (_allocationCounter) {
+            stats.allocations += _allocationCounter() - allocationsBefore;
+        }
+        command++;
+        offset++;
+    }
+
+    _stereo._enable = savedStereo;
+
+    if (batch._mustUpdatePreviousModels) {
+        // Update object transform history for when the batch will be reexecuted
+        for (auto& objectTransform : batch._objects) {
+            objectTransform._previousModel = objectTransform._model;
+        }
+        batch._mustUpdatePreviousModels = false;
+    }
+}
+
+void Backend::syncBuffers(const Batch& batch) {
+    // Walk the dirty pages exactly like a GL buffer transfer would, minus the upload
+    for (auto& cached : batch._buffers._items) {
+        if (!cached._data) {
+            continue;
+        }
+        const Buffer& buffer = *cached._data;
+        if (0 != (buffer._renderPages._flags & PageManager::DIRTY)) {
+            Size offset;
+            Size size;
+            Size currentPage { 0 };
+            while (buffer._renderPages.getNextTransferBlock(offset, size, currentPage)) {
+            }
+            buffer._renderPages._flags &= ~PageManager::DIRTY;
+        }
+    }
+}
+
+void Backend::updateTransform() {
+    if (_invalidViewport) {
+        _camera._viewport = glm::vec4(_viewport);
+    }
+    if (_invalidProj) {
+        _camera._projection = _projection;
+    }
+    Transform correctedView = _view;
+    if (_invalidView) {
+        if (_viewCorrection != Mat4()) {
+            Transform::mult(correctedView, _view, Transform(glm::inverse(_viewCorrection)));
+        }
+        if (_stereo._skybox) {
+            correctedView.setTranslation(vec3());
+        }
+        correctedView.getInverseMatrix(_camera._view);
+    }
+    if (_invalidView || _invalidProj || _invalidViewport) {
+        if (_stereo.isStereo()) {
+            _cameras.push_back(_camera.getEyeCamera(0, _stereo, _prevStereo, correctedView, _previousView, Vec2(0.0f)));
+            _cameras.push_back(_camera.getEyeCamera(1, _stereo, _prevStereo, correctedView, _previousView, Vec2(0.0f)));
+        } else {
+            _cameras.push_back(_camera.getMonoCamera(_stereo._skybox, correctedView, _previousView, _previousProjection, Vec2(0.0f)));
+        }
+    }
+    _invalidView = _invalidProj = _invalidViewport = false;
+}
+
+void Backend::do_draw(const Batch& batch, size_t paramOffset) {
+    updateTransform();
+    uint32 numVertices = batch._params[paramOffset + 1]._uint;
+    uint32 numDraws = _stereo.isStereo() ? 2 : 1;
+    _stats._DSNumTriangles += numDraws * numVertices / 3;
+    _stats._DSNumDrawcalls += numDraws;
+    _stats._DSNumAPIDrawcalls++;
+}
+
+void Backend::do_drawIndexed(const Batch& batch, size_t paramOffset) {
+    do_draw(batch, paramOffset);
+}
+
+void Backend::do_drawInstanced(const Batch& batch, size_t paramOffset) {
+    updateTransform();
+    uint32 numVertices = batch._params[paramOffset + 2]._uint;
+    uint32 numInstances = batch._params[paramOffset + 4]._uint;
+    uint32 numDraws = (_stereo.isStereo() ? 2 : 1) * numInstances;
+    _stats._DSNumTriangles += numDraws * numVertices / 3;
+    _stats._DSNumDrawcalls += numDraws;
+    _stats._DSNumAPIDrawcalls++;
+}
+
+void Backend::do_drawIndexedInstanced(const Batch& batch, size_t paramOffset) {
+    do_drawInstanced(batch, paramOffset);
+}
+
+void Backend::do_multiDrawIndirect(const Batch& batch, size_t paramOffset) {
+    updateTransform();
+    uint32 numCommands = batch._params[paramOffset + 0]._uint;
+    _stats._DSNumDrawcalls += numCommands;
+    _stats._DSNumAPIDrawcalls++;
+}
+
+void Backend::do_setInputFormat(const Batch& batch, size_t paramOffset) {
+    const Stream::FormatPointer& format = batch._streamFormats.get(batch._params[paramOffset]._uint);
+    if (format != _inputFormat) {
+        _inputFormat = format;
+        _stats._ISNumFormatChanges++;
+    }
+}
+
+void Backend::do_setInputBuffer(const Batch& batch, size_t paramOffset) {
+    uint32 channel = batch._params[paramOffset + 3]._uint;
+    if (channel < (uint32)MAX_NUM_INPUT_BUFFERS) {
+        const BufferPointer& buffer = batch._buffers.get(batch._params[paramOffset + 2]._uint);
+        if (buffer != _inputBuffers[channel]) {
+            _inputBuffers[channel] = buffer;
+            _stats._ISNumInputBufferChanges++;
+        }
+    }
+}
+
+void Backend::do_setIndexBuffer(const Batch& batch, size_t paramOffset) {
+    const BufferPointer& buffer = batch._buffers.get(batch._params[paramOffset + 1]._uint);
+    if (buffer != _indexBuffer) {
+        _indexBuffer = buffer;
+        _stats._ISNumIndexBufferChanges++;
+    }
+}
+
+void Backend::do_setViewTransform(const Batch& batch, size_t paramOffset) {
+    _view = batch._transforms.get(batch._params[paramOffset]._uint);
+    _previousView = _view;
+    _previousProjection = _projection;
+    _invalidView = true;
+}
+
+void Backend::do_setProjectionTransform(const Batch& batch, size_t paramOffset) {
+    memcpy(glm::value_ptr(_projection), batch.readData(batch._params[paramOffset]._uint), sizeof(Mat4));
+    _invalidProj = true;
+}
+
+void Backend::do_setViewportTransform(const Batch& batch, size_t paramOffset) {
+    memcpy(glm::value_ptr(_viewport), batch.readData(batch._params[paramOffset]._uint), sizeof(Vec4i));
+    _invalidViewport = true;
+}
+
+void Backend::do_setPipeline(const Batch& batch, size_t paramOffset) {
+    const PipelinePointer& pipeline = batch._pipelines.get(batch._params[paramOffset]._uint);
+    if (pipeline != _pipeline) {
+        _pipeline = pipeline;
+        _stats._PSNumSetPipelines++;
+    }
+}
+
+void Backend::do_setUniformBuffer(const Batch& batch, size_t paramOffset) {
+    uint32 slot = batch._params[paramOffset + 3]._uint;
+    if (slot < (uint32)MAX_NUM_UNIFORM_BUFFERS) {
+        _uniformBuffers[slot] = batch._buffers.get(batch._params[paramOffset + 2]._uint);
+    }
+}
+
+void Backend::do_setResourceBuffer(const Batch& batch, size_t paramOffset) {
+    uint32 slot = batch._params[paramOffset + 1]._uint;
+    if (slot < (uint32)MAX_NUM_RESOURCE_BUFFERS) {
+        _resourceBuffers[slot] = batch._buffers.get(batch._params[paramOffset + 0]._uint);
+        _stats._RSNumResourceBufferBounded++;
+    }
+}
+
+void Backend::do_setResourceTexture(const Batch& batch, size_t paramOffset) {
+    uint32 slot = batch._params[paramOffset + 1]._uint;
+    if (slot < (uint32)MAX_NUM_RESOURCE_TEXTURES) {
+        const TexturePointer& texture = batch._textures.get(batch._params[paramOffset + 0]._uint);
+        _resourceTextures[slot] = texture;
+        if (texture) {
+            _stats._RSNumTextureBounded++;
+            _stats._RSAmountTextureMemoryBounded += (uint64_t)texture->getSize();
+        }
+    }
+}
+
+void Backend::do_setFramebuffer(const Batch& batch, size_t paramOffset) {
+    _framebuffer = batch._framebuffers.get(batch._params[paramOffset]._uint);
+}
+
+void Backend::do_getQuery(const Batch& batch, size_t paramOffset) {
+    const QueryPointer& query = batch._queries.get(batch._params[paramOffset]._uint);
+    if (query) {
+        query->triggerReturnHandler(0, 0);
+    }
+}
+
+void Backend::do_resetStages(const Batch& batch, size_t paramOffset) {
+    _inputFormat.reset();
+    _inputBuffers.fill(nullptr);
+    _indexBuffer.reset();
+    _pipeline.reset();
+    _uniformBuffers.fill(nullptr);
+    _resourceBuffers.fill(nullptr);
+    _resourceTextures.fill(nullptr);
+    _framebuffer.reset();
+}
+
+void Backend::do_disableContextStereo(const Batch& batch, size_t paramOffset) {
+    _stereo._contextDisable = true;
+}
+
+void Backend::do_restoreContextStereo(const Batch& batch, size_t paramOffset) {
+    _stereo._contextDisable = false;
+}
+
+void Backend::do_runLambda(const Batch& batch, size_t paramOffset) {
+    std::function<void()> f = batch._lambdas.get(batch._params[paramOffset]._uint);
+    f();
+}
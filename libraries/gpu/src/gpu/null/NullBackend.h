@@ -1,6 +1,7 @@
 //
 //  Created by Bradley Austin Davis on 2016/05/16
 //  Copyright 2014 High Fidelity, Inc.
+//  Copyright 2026 Overte e.V.
 //
 //  Distributed under the Apache License, Version 2.0.
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
@@ -8,26 +9,23 @@
 #ifndef hifi_gpu_Null_Backend_h
 #define hifi_gpu_Null_Backend_h
 
-#include <assert.h>
-#include <functional>
-#include <bitset>
-#include <queue>
-#include <utility>
-#include <list>
 #include <array>
-
-#include <QtCore/QLoggingCategory>
+#include <vector>
 
 #include "../Context.h"
 
 namespace gpu { namespace null {
 
+// The null backend executes batches the way a real backend does, tracking the pipeline, resource and transform state and
+// syncing the buffers, but never talks to a driver.  It's meant for measuring the CPU side cost of the command stream on
+// machines without a GPU, so it also times every command and (if an allocation counter is installed) counts the heap
+// allocations made while executing it.
 class Backend : public gpu::Backend {
     using Parent = gpu::Backend;
     // Context Backend static interface required
     friend class gpu::Context;
     static void init() {}
-    static gpu::Backend* createBackend() { return new Backend(); }
+    static BackendPointer createBackend() { return BackendPointer(new Backend()); }
 
 protected:
     explicit Backend(bool syncCache) : Parent() { }
@@ -35,7 +33,26 @@ protected:
 public:
     ~Backend() { }
 
-    void render(const Batch& batch) final { }
+    // The per command type cost accumulated since the last resetCommandStats()
+    class CommandStats {
+    public:
+        uint64_t count { 0 };
+        uint64_t nsecs { 0 };
+        uint64_t allocations { 0 };
+    };
+    using CommandStatsArray = std::array<CommandStats, Batch::NUM_COMMANDS>;
+
+    // Returns the running total of heap allocations made by the process
+    using AllocationCounter = uint64_t (*)();
+    static void setAllocationCounter(AllocationCounter counter) { _allocationCounter = counter; }
+
+    static const char* getCommandName(Batch::Command command);
+    const CommandStatsArray& getCommandStats() const { return _commandStats; }
+    void resetCommandStats() { _commandStats = CommandStatsArray(); }
+
+    const std::string& getVersion() const final;
+
+    void render(const Batch& batch) final;
 
     // This call synchronize the Full Backend cache with the current GLState
     // THis is only intended to be used when mixing raw gl calls with the gpu api usage in order to sync
@@ -45,9 +62,83 @@ public:
 
     void syncProgram(const gpu::ShaderPointer& program) final {}
 
+    void recycle() const final {}
+
     // This is the ugly "download the pixels to sysmem for taking a snapshot"
     // Just avoid using it, it's ugly and will break performances
     virtual void downloadFramebuffer(const FramebufferPointer& srcFramebuffer, const Vec4i& region, QImage& destImage) final { }
+
+    void updatePresentFrame(const Mat4& correction = Mat4(), bool primary = true) final { _viewCorrection = correction; }
+
+    bool supportedTextureFormat(const gpu::Element& format) final { return true; }
+
+    bool isTextureManagementSparseEnabled() const final { return false; }
+
+    // Same limits as the GL backend
+    static const int MAX_NUM_INPUT_BUFFERS = Stream::NUM_INPUT_SLOTS;
+    static const int MAX_NUM_UNIFORM_BUFFERS = 14;
+    static const int MAX_NUM_RESOURCE_BUFFERS = 16;
+    static const int MAX_NUM_RESOURCE_TEXTURES = 16;
+
+protected:
+    typedef void (Backend::*CommandCall)(const Batch&, size_t);
+    static CommandCall _commandCalls[Batch::NUM_COMMANDS];
+    static AllocationCounter _allocationCounter;
+
+    void syncBuffers(const Batch& batch);
+    void updateTransform();
+
+    void do_draw(const Batch& batch, size_t paramOffset);
+    void do_drawIndexed(const Batch& batch, size_t paramOffset);
+    void do_drawInstanced(const Batch& batch, size_t paramOffset);
+    void do_drawIndexedInstanced(const Batch& batch, size_t paramOffset);
+    void do_multiDrawIndirect(const Batch& batch, size_t paramOffset);
+
+    void do_setInputFormat(const Batch& batch, size_t paramOffset);
+    void do_setInputBuffer(const Batch& batch, size_t paramOffset);
+    void do_setIndexBuffer(const Batch& batch, size_t paramOffset);
+
+    void do_setViewTransform(const Batch& batch, size_t paramOffset);
+    void do_setProjectionTransform(const Batch& batch, size_t paramOffset);
+    void do_setViewportTransform(const Batch& batch, size_t paramOffset);
+
+    void do_setPipeline(const Batch& batch, size_t paramOffset);
+    void do_setUniformBuffer(const Batch& batch, size_t paramOffset);
+    void do_setResourceBuffer(const Batch& batch, size_t paramOffset);
+    void do_setResourceTexture(const Batch& batch, size_t paramOffset);
+    void do_setFramebuffer(const Batch& batch, size_t paramOffset);
+
+    void do_getQuery(const Batch& batch, size_t paramOffset);
+    void do_resetStages(const Batch& batch, size_t paramOffset);
+    void do_disableContextStereo(const Batch& batch, size_t paramOffset);
+    void do_restoreContextStereo(const Batch& batch, size_t paramOffset);
+    void do_runLambda(const Batch& batch, size_t paramOffset);
+
+    void do_nothing(const Batch& batch, size_t paramOffset) {}
+
+    CommandStatsArray _commandStats;
+
+    // Holding the resources like a real backend does keeps the cost of the reference counting in the measurement
+    Stream::FormatPointer _inputFormat;
+    std::array<BufferPointer, MAX_NUM_INPUT_BUFFERS> _inputBuffers;
+    BufferPointer _indexBuffer;
+    PipelinePointer _pipeline;
+    std::array<BufferPointer, MAX_NUM_UNIFORM_BUFFERS> _uniformBuffers;
+    std::array<BufferPointer, MAX_NUM_RESOURCE_BUFFERS> _resourceBuffers;
+    std::array<TexturePointer, MAX_NUM_RESOURCE_TEXTURES> _resourceTextures;
+    FramebufferPointer _framebuffer;
+
+    Transform _view;
+    Transform _previousView;
+    Mat4 _projection;
+    Mat4 _previousProjection;
+    Mat4 _viewCorrection;
+    Vec4i _viewport;
+    bool _invalidView { true };
+    bool _invalidProj { true };
+    bool _invalidViewport { true };
+    TransformCamera _camera;
+    std::vector<TransformCamera> _cameras;
 };
 
 } }
@@ -504,8 +504,16 @@ glm::vec4 CubeMap::fetchLod(const glm::vec3& dir, float lod) const {
 }
 
 struct CubeMap::GGXSamples {
+    // The mips a sample's LOD falls between, resolved once per table instead of for every pixel
+    struct Lod {
+        gpu::uint16 loLevel;
+        gpu::uint16 hiLevel;
+        float frac;
+    };
+
     float invTotalWeight;
     std::vector<glm::vec4> points;
+    std::vector<Lod> lods;
 };
 
 // All the GGX convolution code is inspired from:
@@ -567,16 +575,30 @@ void CubeMap::generateGGXSamples(GGXSamples& data, float roughness, const int re
     data.invTotalWeight = 1.0f / data.invTotalWeight;
 }
 
+void CubeMap::generateGGXSampleLods(GGXSamples& data) const {
+    const float maxLod = (float)(_mips.size() - 1);
+
+    data.lods.resize(data.points.size());
+    for (size_t i = 0; i < data.points.size(); ++i) {
+        const float lod = glm::clamp(data.points[i].w, 0.0f, maxLod);
+        auto& sampleLod = data.lods[i];
+        sampleLod.loLevel = (gpu::uint16)std::floor(lod);
+        sampleLod.hiLevel = (gpu::uint16)std::ceil(lod);
+        sampleLod.frac = lod - (float)sampleLod.loLevel;
+    }
+}
+
 void CubeMap::convolveForGGX(CubeMap& output, const std::atomic<bool>& abortProcessing) const {
     // This should match the value in the getMipLevelFromRoughness function (LightAmbient.slh)
     static const float ROUGHNESS_1_MIP_RESOLUTION = 1.5f;
     static const size_t MAX_SAMPLE_COUNT = 4000;
+    static const int ROWS_PER_TASK = 8;
 
     const auto mipCount = getMipCount();
-    GGXSamples params;
-
-    params.points.reserve(MAX_SAMPLE_COUNT);
+    std::vector<GGXSamples> mipSamples(mipCount);
 
+    // The sample tables are generated up front, and serially as they draw on rand(), so that every mip can then
+    // be convolved at the same time
     for (gpu::uint16 mipLevel = 0; mipLevel < mipCount; ++mipLevel) {
         // This is the inverse code found in LightAmbient.slh in getMipLevelFromRoughness
         float levelAlpha = float(mipLevel) / (mipCount - ROUGHNESS_1_MIP_RESOLUTION);
@@ -591,19 +613,46 @@ void CubeMap::convolveForGGX(CubeMap& output, const std::atomic<bool>& abortProc
         sampleCount = std::min(sampleCount, 2 * mipTotalPixelCount);
         sampleCount = std::min(MAX_SAMPLE_COUNT, sampleCount);
 
+        auto& params = mipSamples[mipLevel];
         params.points.resize(sampleCount);
         generateGGXSamples(params, mipRoughness, _width);
+        generateGGXSampleLods(params);
+    }
 
+    ConstMips mips;
+    mips.reserve(mipCount);
+    for (gpu::uint16 mipLevel = 0; mipLevel < mipCount; ++mipLevel) {
+        mips.emplace_back(mipLevel, this);
+    }
+
+    // Split every face of every mip into bands of rows.  The cost of a band is its pixel count times its mip's
+    // sample count, which varies a lot from mip to mip, so the bands are kept small and left to TBB to balance.
+    struct Task {
+        gpu::uint16 mipLevel;
+        int face;
+        int beginRow;
+        int endRow;
+    };
+    std::vector<Task> tasks;
+    for (gpu::uint16 mipLevel = 0; mipLevel < mipCount; ++mipLevel) {
+        const int mipHeight = output.getMipHeight(mipLevel);
         for (int face = 0; face < 6; face++) {
-            convolveMipFaceForGGX(params, output, mipLevel, face, abortProcessing);
-            if (abortProcessing.load()) {
-                return;
+            for (int row = 0; row < mipHeight; row += ROWS_PER_TASK) {
+                tasks.push_back({ mipLevel, face, row, std::min(row + ROWS_PER_TASK, mipHeight) });
             }
         }
     }
+
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, tasks.size(), 1), [&](const tbb::blocked_range<size_t>& range) {
+        for (auto i = range.begin(); i < range.end() && !abortProcessing.load(); i++) {
+            const auto& task = tasks[i];
+            convolveMipFaceRowsForGGX(mipSamples[task.mipLevel], mips, output, task.mipLevel, task.face, task.beginRow, task.endRow, abortProcessing);
+        }
+    });
 }
 
-void CubeMap::convolveMipFaceForGGX(const GGXSamples& samples, CubeMap& output, gpu::uint16 mipLevel, int face, const std::atomic<bool>& abortProcessing) const {
+void CubeMap::convolveMipFaceRowsForGGX(const GGXSamples& samples, const ConstMips& mips, CubeMap& output, gpu::uint16 mipLevel, int face,
+                                        int beginRow, int endRow, const std::atomic<bool>& abortProcessing) const {
     const glm::vec3* faceNormals = FACE_NORMALS + face * 4;
     const glm::vec3 deltaYNormalLo = faceNormals[2] - faceNormals[0];
     const glm::vec3 deltaYNormalHi = faceNormals[3] - faceNormals[1];
@@ -611,50 +660,55 @@ void CubeMap::convolveMipFaceForGGX(const GGXSamples& samples, CubeMap& output,
     const auto outputLineStride = output.getMipLineStride(mipLevel);
     auto outputFacePixels = output.editFace(mipLevel, face);
 
-    tbb::parallel_for(tbb::blocked_range2d<int, int>(0, mipDimensions.y, 32, 0, mipDimensions.x, 32), [&](const tbb::blocked_range2d<int, int>& range) {
-        auto rowRange = range.rows();
-        auto colRange = range.cols();
-
-        for (auto y = rowRange.begin(); y < rowRange.end(); y++) {
-            if (abortProcessing.load()) {
-                break;
-            }
+    for (auto y = beginRow; y < endRow; y++) {
+        if (abortProcessing.load()) {
+            break;
+        }
 
-            const float yAlpha = (y + 0.5f) / mipDimensions.y;
-            const glm::vec3 normalXLo = faceNormals[0] + deltaYNormalLo * yAlpha;
-            const glm::vec3 normalXHi = faceNormals[1] + deltaYNormalHi * yAlpha;
-            const glm::vec3 deltaXNormal = normalXHi - normalXLo;
+        const float yAlpha = (y + 0.5f) / mipDimensions.y;
+        const glm::vec3 normalXLo = faceNormals[0] + deltaYNormalLo * yAlpha;
+        const glm::vec3 normalXHi = faceNormals[1] + deltaYNormalHi * yAlpha;
+        const glm::vec3 deltaXNormal = normalXHi - normalXLo;
 
-            for (auto x = colRange.begin(); x < colRange.end(); x++) {
-                const float xAlpha = (x + 0.5f) / mipDimensions.x;
-                // Interpolate normal for this pixel
-                const glm::vec3 normal = glm::normalize(normalXLo + deltaXNormal * xAlpha);
+        for (auto x = 0; x < mipDimensions.x; x++) {
+            const float xAlpha = (x + 0.5f) / mipDimensions.x;
+            // Interpolate normal for this pixel
+            const glm::vec3 normal = glm::normalize(normalXLo + deltaXNormal * xAlpha);
 
-                outputFacePixels[x + y * outputLineStride] = computeConvolution(normal, samples);
-            }
+            outputFacePixels[x + y * outputLineStride] = computeConvolution(normal, samples, mips);
         }
-    });
+    }
 }
 
-glm::vec4 CubeMap::computeConvolution(const glm::vec3& N, const GGXSamples& samples) const {
+glm::vec4 CubeMap::computeConvolution(const glm::vec3& N, const GGXSamples& samples, const ConstMips& mips) {
     // from tangent-space vector to world-space
     glm::vec3 bitangent = std::abs(N.z) < 0.999f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(1.0f, 0.0f, 0.0f);
     glm::vec3 tangent = glm::normalize(glm::cross(bitangent, N));
     bitangent = glm::cross(N, tangent);
 
     const size_t sampleCount = samples.points.size();
+    const glm::vec4* points = samples.points.data();
+    const GGXSamples::Lod* lods = samples.lods.data();
     glm::vec4 prefilteredColor = glm::vec4(0.0f);
 
     for (size_t i = 0; i < sampleCount; ++i) {
-        const auto& sample = samples.points[i];
-        glm::vec3 L(sample.x, sample.y, sample.z);
-        float NdotL = L.z;
-        float mipLevel = sample.w;
+        const auto& sample = points[i];
+        const auto& lod = lods[i];
+        float NdotL = sample.z;
         // Now back to world space
-        L = tangent * L.x + bitangent * L.y + N * L.z;
-        prefilteredColor += fetchLod(L, mipLevel) * NdotL;
+        glm::vec3 L = tangent * sample.x + bitangent * sample.y + N * sample.z;
+
+        int face;
+        glm::vec2 uv;
+        getFaceUV(L, &face, &uv);
+
+        glm::vec4 color = mips[lod.loLevel].fetch(face, uv);
+        if (lod.hiLevel != lod.loLevel) {
+            color += (mips[lod.hiLevel].fetch(face, uv) - color) * lod.frac;
+        }
+        prefilteredColor += color * NdotL;
     }
     prefilteredColor = prefilteredColor * samples.invTotalWeight;
     prefilteredColor.a = 1.0f;
     return prefilteredColor;
-}
\ No newline at end of file
+}
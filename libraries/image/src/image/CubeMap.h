@@ -72,6 +72,8 @@ namespace image {
         class Mip;
         class ConstMip;
 
+        using ConstMips = std::vector<ConstMip>;
+
         using Face = std::vector<glm::vec4>;
         using Faces = std::array<Face, 6>;
 
@@ -82,8 +84,10 @@ namespace image {
         static void getFaceUV(const glm::vec3& dir, int* index, glm::vec2* uv);
         static void generateGGXSamples(GGXSamples& data, float roughness, const int resolution);
         static void copyFace(int width, int height, const glm::vec4* source, size_t srcLineStride, glm::vec4* dest, size_t dstLineStride);
-        void convolveMipFaceForGGX(const GGXSamples& samples, CubeMap& output, gpu::uint16 mipLevel, int face, const std::atomic<bool>& abortProcessing) const;
-        glm::vec4 computeConvolution(const glm::vec3& normal, const GGXSamples& samples) const;
+        void generateGGXSampleLods(GGXSamples& data) const;
+        void convolveMipFaceRowsForGGX(const GGXSamples& samples, const ConstMips& mips, CubeMap& output, gpu::uint16 mipLevel, int face,
+                                       int beginRow, int endRow, const std::atomic<bool>& abortProcessing) const;
+        static glm::vec4 computeConvolution(const glm::vec3& normal, const GGXSamples& samples, const ConstMips& mips);
 
     };
 
@@ -18,11 +18,15 @@
 #include <QRgb>
 #include <QBuffer>
 #include <QImageReader>
+#include <QThread>
+
+#include <mutex>
 
 #include <Finally.h>
 #include <Profile.h>
 #include <StatTracker.h>
 #include <GLMHelpers.h>
+#include <TBBHelpers.h>
 
 #include "TGAReader.h"
 #if !defined(Q_OS_ANDROID)
@@ -308,36 +312,39 @@ void mapToRedChannel(Image& image, ColorChannel sourceChannel) {
         image = image.getConvertedToFormat(Image::Format_ARGB32);
     }
 
-    for (glm::uint32 i = 0; i < image.getHeight(); i++) {
-        QRgb* pixel = reinterpret_cast<QRgb*>(image.editScanLine(i));
-        // Past end pointer
-        QRgb* lineEnd = pixel + image.getWidth();
-
-        // Transfer channel data from source to target
-        for (; pixel < lineEnd; pixel++) {
-            int colorValue;
-            switch (sourceChannel) {
-            case ColorChannel::RED:
-                colorValue = qRed(*pixel);
-                break;
-            case ColorChannel::GREEN:
-                colorValue = qGreen(*pixel);
-                break;
-            case ColorChannel::BLUE:
-                colorValue = qBlue(*pixel);
-                break;
-            case ColorChannel::ALPHA:
-                colorValue = qAlpha(*pixel);
-                break;
-            default:
-                colorValue = qRed(*pixel);
-                break;
-            }
+    // Pick the channel once, outside of the pixel loop, so the loop stays branchless and vectorizes
+    int sourceShift;
+    switch (sourceChannel) {
+    case ColorChannel::GREEN:
+        sourceShift = 8;
+        break;
+    case ColorChannel::BLUE:
+        sourceShift = 0;
+        break;
+    case ColorChannel::ALPHA:
+        sourceShift = 24;
+        break;
+    case ColorChannel::RED:
+    default:
+        sourceShift = 16;
+        break;
+    }
+
+    // Take the bits once, editScanLine() checks whether the image needs to be detached and isn't safe to call from
+    // several threads
+    const int width = image.getWidth();
+    const size_t bytesPerLine = image.getBytesPerLineCount();
+    glm::uint8* bits = image.editBits();
+    tbb::parallel_for(tbb::blocked_range<int>(0, image.getHeight(), 16), [&](const tbb::blocked_range<int>& range) {
+        for (int i = range.begin(); i < range.end(); i++) {
+            QRgb* pixels = reinterpret_cast<QRgb*>(bits + i * bytesPerLine);
 
             // Dump the color in the red channel, ignore the rest
-            *pixel = qRgba(colorValue, 0, 0, 255);
+            for (int x = 0; x < width; x++) {
+                pixels[x] = qRgba((pixels[x] >> sourceShift) & 0xFF, 0, 0, 255);
+            }
         }
-    }
+    });
 }
 
 std::pair<gpu::TexturePointer, glm::ivec2> processImage(std::shared_ptr<QIODevice> content, const std::string& filename, ColorChannel sourceChannel,
@@ -502,61 +509,96 @@ struct MyErrorHandler : public nvtt::ErrorHandler {
     }
 };
 
-class SequentialTaskDispatcher : public nvtt::TaskDispatcher {
+// Spreads nvtt's block compression tasks over the TBB worker threads.  Without a dispatcher the compressor
+// would encode every block of every mip on the texture processing thread.
+class ParallelTaskDispatcher : public nvtt::TaskDispatcher {
 public:
-    SequentialTaskDispatcher(const std::atomic<bool>& abortProcessing = false) : _abortProcessing(abortProcessing) {}
+    ParallelTaskDispatcher(const std::atomic<bool>& abortProcessing = false) : _abortProcessing(abortProcessing) {}
 
     const std::atomic<bool>& _abortProcessing;
 
     void dispatch(nvtt::Task* task, void* context, int count) override {
-        for (int i = 0; i < count; i++) {
-            if (!_abortProcessing.load()) {
+        tbb::parallel_for(tbb::blocked_range<int>(0, count), [&](const tbb::blocked_range<int>& range) {
+            for (int i = range.begin(); i < range.end(); i++) {
+                if (_abortProcessing.load()) {
+                    break;
+                }
                 task(context, i);
-            } else {
-                break;
             }
+        });
+    }
+};
+
+// nvtt compressors set up their CUDA state when they're created, which a long running baker shouldn't pay for on every
+// texture.  They're pooled rather than kept per thread because compression can nest on a thread that's waiting on
+// block compression tasks.
+template <typename T>
+class CompressorPool {
+public:
+    std::shared_ptr<T> acquire() {
+        std::unique_ptr<T> compressor;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_compressors.empty()) {
+                compressor = std::move(_compressors.back());
+                _compressors.pop_back();
+            }
+        }
+        if (!compressor) {
+            compressor = std::make_unique<T>();
         }
+        return std::shared_ptr<T>(compressor.release(), [this](T* released) {
+            // The dispatcher set by the last user lives on its stack, put back nvtt's own before pooling the compressor
+            released->setTaskDispatcher(nullptr);
+            std::lock_guard<std::mutex> lock(_mutex);
+            _compressors.emplace_back(released);
+        });
     }
+
+private:
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<T>> _compressors;
 };
 
+static CompressorPool<nvtt::Context> hdrCompressorPool;
+static CompressorPool<nvtt::Compressor> ldrCompressorPool;
+
 void convertToFloatFromPacked(const unsigned char* source, int width, int height, size_t srcLineByteStride, gpu::Element sourceFormat,
                               glm::vec4* output, size_t outputLinePixelStride) {
-    glm::vec4* outputIt;
     auto unpackFunc = getHDRUnpackingFunction(sourceFormat);
 
-    outputLinePixelStride -= width;
-    outputIt = output;
-    for (auto lineNb = 0; lineNb < height; lineNb++) {
-        const uint32* srcPixelIt = reinterpret_cast<const uint32*>(source + lineNb * srcLineByteStride);
-        const uint32* srcPixelEnd = srcPixelIt + width;
+    tbb::parallel_for(tbb::blocked_range<int>(0, height, 16), [&](const tbb::blocked_range<int>& range) {
+        for (auto lineNb = range.begin(); lineNb < range.end(); lineNb++) {
+            const uint32* srcPixelIt = reinterpret_cast<const uint32*>(source + lineNb * srcLineByteStride);
+            const uint32* srcPixelEnd = srcPixelIt + width;
+            glm::vec4* outputIt = output + lineNb * outputLinePixelStride;
 
-        while (srcPixelIt < srcPixelEnd) {
-            *outputIt = glm::vec4(unpackFunc(*srcPixelIt), 1.0f);
-            ++srcPixelIt;
-            ++outputIt;
+            while (srcPixelIt < srcPixelEnd) {
+                *outputIt = glm::vec4(unpackFunc(*srcPixelIt), 1.0f);
+                ++srcPixelIt;
+                ++outputIt;
+            }
         }
-        outputIt += outputLinePixelStride;
-    }
+    });
 }
 
 void convertToPackedFromFloat(unsigned char* output, int width, int height, size_t outputLineByteStride, gpu::Element outputFormat,
                               const glm::vec4* source, size_t srcLinePixelStride) {
-    const glm::vec4* sourceIt;
     auto packFunc = getHDRPackingFunction(outputFormat);
 
-    srcLinePixelStride -= width;
-    sourceIt = source;
-    for (auto lineNb = 0; lineNb < height; lineNb++) {
-        uint32* outPixelIt = reinterpret_cast<uint32*>(output + lineNb * outputLineByteStride);
-        uint32* outPixelEnd = outPixelIt + width;
+    tbb::parallel_for(tbb::blocked_range<int>(0, height, 16), [&](const tbb::blocked_range<int>& range) {
+        for (auto lineNb = range.begin(); lineNb < range.end(); lineNb++) {
+            uint32* outPixelIt = reinterpret_cast<uint32*>(output + lineNb * outputLineByteStride);
+            uint32* outPixelEnd = outPixelIt + width;
+            const glm::vec4* sourceIt = source + lineNb * srcLinePixelStride;
 
-        while (outPixelIt < outPixelEnd) {
-            *outPixelIt = packFunc(*sourceIt);
-            ++outPixelIt;
-            ++sourceIt;
+            while (outPixelIt < outPixelEnd) {
+                *outPixelIt = packFunc(*sourceIt);
+                ++outPixelIt;
+                ++sourceIt;
+            }
         }
-        sourceIt += srcLinePixelStride;
-    }
+    });
 }
 
 nvtt::OutputHandler* getNVTTCompressionOutputHandler(gpu::Texture* outputTexture, int face, nvtt::CompressionOptions& compressionOptions) {
@@ -611,7 +653,8 @@ void convertImageToHDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
 
     MyErrorHandler errorHandler;
     outputOptions.setErrorHandler(&errorHandler);
-    nvtt::Context context;
+    auto compressor = hdrCompressorPool.acquire();
+    auto& context = *compressor;
     int mipLevel = baseMipLevel;
 
     outputOptions.setOutputHandler(outputHandler.get());
@@ -621,8 +664,7 @@ void convertImageToHDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
     surface.setAlphaMode(nvtt::AlphaMode_None);
     surface.setWrapMode(nvtt::WrapMode_Mirror);
 
-    SequentialTaskDispatcher dispatcher(abortProcessing);
-    nvtt::Compressor compressor;
+    ParallelTaskDispatcher dispatcher(abortProcessing);
     context.setTaskDispatcher(&dispatcher);
 
     context.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
@@ -758,8 +800,10 @@ void convertImageToLDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
         MyErrorHandler errorHandler;
         outputOptions.setErrorHandler(&errorHandler);
 
-        SequentialTaskDispatcher dispatcher(abortProcessing);
-        nvtt::Compressor context;
+        ParallelTaskDispatcher dispatcher(abortProcessing);
+        auto compressor = ldrCompressorPool.acquire();
+        auto& context = *compressor;
+        context.setTaskDispatcher(&dispatcher);
 
         context.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
         if (buildMips) {
@@ -806,7 +850,12 @@ void convertImageToLDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
 
         const Etc::ErrorMetric errorMetric = Etc::ErrorMetric::RGBA;
         const float effort = 1.0f;
-        const int numEncodeThreads = 4;
+        // The encoder starts its own threads.  Several textures are usually processed at once, so share the cores
+        // between the encodes running at the same time.
+        static std::atomic<int> numActiveEncodes { 0 };
+        const int numConcurrentEncodes = ++numActiveEncodes;
+        Finally endEncode([] { --numActiveEncodes; });
+        const int numEncodeThreads = std::max(QThread::idealThreadCount() / numConcurrentEncodes, 1);
         int encodingTime;
 
         if (localCopy.getFormat() != Image::Format_RGBAF) {
@@ -1043,48 +1092,46 @@ Image processBumpMap(Image&& image) {
 
     Image result(width, height, Image::Format_ARGB32);
 
-    for (int i = 0; i < width; i++) {
-        const int iNextClamped = clampPixelCoordinate(i + 1, width - 1);
-        const int iPrevClamped = clampPixelCoordinate(i - 1, width - 1);
-
-        for (int j = 0; j < height; j++) {
-            const int jNextClamped = clampPixelCoordinate(j + 1, height - 1);
-            const int jPrevClamped = clampPixelCoordinate(j - 1, height - 1);
-
-            // surrounding pixels
-            const QRgb topLeft = localCopy.getPackedPixel(iPrevClamped, jPrevClamped);
-            const QRgb top = localCopy.getPackedPixel(iPrevClamped, j);
-            const QRgb topRight = localCopy.getPackedPixel(iPrevClamped, jNextClamped);
-            const QRgb right = localCopy.getPackedPixel(i, jNextClamped);
-            const QRgb bottomRight = localCopy.getPackedPixel(iNextClamped, jNextClamped);
-            const QRgb bottom = localCopy.getPackedPixel(iNextClamped, j);
-            const QRgb bottomLeft = localCopy.getPackedPixel(iNextClamped, jPrevClamped);
-            const QRgb left = localCopy.getPackedPixel(i, jPrevClamped);
-
-            // take their gray intensities
-            // since it's a grayscale image, the value of each component RGB is the same
-            const double tl = qRed(topLeft);
-            const double t = qRed(top);
-            const double tr = qRed(topRight);
-            const double r = qRed(right);
-            const double br = qRed(bottomRight);
-            const double b = qRed(bottom);
-            const double bl = qRed(bottomLeft);
-            const double l = qRed(left);
-
-            // apply the sobel filter
-            const double dX = (tr + pStrength * r + br) - (tl + pStrength * l + bl);
-            const double dY = (bl + pStrength * b + br) - (tl + pStrength * t + tr);
-            const double dZ = RGBA_MAX / pStrength;
-
-            glm::vec3 v(dX, dY, dZ);
-            glm::normalize(v);
-
-            // convert to rgb from the value obtained computing the filter
-            QRgb qRgbValue = qRgba(mapComponent(v.z), mapComponent(v.y), mapComponent(v.x), 1.0);
-            result.setPackedPixel(i, j, qRgbValue);
+    // Walk the image a row at a time, reading the three source rows straight from the bits, so each band of rows
+    // can be filtered on its own thread.  The bits are taken once, editScanLine() isn't safe to call from several threads.
+    const glm::uint8* sourceBits = localCopy.getBits();
+    const size_t sourceBytesPerLine = localCopy.getBytesPerLineCount();
+    glm::uint8* resultBits = result.editBits();
+    const size_t resultBytesPerLine = result.getBytesPerLineCount();
+    tbb::parallel_for(tbb::blocked_range<int>(0, height, 16), [&](const tbb::blocked_range<int>& range) {
+        for (int j = range.begin(); j < range.end(); j++) {
+            const glm::uint8* prevRow = sourceBits + clampPixelCoordinate(j - 1, height - 1) * sourceBytesPerLine;
+            const glm::uint8* row = sourceBits + j * sourceBytesPerLine;
+            const glm::uint8* nextRow = sourceBits + clampPixelCoordinate(j + 1, height - 1) * sourceBytesPerLine;
+            QRgb* resultRow = reinterpret_cast<QRgb*>(resultBits + j * resultBytesPerLine);
+
+            for (int i = 0; i < width; i++) {
+                const int iNextClamped = clampPixelCoordinate(i + 1, width - 1);
+                const int iPrevClamped = clampPixelCoordinate(i - 1, width - 1);
+
+                // take the gray intensities of the surrounding pixels
+                const double tl = prevRow[iPrevClamped];
+                const double t = row[iPrevClamped];
+                const double tr = nextRow[iPrevClamped];
+                const double r = nextRow[i];
+                const double br = nextRow[iNextClamped];
+                const double b = row[iNextClamped];
+                const double bl = prevRow[iNextClamped];
+                const double l = prevRow[i];
+
+                // apply the sobel filter
+                const double dX = (tr + pStrength * r + br) - (tl + pStrength * l + bl);
+                const double dY = (bl + pStrength * b + br) - (tl + pStrength * t + tr);
+                const double dZ = RGBA_MAX / pStrength;
+
+                glm::vec3 v(dX, dY, dZ);
+                glm::normalize(v);
+
+                // convert to rgb from the value obtained computing the filter
+                resultRow[i] = qRgba(mapComponent(v.z), mapComponent(v.y), mapComponent(v.x), 1.0);
+            }
         }
-    }
+    });
 
     return result;
 }
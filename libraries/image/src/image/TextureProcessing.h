@@ -132,6 +132,9 @@ void convertToTextureWithMips(gpu::Texture* texture, Image&& image, gpu::Backend
 void convertToTexture(gpu::Texture* texture, Image&& image, gpu::BackendTarget target, const std::atomic<bool>& abortProcessing = false, int face = -1, int mipLevel = 0);
 Image convertToHDRFormat(Image&& srcImage, gpu::Element format);
 Image convertToLDRFormat(Image&& srcImage, Image::Format format);
+
+void mapToRedChannel(Image& image, ColorChannel sourceChannel);
+Image processBumpMap(Image&& image);
 } // namespace image
 
 #endif // hifi_image_TextureProcessing_h
@@ -0,0 +1,92 @@
+//
+//  MipRangeQueue.cpp
+//  libraries/material-networking/src/material-networking
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "MipRangeQueue.h"
+
+#include <algorithm>
+
+std::pair<uint16_t, uint16_t> getNextMipRange(const ktx::ImageDescriptors& images, uint16_t lowestFetchedMip,
+                                              uint16_t lowestRequestedMip) {
+    uint16_t high = lowestFetchedMip - 1;
+    uint16_t low = high;
+    size_t rangeSize = images[high]._imageSize + ktx::IMAGE_SIZE_WIDTH;
+    while (low > lowestRequestedMip && rangeSize + images[low - 1]._imageSize + ktx::IMAGE_SIZE_WIDTH <= MIP_RANGE_TARGET_SIZE) {
+        --low;
+        rangeSize += images[low]._imageSize + ktx::IMAGE_SIZE_WIDTH;
+    }
+    return { low, high };
+}
+
+MipRangeData MipRangeData::fromRange(const ktx::ImageDescriptors& images, uint16_t low, uint16_t high, const QByteArray& data) {
+    // Find each mip's data in the range, the lowest mip comes first in the file
+    MipRangeData rangeData;
+    for (int level = high; level >= (int)low; --level) {
+        size_t offset = images[level]._imageOffset - images[low]._imageOffset;
+        rangeData.images.push_back({ (uint16_t)level, offset, images[level]._imageSize });
+    }
+    rangeData.data = data;
+    return rangeData;
+}
+
+bool MipRangeQueue::push(MipRangeData range) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto position = std::find_if(_ranges.begin(), _ranges.end(), [&](const MipRangeData& queued) {
+        return queued.highestLevel() < range.highestLevel();
+    });
+    _ranges.insert(position, std::move(range));
+    if (_isDraining) {
+        // The running worker will get to it
+        return false;
+    }
+    _isDraining = true;
+    return true;
+}
+
+bool MipRangeQueue::pop(MipRangeData& range, uint32_t generation) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (generation != _generation) {
+        // The queue now belongs to the worker of a newer load
+        return false;
+    }
+    if (_ranges.empty()) {
+        _isDraining = false;
+        return false;
+    }
+    range = std::move(_ranges.front());
+    _ranges.pop_front();
+    return true;
+}
+
+void MipRangeQueue::abort(uint32_t generation) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (generation != _generation) {
+        return;
+    }
+    _ranges.clear();
+    _isDraining = false;
+}
+
+void MipRangeQueue::reset() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _ranges.clear();
+    _isDraining = false;
+    ++_generation;
+}
+
+uint32_t MipRangeQueue::getGeneration() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _generation;
+}
+
+size_t MipRangeQueue::size() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _ranges.size();
+}
@@ -0,0 +1,75 @@
+//
+//  MipRangeQueue.h
+//  libraries/material-networking/src/material-networking
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_MipRangeQueue_h
+#define hifi_MipRangeQueue_h
+
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QByteArray>
+
+#include <ktx/KTX.h>
+
+// The small mips are coalesced into a single range request, so that each round trip brings in a useful amount of data
+const size_t MIP_RANGE_TARGET_SIZE = 256 * 1024;
+
+/// \return the range of mips, [low, high], to be requested after lowestFetchedMip, without going below lowestRequestedMip
+std::pair<uint16_t, uint16_t> getNextMipRange(const ktx::ImageDescriptors& images, uint16_t lowestFetchedMip,
+                                              uint16_t lowestRequestedMip);
+
+// A downloaded range of mips, with where each mip's data is in it
+struct MipRangeData {
+    struct Image {
+        uint16_t level;
+        size_t offset;
+        size_t size;
+    };
+    std::vector<Image> images;
+    QByteArray data;
+
+    static MipRangeData fromRange(const ktx::ImageDescriptors& images, uint16_t low, uint16_t high, const QByteArray& data);
+
+    // The images are listed from the highest level, the smallest mip, down
+    uint16_t highestLevel() const { return images.empty() ? 0 : images.front().level; }
+};
+
+// Downloaded mip ranges waiting to be stored in a texture.  Mips have to be stored from the smallest up, so ranges
+// are handed out highest level first whatever order they were downloaded in.  A single worker drains the queue.
+// A worker is started for a generation of the queue, see getGeneration(), and stops once reset() has moved past it.
+class MipRangeQueue {
+public:
+    /// \return true if no worker is draining the queue, in which case the caller must start one
+    bool push(MipRangeData range);
+
+    /// \return false once the queue is empty or has been reset since the worker started, at which point it is done
+    bool pop(MipRangeData& range, uint32_t generation);
+
+    // Called by the worker when it can't store a range, drops the queued ranges and stops the worker
+    void abort(uint32_t generation);
+
+    // Called when the texture is reloaded, drops the queued ranges.  A worker still storing ranges of the previous
+    // load stops at its next pop, and the next push starts a new worker.
+    void reset();
+
+    uint32_t getGeneration() const;
+    size_t size() const;
+
+private:
+    mutable std::mutex _mutex;
+    std::deque<MipRangeData> _ranges;
+    bool _isDraining { false };
+    uint32_t _generation { 0 };
+};
+
+#endif // hifi_MipRangeQueue_h
@@ -11,6 +11,7 @@
 
 #include "TextureCache.h"
 
+#include <cmath>
 #include <mutex>
 
 #include <QtConcurrent/QtConcurrentRun>
@@ -21,6 +22,7 @@
 #include <QThreadPool>
 #include <QNetworkReply>
 #include <QPainter>
+#include <QTimer>
 #include <QUrlQuery>
 
 #if DEBUG_DUMP_TEXTURE_LOADS
@@ -33,6 +35,7 @@
 
 #include <gl/GLHelpers.h>
 #include <gpu/Batch.h>
+#include <gpu/Context.h>
 
 #include <image/TextureProcessing.h>
 
@@ -597,20 +600,58 @@ void NetworkTexture::makeRequest() {
 
         startMipRangeRequest(NULL_MIP_LEVEL, NULL_MIP_LEVEL);
     } else if (_ktxResourceState == PENDING_MIP_REQUEST) {
-        if (_lowestKnownPopulatedMip > 0) {
+        if (_lowestFetchedMip > 0 && _lowestFetchedMip != NULL_MIP_LEVEL) {
             _ktxResourceState = REQUESTING_MIP;
 
             // Add a fragment to the base url so we can identify the section of the ktx being requested when debugging
             // The actual requested url is _activeUrl and will not contain the fragment
-            uint16_t nextMip = _lowestKnownPopulatedMip - 1;
-            _url.setFragment(QString::number(nextMip));
-            startMipRangeRequest(nextMip, nextMip);
+            auto range = getNextMipRange(_originalKtxDescriptor->images, _lowestFetchedMip, _lowestRequestedMipLevel);
+            _url.setFragment(QString::number(range.first));
+            _bytesReceived = 0;
+            startMipRangeRequest(range.first, range.second);
         }
     } else {
         qWarning(networking) << "NetworkTexture::makeRequest() called while not in a valid state: " << _ktxResourceState;
     }
 }
 
+void NetworkTexture::preempt() {
+    if (_currentlyLoadingResourceType != ResourceType::KTX) {
+        Resource::preempt();
+        return;
+    }
+
+    // only give up the slot if nothing has arrived since the requests were made
+    if (_loaded || _failedToLoad || _bytesReceived > 0) {
+        return;
+    }
+    if (_ktxResourceState == LOADING_INITIAL_DATA) {
+        if (_ktxHeaderRequest) {
+            _ktxHeaderRequest->disconnect(this);
+            _ktxHeaderRequest->deleteLater();
+            _ktxHeaderRequest = nullptr;
+        }
+        _ktxResourceState = PENDING_INITIAL_LOAD;
+    } else if (_ktxResourceState == REQUESTING_MIP) {
+        _ktxResourceState = PENDING_MIP_REQUEST;
+    } else {
+        return;
+    }
+    if (_ktxMipRequest) {
+        _ktxMipRequest->disconnect(this);
+        _ktxMipRequest->deleteLater();
+        _ktxMipRequest = nullptr;
+    }
+
+    PROFILE_ASYNC_END(resource, "Resource:" + getType(), QString::number(_requestID));
+    TextureCache::requestCompleted(_self);
+
+    // back in the queue, to be picked up again by priority
+    if (DependencyManager::get<ResourceCacheSharedItems>()->appendRequest(_self, NAN)) {
+        makeRequest();
+    }
+}
+
 void NetworkTexture::handleLocalRequestCompleted() {
     TextureCache::requestCompleted(_self);
 }
@@ -706,22 +747,97 @@ void NetworkTexture::startRequestForNextMipLevel() {
     }
 
     auto texture = _textureSource->getGPUTexture();
-    if (!texture || _ktxResourceState != WAITING_FOR_MIP_REQUEST) {
+    if (!texture || _ktxResourceState != WAITING_FOR_MIP_REQUEST || _mipStreamingFailed) {
         return;
     }
 
     _lowestKnownPopulatedMip = texture->minAvailableMipLevel();
-    if (_lowestRequestedMipLevel < _lowestKnownPopulatedMip) {
+    _lowestFetchedMip = std::min(_lowestFetchedMip, _lowestKnownPopulatedMip);
+    if (_lowestRequestedMipLevel < _lowestFetchedMip) {
+        // The full resolution mip is most of a texture's size.  While the textures already loaded don't fit the gpu
+        // budget it would only be evicted again, so hold it back until there's room.
+        auto allowedMemory = gpu::Texture::getAllowedGPUMemoryUsage();
+        if (_lowestFetchedMip == 1 && allowedMemory > 0 && gpu::Context::getTextureResourceIdealGPUMemSize() > allowedMemory) {
+            const int OVER_BUDGET_RETRY_MSECS = 1000;
+            QTimer::singleShot(OVER_BUDGET_RETRY_MSECS, this, &NetworkTexture::startRequestForNextMipLevel);
+            return;
+        }
+
         _ktxResourceState = PENDING_MIP_REQUEST;
 
         init(false);
-        float priority = -(float)_originalKtxDescriptor->header.numberOfMipmapLevels + (float)_lowestKnownPopulatedMip;
+        float priority = -(float)_originalKtxDescriptor->header.numberOfMipmapLevels + (float)_lowestFetchedMip;
         setLoadPriorityOperator(this, [priority]() { return priority; });
-        _url.setFragment(QString::number(_lowestKnownPopulatedMip - 1));
+        _url.setFragment(QString::number(_lowestFetchedMip - 1));
         TextureCache::attemptRequest(self);
     }
 }
 
+void NetworkTexture::queueMipRangeData(uint16_t low, uint16_t high, const QByteArray& data) {
+    if (!_mipRangeQueue.push(MipRangeData::fromRange(_originalKtxDescriptor->images, low, high, data))) {
+        // The running worker will get to it
+        return;
+    }
+
+    auto self = _self;
+    auto url = _url;
+    auto texture = _textureSource->getGPUTexture();
+    auto generation = _mipRangeQueue.getGeneration();
+    DependencyManager::get<StatTracker>()->incrementStat("PendingProcessing");
+    QtConcurrent::run(QThreadPool::globalInstance(), [self, url, texture, generation] {
+        PROFILE_RANGE_EX(resource_parse_image, "NetworkTexture - Processing Mip Data", 0xffff0000, 0, { { "url", url.toString() } });
+        DependencyManager::get<StatTracker>()->decrementStat("PendingProcessing");
+        CounterStat counter("Processing");
+
+        auto originalPriority = QThread::currentThread()->priority();
+        if (originalPriority == QThread::InheritPriority) {
+            originalPriority = QThread::NormalPriority;
+        }
+        QThread::currentThread()->setPriority(QThread::LowPriority);
+        Finally restorePriority([originalPriority] { QThread::currentThread()->setPriority(originalPriority); });
+
+        auto resource = self.lock();
+        if (!resource) {
+            // Resource no longer exists, bail
+            return;
+        }
+
+        Q_ASSERT_X(texture, "Async - NetworkTexture::queueMipRangeData", "NetworkTexture should have been assigned a GPU texture by now.");
+        static_cast<NetworkTexture*>(resource.data())->storeMipRangeData(texture, generation);
+    });
+}
+
+void NetworkTexture::storeMipRangeData(const gpu::TexturePointer& texture, uint32_t generation) {
+    while (true) {
+        MipRangeData rangeData;
+        if (!_mipRangeQueue.pop(rangeData, generation)) {
+            return;
+        }
+
+        auto rangeStorage = std::make_shared<storage::ByteArrayStorage>(rangeData.data);
+        for (const auto& image : rangeData.images) {
+            if (image.offset + image.size > (size_t)rangeData.data.size()) {
+                qCWarning(materialnetworking) << "Mip range is missing data for mip" << image.level;
+                break;
+            }
+            auto mipStorage = rangeStorage->createView(image.size, image.offset);
+            texture->assignStoredMip(image.level, mipStorage);
+
+            // If mip level assigned above is still unavailable, then we assume future requests will also fail.
+            if (texture->minAvailableMipLevel() > image.level) {
+                _mipStreamingFailed = true;
+                _mipRangeQueue.abort(generation);
+                return;
+            }
+        }
+
+        QMetaObject::invokeMethod(this, "setImage",
+            Q_ARG(gpu::TexturePointer, texture),
+            Q_ARG(int, texture->getWidth()),
+            Q_ARG(int, texture->getHeight()));
+    }
+}
+
 // Load mips in the range [low, high] (inclusive)
 void NetworkTexture::startMipRangeRequest(uint16_t low, uint16_t high) {
     if (_ktxMipRequest) {
@@ -749,11 +865,12 @@ void NetworkTexture::startMipRangeRequest(uint16_t low, uint16_t high) {
 
         connect(_ktxMipRequest, &ResourceRequest::finished, this, &NetworkTexture::ktxInitialDataRequestFinished);
     } else {
+        const auto& images = _originalKtxDescriptor->images;
         ByteRange range;
         range.fromInclusive = ktx::KTX_HEADER_SIZE + _originalKtxDescriptor->header.bytesOfKeyValueData
-                              + _originalKtxDescriptor->images[low]._imageOffset + ktx::IMAGE_SIZE_WIDTH;
+                              + images[low]._imageOffset + ktx::IMAGE_SIZE_WIDTH;
         range.toExclusive = ktx::KTX_HEADER_SIZE + _originalKtxDescriptor->header.bytesOfKeyValueData
-                              + _originalKtxDescriptor->images[high + 1]._imageOffset;
+                              + images[high]._imageOffset + ktx::IMAGE_SIZE_WIDTH + images[high]._imageSize;
         _ktxMipRequest->setByteRange(range);
 
         connect(_ktxMipRequest, &ResourceRequest::finished, this, &NetworkTexture::ktxMipRequestFinished);
@@ -783,6 +900,8 @@ void NetworkTexture::ktxInitialDataRequestFinished() {
 
     setSize(_bytesTotal);
 
+    // counted before the request is removed, the protocol's request limit is tuned on its throughput
+    _bytesReceived = _ktxHeaderRequest->getData().size() + _ktxMipRequest->getData().size();
     TextureCache::requestCompleted(_self);
 
     auto result = _ktxHeaderRequest->getResult();
@@ -832,6 +951,7 @@ void NetworkTexture::ktxMipRequestFinished() {
         return;
     }
 
+    _bytesReceived = _ktxMipRequest->getData().size();
     TextureCache::requestCompleted(_self);
 
     auto result = _ktxMipRequest->getResult();
@@ -839,51 +959,15 @@ void NetworkTexture::ktxMipRequestFinished() {
 
         if (_ktxResourceState == REQUESTING_MIP) {
             Q_ASSERT(_ktxMipLevelRangeInFlight.first != NULL_MIP_LEVEL);
-            Q_ASSERT(_ktxMipLevelRangeInFlight.second - _ktxMipLevelRangeInFlight.first == 0);
+            Q_ASSERT(_ktxMipLevelRangeInFlight.first <= _ktxMipLevelRangeInFlight.second);
 
             _ktxResourceState = WAITING_FOR_MIP_REQUEST;
+            _lowestFetchedMip = _ktxMipLevelRangeInFlight.first;
 
-            auto self = _self;
-            auto url = _url;
-            auto data = _ktxMipRequest->getData();
-            auto mipLevel = _ktxMipLevelRangeInFlight.first;
-            auto texture = _textureSource->getGPUTexture();
-            DependencyManager::get<StatTracker>()->incrementStat("PendingProcessing");
-            QtConcurrent::run(QThreadPool::globalInstance(), [self, data, mipLevel, url, texture] {
-                PROFILE_RANGE_EX(resource_parse_image, "NetworkTexture - Processing Mip Data", 0xffff0000, 0, { { "url", url.toString() } });
-                DependencyManager::get<StatTracker>()->decrementStat("PendingProcessing");
-                CounterStat counter("Processing");
-
-                auto originalPriority = QThread::currentThread()->priority();
-                if (originalPriority == QThread::InheritPriority) {
-                    originalPriority = QThread::NormalPriority;
-                }
-                QThread::currentThread()->setPriority(QThread::LowPriority);
-                Finally restorePriority([originalPriority] { QThread::currentThread()->setPriority(originalPriority); });
-
-                auto resource = self.lock();
-                if (!resource) {
-                    // Resource no longer exists, bail
-                    return;
-                }
-
-                Q_ASSERT_X(texture, "Async - NetworkTexture::ktxMipRequestFinished", "NetworkTexture should have been assigned a GPU texture by now.");
-
-                texture->assignStoredMip(mipLevel, data.size(), reinterpret_cast<const uint8_t*>(data.data()));
-
-                // If mip level assigned above is still unavailable, then we assume future requests will also fail.
-                auto minMipLevel = texture->minAvailableMipLevel();
-                if (minMipLevel > mipLevel) {
-                    return;
-                }
-
-                QMetaObject::invokeMethod(resource.data(), "setImage",
-                    Q_ARG(gpu::TexturePointer, texture),
-                    Q_ARG(int, texture->getWidth()),
-                    Q_ARG(int, texture->getHeight()));
-
-                QMetaObject::invokeMethod(resource.data(), "startRequestForNextMipLevel");
-            });
+            // The next range downloads while this one is being stored.  The request is made once this one has
+            // been cleaned up.
+            queueMipRangeData(_ktxMipLevelRangeInFlight.first, _ktxMipLevelRangeInFlight.second, _ktxMipRequest->getData());
+            QMetaObject::invokeMethod(this, "startRequestForNextMipLevel", Qt::QueuedConnection);
         } else {
             qWarning(networking) << "Mip request finished in an unexpected state: " << _ktxResourceState;
             finishedLoading(false);
@@ -1037,18 +1121,19 @@ void NetworkTexture::handleFinishedInitialLoad() {
             textureAndSize.first->setSource(filename);
 
             auto& images = originalKtxDescriptor->images;
+            auto highMipStorage = std::make_shared<storage::ByteArrayStorage>(ktxHighMipData);
             size_t imageSizeRemaining = ktxHighMipData.size();
-            const uint8_t* ktxData = reinterpret_cast<const uint8_t*>(ktxHighMipData.data());
-            ktxData += ktxHighMipData.size();
+            size_t ktxDataOffset = ktxHighMipData.size();
             // TODO Move image offset calculation to ktx ImageDescriptor
             for (int level = static_cast<int>(images.size()) - 1; level >= 0; --level) {
                 auto& image = images[level];
                 if (image._imageSize > imageSizeRemaining) {
                     break;
                 }
-                ktxData -= image._imageSize;
-                textureAndSize.first->assignStoredMip(static_cast<gpu::uint16>(level), image._imageSize, ktxData);
-                ktxData -= ktx::IMAGE_SIZE_WIDTH;
+                ktxDataOffset -= image._imageSize;
+                auto mipStorage = highMipStorage->createView(image._imageSize, ktxDataOffset);
+                textureAndSize.first->assignStoredMip(static_cast<gpu::uint16>(level), mipStorage);
+                ktxDataOffset -= ktx::IMAGE_SIZE_WIDTH;
                 imageSizeRemaining -= (image._imageSize + ktx::IMAGE_SIZE_WIDTH);
             }
 
@@ -1174,6 +1259,9 @@ void NetworkTexture::refresh() {
     }
 
     _ktxResourceState = PENDING_INITIAL_LOAD;
+    _lowestFetchedMip = NULL_MIP_LEVEL;
+    _mipStreamingFailed = false;
+    _mipRangeQueue.reset();
     Resource::refresh();
 }
 
@@ -12,6 +12,8 @@
 #ifndef hifi_TextureCache_h
 #define hifi_TextureCache_h
 
+#include <atomic>
+
 #include <gpu/Texture.h>
 
 #include <QImage>
@@ -30,6 +32,7 @@
 
 #include <gpu/Context.h>
 #include "KTXCache.h"
+#include "MipRangeQueue.h"
 
 namespace gpu {
 class Batch;
@@ -80,6 +83,9 @@ public slots:
     void ktxInitialDataRequestFinished();
     void ktxMipRequestFinished();
 
+protected slots:
+    void preempt() override;
+
 protected:
     void makeRequest() override;
     void makeLocalRequest();
@@ -100,6 +106,9 @@ protected:
     void startMipRangeRequest(uint16_t low, uint16_t high);
     void handleFinishedInitialLoad();
 
+    void storeMipRangeData(const gpu::TexturePointer& texture, uint32_t generation);
+    void storeMipRangeData(const gpu::TexturePointer& texture);
+
 private:
     friend class KTXReader;
     friend class ImageReader;
@@ -137,6 +146,12 @@ private:
 
     uint16_t _lowestRequestedMipLevel { NULL_MIP_LEVEL };
     uint16_t _lowestKnownPopulatedMip { NULL_MIP_LEVEL };
+    // The lowest mip that has been downloaded, it may still be waiting to be stored in the texture
+    uint16_t _lowestFetchedMip { NULL_MIP_LEVEL };
+
+    // Downloaded mip ranges are stored in the texture on a worker while the next range downloads
+    MipRangeQueue _mipRangeQueue;
+    std::atomic<bool> _mipStreamingFailed { false };
 
     // This is a copy of the original KTX descriptor from the source url.
     // We need this because the KTX that will be cached will likely include extra data
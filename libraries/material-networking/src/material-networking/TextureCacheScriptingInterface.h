@@ -37,6 +37,12 @@ class TextureCacheScriptingInterface : public ScriptableResourceCache, public De
      * @property {number} numCached - Total number of cached resource. <em>Read-only.</em>
      * @property {number} sizeTotal - Size in bytes of all resources. <em>Read-only.</em>
      * @property {number} sizeCached - Size in bytes of all cached resources. <em>Read-only.</em>
+     * @property {number} numArtifactHits - Number of resources whose processed form was loaded from the disk cache.
+     *     <em>Read-only.</em>
+     * @property {number} numArtifactMisses - Number of resources that had to be processed because their processed form
+     *     wasn't in the disk cache. <em>Read-only.</em>
+     * @property {number} artifactHitRate - Fraction, <code>0.0</code> &ndash; <code>1.0</code>, of disk cache lookups that
+     *     were hits. <em>Read-only.</em>
      * @property {number} numGlobalQueriesPending - Total number of global queries pending (across all resource cache managers).
      *     <em>Read-only.</em>
      * @property {number} numGlobalQueriesLoading - Total number of global queries loading (across all resource cache managers).
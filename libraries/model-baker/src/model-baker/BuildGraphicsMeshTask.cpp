@@ -14,6 +14,7 @@
 #include <glm/gtc/packing.hpp>
 
 #include <LogHandler.h>
+#include <TBBHelpers.h>
 #include "ModelBakerLogging.h"
 #include "ModelMath.h"
 
@@ -397,19 +398,22 @@ void BuildGraphicsMeshTask::run(const baker::BakeContextPointer& context, const
     auto& graphicsMeshes = output;
 
     int n = (int)meshes.size();
-    for (int i = 0; i < n; i++) {
-        graphicsMeshes.emplace_back();
-        auto& graphicsMesh = graphicsMeshes[i];
-        
-        // Try to create the graphics::Mesh
-        buildGraphicsMesh(meshes[i], graphicsMesh, baker::safeGet(normalsPerMesh, i), baker::safeGet(tangentsPerMesh, i));
-
-        // Choose a name for the mesh
-        if (graphicsMesh) {
-            graphicsMesh->displayName = url.toString().toStdString() + "#/mesh/" + std::to_string(i);
-            if (meshIndicesToModelNames.find(i) != meshIndicesToModelNames.cend()) {
-                graphicsMesh->modelName = meshIndicesToModelNames[i].toStdString();
+    graphicsMeshes.resize(n);
+    const std::string urlString = url.toString().toStdString();
+    tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](const tbb::blocked_range<int>& range) {
+        for (int i = range.begin(); i < range.end(); i++) {
+            auto& graphicsMesh = graphicsMeshes[i];
+
+            // Try to create the graphics::Mesh
+            buildGraphicsMesh(meshes[i], graphicsMesh, baker::safeGet(normalsPerMesh, i), baker::safeGet(tangentsPerMesh, i));
+
+            // Choose a name for the mesh
+            if (graphicsMesh) {
+                graphicsMesh->displayName = urlString + "#/mesh/" + std::to_string(i);
+                if (meshIndicesToModelNames.find(i) != meshIndicesToModelNames.cend()) {
+                    graphicsMesh->modelName = meshIndicesToModelNames[i].toStdString();
+                }
             }
         }
-    }
+    });
 }
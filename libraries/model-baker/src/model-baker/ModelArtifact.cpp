@@ -0,0 +1,932 @@
+//
+//  ModelArtifact.cpp
+//  model-baker/src/model-baker
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ModelArtifact.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <typeinfo>
+
+#include <QtCore/QDataStream>
+
+#include <gpu/Buffer.h>
+
+#include "ModelBakerLogging.h"
+
+namespace baker {
+
+const uint32_t MODEL_ARTIFACT_TYPE = 0x4C444F4D; // "MODL"
+const uint32_t MODEL_ARTIFACT_VERSION = 2;
+
+namespace {
+
+// Appends values in native byte order; artifacts never leave the machine that wrote them
+class ArtifactWriter {
+public:
+    template <typename T>
+    void writeValue(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain values can be written as is");
+        _data.append((const char*)&value, sizeof(T));
+    }
+
+    void writeBool(bool value) { writeValue((uint8_t)value); }
+
+    void writeBytes(const void* bytes, size_t size) {
+        writeValue((uint64_t)size);
+        _data.append((const char*)bytes, (int)size);
+    }
+
+    void writeByteArray(const QByteArray& bytes) { writeBytes(bytes.constData(), bytes.size()); }
+    void writeString(const QString& string) { writeByteArray(string.toUtf8()); }
+    void writeString(const std::string& string) { writeBytes(string.data(), string.size()); }
+
+    template <typename Container>
+    void writeArray(const Container& values) {
+        using T = typename Container::value_type;
+        static_assert(std::is_trivially_copyable<T>::value, "only arrays of plain values can be written as is");
+        writeBytes(values.data(), values.size() * sizeof(T));
+    }
+
+    void writeTransform(const Transform& transform) {
+        writeValue(transform.getTranslation());
+        writeValue(transform.getRotation());
+        writeValue(transform.getScale());
+    }
+
+    void writeExtents(const Extents& extents) {
+        writeValue(extents.minimum);
+        writeValue(extents.maximum);
+    }
+
+    void writeVariantMap(const QVariantMap& map) {
+        QByteArray bytes;
+        QDataStream stream(&bytes, QIODevice::WriteOnly);
+        stream << map;
+        writeByteArray(bytes);
+    }
+
+    QByteArray& data() { return _data; }
+
+private:
+    QByteArray _data;
+};
+
+// Reads back what ArtifactWriter wrote.  Reading past the end invalidates the reader and yields default values from
+// then on, so callers only need to check isValid() once they're done.
+class ArtifactReader {
+public:
+    ArtifactReader(const uint8_t* data, size_t size) : _data(data), _size(size) {}
+
+    bool isValid() const { return _valid; }
+    bool atEnd() const { return _pos == _size; }
+    void invalidate() { _valid = false; }
+
+    template <typename T>
+    T readValue() {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain values can be read as is");
+        T value {};
+        if (canRead(sizeof(T))) {
+            memcpy(&value, _data + _pos, sizeof(T));
+            _pos += sizeof(T);
+        }
+        return value;
+    }
+
+    bool readBool() { return readValue<uint8_t>() != 0; }
+
+    // \return pointer into the artifact, valid for as long as the artifact is
+    const uint8_t* readBytes(size_t& size) {
+        size = (size_t)readValue<uint64_t>();
+        if (!canRead(size)) {
+            size = 0;
+            return nullptr;
+        }
+        const uint8_t* bytes = _data + _pos;
+        _pos += size;
+        return bytes;
+    }
+
+    QByteArray readByteArray() {
+        size_t size;
+        const uint8_t* bytes = readBytes(size);
+        return QByteArray((const char*)bytes, (int)size);
+    }
+
+    QString readString() {
+        size_t size;
+        const uint8_t* bytes = readBytes(size);
+        return QString::fromUtf8((const char*)bytes, (int)size);
+    }
+
+    std::string readStdString() {
+        size_t size;
+        const uint8_t* bytes = readBytes(size);
+        return size ? std::string((const char*)bytes, size) : std::string();
+    }
+
+    template <typename Container>
+    void readArray(Container& values) {
+        using T = typename Container::value_type;
+        static_assert(std::is_trivially_copyable<T>::value, "only arrays of plain values can be read as is");
+        size_t size;
+        const uint8_t* bytes = readBytes(size);
+        if (size % sizeof(T) != 0) {
+            _valid = false;
+            return;
+        }
+        values.resize((int)(size / sizeof(T)));
+        if (size) {
+            memcpy((void*)values.data(), bytes, size);
+        }
+    }
+
+    Transform readTransform() {
+        Transform transform;
+        transform.setTranslation(readValue<glm::vec3>());
+        transform.setRotation(readValue<glm::quat>());
+        transform.setScale(readValue<glm::vec3>());
+        return transform;
+    }
+
+    Extents readExtents() {
+        Extents extents;
+        extents.minimum = readValue<glm::vec3>();
+        extents.maximum = readValue<glm::vec3>();
+        return extents;
+    }
+
+    QVariantMap readVariantMap() {
+        QByteArray bytes = readByteArray();
+        QVariantMap map;
+        QDataStream stream(bytes);
+        stream >> map;
+        return map;
+    }
+
+    // Guards the allocations made from counts read out of the artifact
+    bool readCount(uint32_t& count, size_t minElementSize) {
+        count = readValue<uint32_t>();
+        if (!canRead((size_t)count * minElementSize)) {
+            count = 0;
+            return false;
+        }
+        return true;
+    }
+
+private:
+    bool canRead(size_t size) {
+        if (!_valid || size > _size - _pos) {
+            _valid = false;
+            return false;
+        }
+        return true;
+    }
+
+    const uint8_t* _data;
+    const size_t _size;
+    size_t _pos { 0 };
+    bool _valid { true };
+};
+
+// The part of a graphics::Material that the serializers set up.  Materials are rebuilt through the same setters, so
+// that the material key comes out the way the serializer left it.
+class MaterialState {
+public:
+    MaterialState() {}
+    MaterialState(const graphics::Material& material) {
+        const auto& flags = material.getKey()._flags;
+        name = material.getName();
+        model = material.getModel();
+        layers = material.getLayers();
+        emissive = material.getEmissive(false);
+        opacity = material.getOpacity();
+        albedo = material.getAlbedo(false);
+        roughness = material.getRoughness();
+        metallic = material.getMetallic();
+        scattering = material.getScattering();
+        opacityCutoff = material.getOpacityCutoff();
+        cullFaceMode = material.getCullFaceMode();
+        opacityMapMode = material.getOpacityMapMode();
+        texCoordTransforms[0] = material.getTexCoordTransform(0);
+        texCoordTransforms[1] = material.getTexCoordTransform(1);
+        hasAlbedo = flags[graphics::MaterialKey::ALBEDO_VAL_BIT];
+        hasOpacityMapMode = flags[graphics::MaterialKey::OPACITY_MAP_MODE_BIT];
+        isUnlit = flags[graphics::MaterialKey::UNLIT_VAL_BIT];
+        defaultFallthrough = material.getDefaultFallthrough();
+    }
+
+    graphics::MaterialPointer build() const {
+        auto material = std::make_shared<graphics::Material>();
+        material->setName(name);
+        material->setModel(model);
+        material->setLayers(layers);
+        material->setEmissive(emissive, false);
+        material->setOpacity(opacity);
+        if (hasAlbedo) {
+            material->setAlbedo(albedo, false);
+        }
+        material->setRoughness(roughness);
+        material->setMetallic(metallic);
+        material->setScattering(scattering);
+        material->setOpacityCutoff(opacityCutoff);
+        material->setCullFaceMode(cullFaceMode);
+        if (hasOpacityMapMode) {
+            material->setOpacityMapMode(opacityMapMode);
+        }
+        material->setUnlit(isUnlit);
+        material->setTexCoordTransform(0, texCoordTransforms[0]);
+        material->setTexCoordTransform(1, texCoordTransforms[1]);
+        material->setDefaultFallthrough(defaultFallthrough);
+        return material;
+    }
+
+    void write(ArtifactWriter& writer) const {
+        writer.writeString(name);
+        writer.writeString(model);
+        writer.writeValue(layers);
+        writer.writeValue(emissive);
+        writer.writeValue(opacity);
+        writer.writeValue(albedo);
+        writer.writeValue(roughness);
+        writer.writeValue(metallic);
+        writer.writeValue(scattering);
+        writer.writeValue(opacityCutoff);
+        writer.writeValue((uint8_t)cullFaceMode);
+        writer.writeValue((uint8_t)opacityMapMode);
+        writer.writeValue(texCoordTransforms[0]);
+        writer.writeValue(texCoordTransforms[1]);
+        writer.writeBool(hasAlbedo);
+        writer.writeBool(hasOpacityMapMode);
+        writer.writeBool(isUnlit);
+        writer.writeBool(defaultFallthrough);
+    }
+
+    void read(ArtifactReader& reader) {
+        name = reader.readStdString();
+        model = reader.readStdString();
+        layers = reader.readValue<uint8_t>();
+        emissive = reader.readValue<glm::vec3>();
+        opacity = reader.readValue<float>();
+        albedo = reader.readValue<glm::vec3>();
+        roughness = reader.readValue<float>();
+        metallic = reader.readValue<float>();
+        scattering = reader.readValue<float>();
+        opacityCutoff = reader.readValue<float>();
+        cullFaceMode = (graphics::MaterialKey::CullFaceMode)reader.readValue<uint8_t>();
+        opacityMapMode = (graphics::MaterialKey::OpacityMapMode)reader.readValue<uint8_t>();
+        texCoordTransforms[0] = reader.readValue<glm::mat4>();
+        texCoordTransforms[1] = reader.readValue<glm::mat4>();
+        hasAlbedo = reader.readBool();
+        hasOpacityMapMode = reader.readBool();
+        isUnlit = reader.readBool();
+        defaultFallthrough = reader.readBool();
+        if (cullFaceMode >= graphics::MaterialKey::NUM_CULL_FACE_MODES || opacityMapMode > graphics::MaterialKey::OPACITY_MAP_BLEND) {
+            reader.invalidate();
+        }
+    }
+
+    std::string name;
+    std::string model;
+    uint8_t layers { 1 };
+    glm::vec3 emissive;
+    float opacity { 1.0f };
+    glm::vec3 albedo;
+    float roughness { 1.0f };
+    float metallic { 0.0f };
+    float scattering { 0.0f };
+    float opacityCutoff { 0.5f };
+    graphics::MaterialKey::CullFaceMode cullFaceMode { graphics::MaterialKey::CULL_BACK };
+    graphics::MaterialKey::OpacityMapMode opacityMapMode { graphics::MaterialKey::OPACITY_MAP_OPAQUE };
+    glm::mat4 texCoordTransforms[2];
+    bool hasAlbedo { false };
+    bool hasOpacityMapMode { false };
+    bool isUnlit { false };
+    bool defaultFallthrough { false };
+};
+
+bool canRebuildMaterial(const graphics::MaterialPointer& material) {
+    if (!material) {
+        return true;
+    }
+    if (typeid(*material) != typeid(graphics::Material) || !material->getTextureMaps().empty() ||
+            material->getLightmapParams() != glm::vec2(0.0f, 1.0f) || material->getMaterialParams() != glm::vec2(0.0f, 1.0f)) {
+        return false;
+    }
+    auto rebuilt = MaterialState(*material).build();
+    return rebuilt->getKey()._flags == material->getKey()._flags;
+}
+
+void writeTexture(ArtifactWriter& writer, const hfm::Texture& texture) {
+    writer.writeString(texture.id);
+    writer.writeString(texture.name);
+    writer.writeByteArray(texture.filename);
+    writer.writeByteArray(texture.content);
+    writer.writeValue((uint8_t)texture.sourceChannel);
+    writer.writeTransform(texture.transform);
+    writer.writeValue((int32_t)texture.maxNumPixels);
+    writer.writeValue((int32_t)texture.texcoordSet);
+    writer.writeString(texture.texcoordSetName);
+    writer.writeBool(texture.isBumpmap);
+    writer.writeValue(texture.sampler.getDesc());
+}
+
+void readTexture(ArtifactReader& reader, hfm::Texture& texture) {
+    texture.id = reader.readString();
+    texture.name = reader.readString();
+    texture.filename = reader.readByteArray();
+    texture.content = reader.readByteArray();
+    texture.sourceChannel = (image::ColorChannel)reader.readValue<uint8_t>();
+    texture.transform = reader.readTransform();
+    texture.maxNumPixels = reader.readValue<int32_t>();
+    texture.texcoordSet = reader.readValue<int32_t>();
+    texture.texcoordSetName = reader.readString();
+    texture.isBumpmap = reader.readBool();
+    texture.sampler = Sampler(reader.readValue<Sampler::Desc>());
+}
+
+// The textures of a material, in a fixed order
+template <typename MaterialType, typename F>
+void forEachTexture(MaterialType& material, F f) {
+    f(material.normalTexture);
+    f(material.albedoTexture);
+    f(material.opacityTexture);
+    f(material.glossTexture);
+    f(material.roughnessTexture);
+    f(material.specularTexture);
+    f(material.metallicTexture);
+    f(material.emissiveTexture);
+    f(material.occlusionTexture);
+    f(material.scatteringTexture);
+    f(material.lightmapTexture);
+    f(material.shadeTexture);
+    f(material.shadingShiftTexture);
+    f(material.matcapTexture);
+    f(material.rimTexture);
+    f(material.uvAnimationTexture);
+}
+
+void writeMaterial(ArtifactWriter& writer, const hfm::Material& material) {
+    writer.writeValue(material.diffuseColor);
+    writer.writeValue(material.diffuseFactor);
+    writer.writeValue(material.specularColor);
+    writer.writeValue(material.specularFactor);
+    writer.writeValue(material.emissiveColor);
+    writer.writeValue(material.emissiveFactor);
+    writer.writeValue(material.shininess);
+    writer.writeValue(material.opacity);
+    writer.writeValue(material.metallic);
+    writer.writeValue(material.roughness);
+    writer.writeValue(material.emissiveIntensity);
+    writer.writeValue(material.ambientFactor);
+    writer.writeValue(material.bumpMultiplier);
+    writer.writeValue((uint8_t)material.alphaMode);
+    writer.writeValue(material.alphaCutoff);
+    writer.writeString(material.materialID);
+    writer.writeString(material.name);
+    writer.writeString(material.shadingModel);
+    forEachTexture(material, [&](const hfm::Texture& texture) {
+        writeTexture(writer, texture);
+    });
+    writer.writeValue(material.lightmapParams);
+    writer.writeBool(material.isPBSMaterial);
+    writer.writeBool(material.useNormalMap);
+    writer.writeBool(material.useAlbedoMap);
+    writer.writeBool(material.useOpacityMap);
+    writer.writeBool(material.useRoughnessMap);
+    writer.writeBool(material.useSpecularMap);
+    writer.writeBool(material.useMetallicMap);
+    writer.writeBool(material.useEmissiveMap);
+    writer.writeBool(material.useOcclusionMap);
+    writer.writeBool(material.isMToonMaterial);
+
+    writer.writeBool((bool)material._material);
+    if (material._material) {
+        MaterialState(*material._material).write(writer);
+    }
+}
+
+void readMaterial(ArtifactReader& reader, hfm::Material& material) {
+    material.diffuseColor = reader.readValue<glm::vec3>();
+    material.diffuseFactor = reader.readValue<float>();
+    material.specularColor = reader.readValue<glm::vec3>();
+    material.specularFactor = reader.readValue<float>();
+    material.emissiveColor = reader.readValue<glm::vec3>();
+    material.emissiveFactor = reader.readValue<float>();
+    material.shininess = reader.readValue<float>();
+    material.opacity = reader.readValue<float>();
+    material.metallic = reader.readValue<float>();
+    material.roughness = reader.readValue<float>();
+    material.emissiveIntensity = reader.readValue<float>();
+    material.ambientFactor = reader.readValue<float>();
+    material.bumpMultiplier = reader.readValue<float>();
+    material.alphaMode = (graphics::MaterialKey::OpacityMapMode)reader.readValue<uint8_t>();
+    material.alphaCutoff = reader.readValue<float>();
+    material.materialID = reader.readString();
+    material.name = reader.readString();
+    material.shadingModel = reader.readString();
+    forEachTexture(material, [&](hfm::Texture& texture) {
+        readTexture(reader, texture);
+    });
+    material.lightmapParams = reader.readValue<glm::vec2>();
+    material.isPBSMaterial = reader.readBool();
+    material.useNormalMap = reader.readBool();
+    material.useAlbedoMap = reader.readBool();
+    material.useOpacityMap = reader.readBool();
+    material.useRoughnessMap = reader.readBool();
+    material.useSpecularMap = reader.readBool();
+    material.useMetallicMap = reader.readBool();
+    material.useEmissiveMap = reader.readBool();
+    material.useOcclusionMap = reader.readBool();
+    material.isMToonMaterial = reader.readBool();
+
+    if (reader.readBool()) {
+        MaterialState state;
+        state.read(reader);
+        material._material = state.build();
+    }
+}
+
+void writeJoint(ArtifactWriter& writer, const hfm::Joint& joint) {
+    writer.writeValue(joint.shapeInfo.avgPoint);
+    writer.writeArray(joint.shapeInfo.dots);
+    writer.writeArray(joint.shapeInfo.points);
+    writer.writeArray(joint.shapeInfo.debugLines);
+    writer.writeValue((int32_t)joint.parentIndex);
+    writer.writeValue(joint.distanceToParent);
+    writer.writeValue(joint.translation);
+    writer.writeValue(joint.preTransform);
+    writer.writeValue(joint.preRotation);
+    writer.writeValue(joint.rotation);
+    writer.writeValue(joint.postRotation);
+    writer.writeValue(joint.postTransform);
+    writer.writeValue(joint.transform);
+    writer.writeValue(joint.rotationMin);
+    writer.writeValue(joint.rotationMax);
+    writer.writeValue(joint.inverseDefaultRotation);
+    writer.writeValue(joint.inverseBindRotation);
+    writer.writeValue(joint.bindTransform);
+    writer.writeString(joint.name);
+    writer.writeBool(joint.isSkeletonJoint);
+    writer.writeBool(joint.bindTransformFoundInCluster);
+    writer.writeBool(joint.hasGeometricOffset);
+    writer.writeValue(joint.geometricTranslation);
+    writer.writeValue(joint.geometricRotation);
+    writer.writeValue(joint.geometricScaling);
+}
+
+void readJoint(ArtifactReader& reader, hfm::Joint& joint) {
+    joint.shapeInfo.avgPoint = reader.readValue<glm::vec3>();
+    reader.readArray(joint.shapeInfo.dots);
+    reader.readArray(joint.shapeInfo.points);
+    reader.readArray(joint.shapeInfo.debugLines);
+    joint.parentIndex = reader.readValue<int32_t>();
+    joint.distanceToParent = reader.readValue<float>();
+    joint.translation = reader.readValue<glm::vec3>();
+    joint.preTransform = reader.readValue<glm::mat4>();
+    joint.preRotation = reader.readValue<glm::quat>();
+    joint.rotation = reader.readValue<glm::quat>();
+    joint.postRotation = reader.readValue<glm::quat>();
+    joint.postTransform = reader.readValue<glm::mat4>();
+    joint.transform = reader.readValue<glm::mat4>();
+    joint.rotationMin = reader.readValue<glm::vec3>();
+    joint.rotationMax = reader.readValue<glm::vec3>();
+    joint.inverseDefaultRotation = reader.readValue<glm::quat>();
+    joint.inverseBindRotation = reader.readValue<glm::quat>();
+    joint.bindTransform = reader.readValue<glm::mat4>();
+    joint.name = reader.readString();
+    joint.isSkeletonJoint = reader.readBool();
+    joint.bindTransformFoundInCluster = reader.readBool();
+    joint.hasGeometricOffset = reader.readBool();
+    joint.geometricTranslation = reader.readValue<glm::vec3>();
+    joint.geometricRotation = reader.readValue<glm::quat>();
+    joint.geometricScaling = reader.readValue<glm::vec3>();
+}
+
+void writeElement(ArtifactWriter& writer, const gpu::Element& element) {
+    writer.writeValue((uint8_t)element.getDimension());
+    writer.writeValue((uint8_t)element.getType());
+    writer.writeValue((uint8_t)element.getSemantic());
+}
+
+gpu::Element readElement(ArtifactReader& reader) {
+    auto dimension = reader.readValue<uint8_t>();
+    auto type = reader.readValue<uint8_t>();
+    auto semantic = reader.readValue<uint8_t>();
+    if (dimension >= gpu::NUM_DIMENSIONS || type >= gpu::NUM_TYPES || semantic >= gpu::NUM_SEMANTICS) {
+        reader.invalidate();
+        return gpu::Element();
+    }
+    return gpu::Element((gpu::Dimension)dimension, (gpu::Type)type, (gpu::Semantic)semantic);
+}
+
+void writeBuffer(ArtifactWriter& writer, const gpu::BufferPointer& buffer) {
+    if (buffer) {
+        writer.writeBytes(buffer->getData(), buffer->getSize());
+    } else {
+        writer.writeBytes(nullptr, 0);
+    }
+}
+
+gpu::BufferPointer readBuffer(ArtifactReader& reader) {
+    size_t size;
+    const uint8_t* bytes = reader.readBytes(size);
+    // The single copy from the mapped artifact into the buffer's sysmem
+    return std::make_shared<gpu::Buffer>(size, bytes);
+}
+
+void writeBufferView(ArtifactWriter& writer, const gpu::BufferView& view) {
+    writer.writeBool((bool)view._buffer);
+    if (!view._buffer) {
+        return;
+    }
+    writeBuffer(writer, view._buffer);
+    writer.writeValue((uint64_t)view._offset);
+    writer.writeValue((uint64_t)view._size);
+    writer.writeValue((uint16_t)view._stride);
+    writeElement(writer, view._element);
+}
+
+gpu::BufferView readBufferView(ArtifactReader& reader) {
+    if (!reader.readBool()) {
+        return gpu::BufferView();
+    }
+    auto buffer = readBuffer(reader);
+    auto offset = reader.readValue<uint64_t>();
+    auto size = reader.readValue<uint64_t>();
+    auto stride = reader.readValue<uint16_t>();
+    auto element = readElement(reader);
+    if (offset + size > buffer->getSize()) {
+        reader.invalidate();
+        return gpu::BufferView();
+    }
+    return gpu::BufferView(buffer, offset, size, stride, element);
+}
+
+void writeGraphicsMesh(ArtifactWriter& writer, const graphics::Mesh& mesh) {
+    writer.writeString(mesh.modelName);
+    writer.writeString(mesh.displayName);
+
+    // Meshes without vertex colors get a per instance color channel from setVertexFormatAndStream(), fed by the mesh's
+    // own color buffer.  It's left out so that reading the mesh back sets it up again, tied to the new mesh's buffer.
+    const auto& vertexFormat = mesh.getVertexFormat();
+    const auto& stream = mesh.getVertexStream();
+    size_t numBuffers = stream.getNumBuffers();
+    bool hasInstanceColor = false;
+    if (vertexFormat->hasAttribute(gpu::Stream::COLOR)) {
+        auto color = vertexFormat->getAttribute(gpu::Stream::COLOR);
+        hasInstanceColor = color._frequency == gpu::Stream::PER_INSTANCE && (size_t)color._channel + 1 == numBuffers &&
+            stream.getBuffers()[color._channel] == mesh.getColorBuffer();
+    }
+    if (hasInstanceColor) {
+        numBuffers--;
+    }
+
+    const auto& attributes = vertexFormat->getAttributes();
+    writer.writeValue((uint32_t)(hasInstanceColor ? attributes.size() - 1 : attributes.size()));
+    for (const auto& attribute : attributes) {
+        if (hasInstanceColor && attribute.first == gpu::Stream::COLOR) {
+            continue;
+        }
+        writer.writeValue((uint8_t)attribute.second._slot);
+        writer.writeValue((uint8_t)attribute.second._channel);
+        writeElement(writer, attribute.second._element);
+        writer.writeValue((uint64_t)attribute.second._offset);
+        writer.writeValue((uint32_t)attribute.second._frequency);
+    }
+
+    writer.writeValue((uint32_t)numBuffers);
+    for (size_t i = 0; i < numBuffers; i++) {
+        writeBuffer(writer, stream.getBuffers()[i]);
+        writer.writeValue((uint64_t)stream.getOffsets()[i]);
+        writer.writeValue((uint64_t)stream.getStrides()[i]);
+    }
+
+    writeBufferView(writer, mesh.getIndexBuffer());
+    writeBufferView(writer, mesh.getPartBuffer());
+}
+
+graphics::MeshPointer readGraphicsMesh(ArtifactReader& reader) {
+    auto mesh = std::make_shared<graphics::Mesh>();
+    mesh->modelName = reader.readStdString();
+    mesh->displayName = reader.readStdString();
+
+    auto vertexFormat = std::make_shared<gpu::Stream::Format>();
+    uint32_t numAttributes;
+    reader.readCount(numAttributes, 1);
+    for (uint32_t i = 0; i < numAttributes && reader.isValid(); i++) {
+        auto slot = reader.readValue<uint8_t>();
+        auto channel = reader.readValue<uint8_t>();
+        auto element = readElement(reader);
+        auto offset = reader.readValue<uint64_t>();
+        auto frequency = reader.readValue<uint32_t>();
+        vertexFormat->setAttribute(slot, channel, element, (gpu::Offset)offset, (gpu::Stream::Frequency)frequency);
+    }
+
+    auto vertexStream = std::make_shared<gpu::BufferStream>();
+    uint32_t numBuffers;
+    reader.readCount(numBuffers, 1);
+    for (uint32_t i = 0; i < numBuffers && reader.isValid(); i++) {
+        auto buffer = readBuffer(reader);
+        auto offset = reader.readValue<uint64_t>();
+        auto stride = reader.readValue<uint64_t>();
+        vertexStream->addBuffer(buffer, (gpu::Offset)offset, (gpu::Offset)stride);
+    }
+    if (!reader.isValid()) {
+        return nullptr;
+    }
+    mesh->setVertexFormatAndStream(vertexFormat, vertexStream);
+
+    mesh->setIndexBuffer(readBufferView(reader));
+    mesh->setPartBuffer(readBufferView(reader));
+    return reader.isValid() ? mesh : nullptr;
+}
+
+void writeMesh(ArtifactWriter& writer, const hfm::Mesh& mesh) {
+    writer.writeValue((uint32_t)mesh.parts.size());
+    for (const auto& part : mesh.parts) {
+        writer.writeArray(part.quadIndices);
+        writer.writeArray(part.quadTrianglesIndices);
+        writer.writeArray(part.triangleIndices);
+        writer.writeString(part.materialID);
+    }
+
+    writer.writeArray(mesh.vertices);
+    writer.writeArray(mesh.normals);
+    writer.writeArray(mesh.tangents);
+    writer.writeArray(mesh.colors);
+    writer.writeArray(mesh.texCoords);
+    writer.writeArray(mesh.texCoords1);
+    writer.writeArray(mesh.clusterIndices);
+    writer.writeArray(mesh.clusterWeights);
+    writer.writeArray(mesh.originalIndices);
+
+    writer.writeValue((uint32_t)mesh.clusters.size());
+    for (const auto& cluster : mesh.clusters) {
+        writer.writeValue((int32_t)cluster.jointIndex);
+        writer.writeValue(cluster.inverseBindMatrix);
+        writer.writeTransform(cluster.inverseBindTransform);
+    }
+
+    writer.writeExtents(mesh.meshExtents);
+    writer.writeValue(mesh.modelTransform);
+
+    writer.writeValue((uint32_t)mesh.blendshapes.size());
+    for (const auto& blendshape : mesh.blendshapes) {
+        writer.writeArray(blendshape.indices);
+        writer.writeArray(blendshape.vertices);
+        writer.writeArray(blendshape.normals);
+        writer.writeArray(blendshape.tangents);
+    }
+
+    writer.writeValue((uint32_t)mesh.meshIndex);
+    writer.writeBool(mesh.wasCompressed);
+    writer.writeBool((bool)mesh._mesh);
+    if (mesh._mesh) {
+        writeGraphicsMesh(writer, *mesh._mesh);
+    }
+}
+
+void readMesh(ArtifactReader& reader, hfm::Mesh& mesh) {
+    uint32_t numParts;
+    reader.readCount(numParts, 1);
+    mesh.parts.resize(numParts);
+    for (auto& part : mesh.parts) {
+        reader.readArray(part.quadIndices);
+        reader.readArray(part.quadTrianglesIndices);
+        reader.readArray(part.triangleIndices);
+        part.materialID = reader.readString();
+    }
+
+    reader.readArray(mesh.vertices);
+    reader.readArray(mesh.normals);
+    reader.readArray(mesh.tangents);
+    reader.readArray(mesh.colors);
+    reader.readArray(mesh.texCoords);
+    reader.readArray(mesh.texCoords1);
+    reader.readArray(mesh.clusterIndices);
+    reader.readArray(mesh.clusterWeights);
+    reader.readArray(mesh.originalIndices);
+
+    uint32_t numClusters;
+    reader.readCount(numClusters, 1);
+    mesh.clusters.resize(numClusters);
+    for (auto& cluster : mesh.clusters) {
+        cluster.jointIndex = reader.readValue<int32_t>();
+        cluster.inverseBindMatrix = reader.readValue<glm::mat4>();
+        cluster.inverseBindTransform = reader.readTransform();
+    }
+
+    mesh.meshExtents = reader.readExtents();
+    mesh.modelTransform = reader.readValue<glm::mat4>();
+
+    uint32_t numBlendshapes;
+    reader.readCount(numBlendshapes, 1);
+    mesh.blendshapes.resize(numBlendshapes);
+    for (auto& blendshape : mesh.blendshapes) {
+        reader.readArray(blendshape.indices);
+        reader.readArray(blendshape.vertices);
+        reader.readArray(blendshape.normals);
+        reader.readArray(blendshape.tangents);
+    }
+
+    mesh.meshIndex = reader.readValue<uint32_t>();
+    mesh.wasCompressed = reader.readBool();
+    if (reader.readBool() && reader.isValid()) {
+        mesh._mesh = readGraphicsMesh(reader);
+    }
+}
+
+}
+
+bool canWriteModelArtifact(const hfm::Model& hfmModel) {
+    for (const auto& material : hfmModel.materials) {
+        if (!canRebuildMaterial(material._material)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+QByteArray writeModelArtifact(const hfm::Model& hfmModel) {
+    if (!canWriteModelArtifact(hfmModel)) {
+        return QByteArray();
+    }
+
+    ArtifactWriter writer;
+    writer.writeString(hfmModel.originalURL);
+    writer.writeString(hfmModel.author);
+    writer.writeString(hfmModel.applicationName);
+
+    writer.writeValue((uint32_t)hfmModel.joints.size());
+    for (const auto& joint : hfmModel.joints) {
+        writeJoint(writer, joint);
+    }
+    // Hashes are written in key order, so that the same model always gives the same artifact
+    auto jointNames = hfmModel.jointIndices.keys();
+    std::sort(jointNames.begin(), jointNames.end());
+    writer.writeValue((uint32_t)jointNames.size());
+    for (const auto& jointName : jointNames) {
+        writer.writeString(jointName);
+        writer.writeValue((int32_t)hfmModel.jointIndices.value(jointName));
+    }
+    writer.writeBool(hfmModel.hasSkeletonJoints);
+
+    writer.writeValue((uint32_t)hfmModel.meshes.size());
+    for (const auto& mesh : hfmModel.meshes) {
+        writeMesh(writer, mesh);
+    }
+
+    writer.writeValue((uint32_t)hfmModel.scripts.size());
+    for (const auto& script : hfmModel.scripts) {
+        writer.writeString(script);
+    }
+
+    auto materialIDs = hfmModel.materials.keys();
+    std::sort(materialIDs.begin(), materialIDs.end());
+    writer.writeValue((uint32_t)materialIDs.size());
+    for (const auto& materialID : materialIDs) {
+        writer.writeString(materialID);
+        writeMaterial(writer, *hfmModel.materials.find(materialID));
+    }
+
+    writer.writeValue(hfmModel.offset);
+    writer.writeValue(hfmModel.neckPivot);
+    writer.writeExtents(hfmModel.bindExtents);
+    writer.writeExtents(hfmModel.meshExtents);
+
+    writer.writeValue((uint32_t)hfmModel.animationFrames.size());
+    for (const auto& frame : hfmModel.animationFrames) {
+        writer.writeArray(frame.rotations);
+        writer.writeArray(frame.translations);
+    }
+
+    auto meshIndices = hfmModel.meshIndicesToModelNames.keys();
+    std::sort(meshIndices.begin(), meshIndices.end());
+    writer.writeValue((uint32_t)meshIndices.size());
+    for (int meshIndex : meshIndices) {
+        writer.writeValue((int32_t)meshIndex);
+        writer.writeString(hfmModel.meshIndicesToModelNames.value(meshIndex));
+    }
+
+    writer.writeValue((uint32_t)hfmModel.blendshapeChannelNames.size());
+    for (const auto& name : hfmModel.blendshapeChannelNames) {
+        writer.writeString(name);
+    }
+
+    writer.writeValue((uint32_t)hfmModel.jointRotationOffsets.size());
+    for (auto it = hfmModel.jointRotationOffsets.cbegin(); it != hfmModel.jointRotationOffsets.cend(); ++it) {
+        writer.writeValue((int32_t)it.key());
+        writer.writeValue(it.value());
+    }
+
+    writer.writeValue((uint32_t)hfmModel.shapeVertices.size());
+    for (const auto& shapeVertices : hfmModel.shapeVertices) {
+        writer.writeArray(shapeVertices);
+    }
+
+    writer.writeVariantMap(hfmModel.flowData._physicsConfig);
+    writer.writeVariantMap(hfmModel.flowData._collisionsConfig);
+
+    writer.writeValue((int32_t)hfmModel.loadWarningCount);
+    writer.writeValue((int32_t)hfmModel.loadErrorCount);
+    return writer.data();
+}
+
+hfm::Model::Pointer readModelArtifact(const uint8_t* data, size_t size) {
+    ArtifactReader reader(data, size);
+    auto hfmModel = std::make_shared<hfm::Model>();
+    hfmModel->originalURL = reader.readString();
+    hfmModel->author = reader.readString();
+    hfmModel->applicationName = reader.readString();
+
+    uint32_t count;
+    reader.readCount(count, 1);
+    hfmModel->joints.resize(count);
+    for (auto& joint : hfmModel->joints) {
+        readJoint(reader, joint);
+    }
+    reader.readCount(count, 1);
+    for (uint32_t i = 0; i < count && reader.isValid(); i++) {
+        auto name = reader.readString();
+        hfmModel->jointIndices.insert(name, reader.readValue<int32_t>());
+    }
+    hfmModel->hasSkeletonJoints = reader.readBool();
+
+    reader.readCount(count, 1);
+    hfmModel->meshes.resize(count);
+    for (auto& mesh : hfmModel->meshes) {
+        if (!reader.isValid()) {
+            break;
+        }
+        readMesh(reader, mesh);
+    }
+
+    reader.readCount(count, 1);
+    for (uint32_t i = 0; i < count && reader.isValid(); i++) {
+        hfmModel->scripts.push_back(reader.readString());
+    }
+
+    reader.readCount(count, 1);
+    for (uint32_t i = 0; i < count && reader.isValid(); i++) {
+        auto materialID = reader.readString();
+        readMaterial(reader, hfmModel->materials[materialID]);
+    }
+
+    hfmModel->offset = reader.readValue<glm::mat4>();
+    hfmModel->neckPivot = reader.readValue<glm::vec3>();
+    hfmModel->bindExtents = reader.readExtents();
+    hfmModel->meshExtents = reader.readExtents();
+
+    reader.readCount(count, 1);
+    hfmModel->animationFrames.resize(count);
+    for (auto& frame : hfmModel->animationFrames) {
+        reader.readArray(frame.rotations);
+        reader.readArray(frame.translations);
+    }
+
+    reader.readCount(count, 1);
+    for (uint32_t i = 0; i < count && reader.isValid(); i++) {
+        auto meshIndex = reader.readValue<int32_t>();
+        hfmModel->meshIndicesToModelNames.insert(meshIndex, reader.readString());
+    }
+
+    reader.readCount(count, 1);
+    for (uint32_t i = 0; i < count && reader.isValid(); i++) {
+        hfmModel->blendshapeChannelNames.push_back(reader.readString());
+    }
+
+    reader.readCount(count, 1);
+    for (uint32_t i = 0; i < count && reader.isValid(); i++) {
+        auto jointIndex = reader.readValue<int32_t>();
+        hfmModel->jointRotationOffsets.insert(jointIndex, reader.readValue<glm::quat>());
+    }
+
+    reader.readCount(count, 1);
+    hfmModel->shapeVertices.resize(count);
+    for (auto& shapeVertices : hfmModel->shapeVertices) {
+        reader.readArray(shapeVertices);
+    }
+
+    hfmModel->flowData._physicsConfig = reader.readVariantMap();
+    hfmModel->flowData._collisionsConfig = reader.readVariantMap();
+
+    hfmModel->loadWarningCount = reader.readValue<int32_t>();
+    hfmModel->loadErrorCount = reader.readValue<int32_t>();
+
+    if (!reader.isValid() || !reader.atEnd()) {
+        qCWarning(model_baker) << "Ignoring invalid model artifact for" << hfmModel->originalURL;
+        return nullptr;
+    }
+    return hfmModel;
+}
+
+};
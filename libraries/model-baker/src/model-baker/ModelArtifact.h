@@ -0,0 +1,39 @@
+//
+//  ModelArtifact.h
+//  model-baker/src/model-baker
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_baker_ModelArtifact_h
+#define hifi_baker_ModelArtifact_h
+
+#include <QtCore/QByteArray>
+
+#include <hfm/HFM.h>
+
+namespace baker {
+    // A model artifact is the binary form of the Baker's output hfm::Model, including the graphics::Mesh of every mesh,
+    // so a model seen before can be rebuilt without running the serializer or the Baker.  The vertex, index and part
+    // buffers are stored exactly as the GPU consumes them and are copied into their gpu::Buffer in one go.
+    //
+    // Bump MODEL_ARTIFACT_VERSION whenever the layout below, the serializers or the baker's output change.
+    extern const uint32_t MODEL_ARTIFACT_TYPE;
+    extern const uint32_t MODEL_ARTIFACT_VERSION;
+
+    // Only plain graphics::Materials set up through their public setters can be rebuilt; models using other material
+    // types (MToon for example) can't be stored as artifacts.
+    bool canWriteModelArtifact(const hfm::Model& hfmModel);
+
+    /// \return the artifact for hfmModel, or an empty array if canWriteModelArtifact() is false
+    QByteArray writeModelArtifact(const hfm::Model& hfmModel);
+
+    /// \return the model stored in the artifact, or nullptr if the artifact is truncated or otherwise invalid
+    hfm::Model::Pointer readModelArtifact(const uint8_t* data, size_t size);
+};
+
+#endif // hifi_baker_ModelArtifact_h
@@ -27,6 +27,9 @@ public:
     using JobModel = baker::Job::ModelIO<ParseMaterialMappingTask, Input, Output>;
 
     void run(const baker::BakeContextPointer& context, const Input& input, Output& output);
+
+    // Also used when the model itself comes from an artifact and the baker doesn't run
+    static MaterialMapping parse(const hifi::VariantHash& mapping, const hifi::URL& url);
 };
 
 #endif // hifi_ParseMaterialMappingTask_h
\ No newline at end of file
@@ -16,6 +16,8 @@
 #include <gpu/Batch.h>
 #include <gpu/Stream.h>
 
+#include <QJsonArray>
+#include <QJsonDocument>
 #include <QThreadPool>
 
 #include <Gzip.h>
@@ -28,6 +30,9 @@
 #include <OBJSerializer.h>
 #include <GLTFSerializer.h>
 #include <model-baker/Baker.h>
+#include <model-baker/ModelArtifact.h>
+#include <model-baker/ParseMaterialMappingTask.h>
+#include <ArtifactCache.h>
 
 Q_LOGGING_CATEGORY(trace_resource_parse_geometry, "trace.resource.parse.geometry")
 
@@ -106,6 +111,33 @@ private:
     QString _webMediaType;
 };
 
+// Only formats that keep everything in the one file are cached; .gltf and .obj models can pull in buffers and materials
+// that could change without the model's own data changing.
+static bool canCacheModelArtifact(const QUrl& url) {
+    QString path = url.path().toLower();
+    if (path.endsWith(".gz")) {
+        path.chop(3);
+    }
+    return path.endsWith(".fbx") || path.endsWith(".glb");
+}
+
+// Everything other than the data that the baked model depends on.  The mapping is written out with sorted keys, since
+// QHash iteration order differs between runs.
+static QByteArray getModelArtifactVariant(const QUrl& url, const GeometryMappingPair& mapping, bool combineParts,
+                                          const QString& webMediaType) {
+    QByteArray variant = url.toEncoded();
+    variant.append('\n').append(mapping.first.toEncoded());
+    variant.append('\n').append(webMediaType.toUtf8());
+    variant.append('\n').append(combineParts ? '1' : '0');
+    auto keys = mapping.second.uniqueKeys();
+    std::sort(keys.begin(), keys.end());
+    for (const auto& key : keys) {
+        QJsonArray values = QJsonArray::fromVariantList(mapping.second.values(key));
+        variant.append('\n').append(key.toUtf8()).append('=').append(QJsonDocument(values).toJson(QJsonDocument::Compact));
+    }
+    return variant;
+}
+
 void GeometryReader::run() {
     DependencyManager::get<StatTracker>()->decrementStat("PendingProcessing");
     CounterStat counter("Processing");
@@ -139,6 +171,22 @@ void GeometryReader::run() {
             throw QString("url is invalid");
         }
 
+        std::string artifactKey;
+        if (canCacheModelArtifact(_url)) {
+            artifactKey = ArtifactCache::computeKey(baker::MODEL_ARTIFACT_TYPE, baker::MODEL_ARTIFACT_VERSION, _data,
+                getModelArtifactVariant(_url, _mapping, _combineParts, _webMediaType));
+            auto artifact = resource->loadArtifact(artifactKey, baker::MODEL_ARTIFACT_TYPE, baker::MODEL_ARTIFACT_VERSION);
+            if (artifact) {
+                auto artifactHFMModel = baker::readModelArtifact(artifact->data(), artifact->size());
+                if (artifactHFMModel) {
+                    auto materialMapping = ParseMaterialMappingTask::parse(_mapping.second, _mapping.first);
+                    QMetaObject::invokeMethod(resource.data(), "setGeometryDefinition",
+                            Q_ARG(HFMModel::Pointer, artifactHFMModel), Q_ARG(MaterialMapping, materialMapping));
+                    return;
+                }
+            }
+        }
+
         HFMModel::Pointer hfmModel;
         QMultiHash<QString, QVariant> serializerMapping = _mapping.second;
         serializerMapping.replace("combineParts",_combineParts);
@@ -181,6 +229,13 @@ void GeometryReader::run() {
         auto processedHFMModel = modelBaker.getHFMModel();
         auto materialMapping = modelBaker.getMaterialMapping();
 
+        if (!artifactKey.empty()) {
+            QByteArray artifact = baker::writeModelArtifact(*processedHFMModel);
+            if (!artifact.isEmpty()) {
+                resource->saveArtifact(artifactKey, baker::MODEL_ARTIFACT_TYPE, baker::MODEL_ARTIFACT_VERSION, artifact);
+            }
+        }
+
         QMetaObject::invokeMethod(resource.data(), "setGeometryDefinition",
                 Q_ARG(HFMModel::Pointer, processedHFMModel), Q_ARG(MaterialMapping, materialMapping));
     } catch (const std::exception&) {
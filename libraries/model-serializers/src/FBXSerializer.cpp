@@ -22,6 +22,7 @@
 #include <BlendshapeConstants.h>
 
 #include <hfm/ModelFormatLogging.h>
+#include <TBBHelpers.h>
 
 // TOOL: Uncomment the following line to enable the filtering of all the unknown fields of a node so we can break point easily while loading a model with problems...
 //#define DEBUG_FBXSERIALIZER
@@ -457,6 +458,28 @@ HFMModel* FBXSerializer::extractHFMModel(const hifi::VariantHash& mapping, const
     int fbxVersionNumber = -1;
     bool isBlenderVersionLower280 = false;
 
+    // Extracting a Geometry node's mesh, including its vertex deduplication, doesn't depend on anything else in the
+    // file, so they are all extracted on the TBB workers first.  The pass below picks them up in file order.
+    std::vector<const FBXNode*> geometryMeshNodes;
+    for (const FBXNode& child : node.children) {
+        if (child.name == "Objects") {
+            for (const FBXNode& object : child.children) {
+                if (object.name == "Geometry" && object.properties.at(2) == "Mesh") {
+                    geometryMeshNodes.push_back(&object);
+                }
+            }
+        }
+    }
+    std::vector<ExtractedMesh> geometryMeshes(geometryMeshNodes.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, geometryMeshNodes.size(), 1), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i < range.end(); i++) {
+            // The mesh index is assigned in file order below
+            unsigned int unusedMeshIndex = 0;
+            geometryMeshes[i] = extractMesh(*geometryMeshNodes[i], unusedMeshIndex, deduplicateIndices);
+        }
+    });
+    size_t nextGeometryMesh = 0;
+
     foreach (const FBXNode& child, node.children) {
         if (child.name == "Creator") {
             // Match Blender version lower than 2.80
@@ -534,7 +557,9 @@ HFMModel* FBXSerializer::extractHFMModel(const hifi::VariantHash& mapping, const
             foreach (const FBXNode& object, child.children) {
                 if (object.name == "Geometry") {
                     if (object.properties.at(2) == "Mesh") {
-                        meshes.insert(getID(object.properties), extractMesh(object, meshIndex, deduplicateIndices));
+                        ExtractedMesh& extracted = geometryMeshes[nextGeometryMesh++];
+                        extracted.mesh.meshIndex = meshIndex++;
+                        meshes.insert(getID(object.properties), std::move(extracted));
                     } else { // object.properties.at(2) == "Shape"
                         ExtractedBlendshape extracted = { getID(object.properties), extractBlendshape(object) };
                         blendshapes.append(extracted);
@@ -32,10 +32,12 @@
 #include <qfileinfo.h>
 
 #include <sstream>
+#include <unordered_set>
 
 #include <glm/gtx/transform.hpp>
 
 #include <shared/NsightHelpers.h>
+#include <TBBHelpers.h>
 #include <NetworkAccessManager.h>
 #include <ResourceManager.h>
 #include <PathUtils.h>
@@ -188,6 +190,86 @@ bool findAttribute(const QString &name, const cgltf_attribute *attributes, size_
     return false;
 }
 
+void GLTFSerializer::decodeMeshAccessors() {
+    // Unpacking the vertex attributes and indices dominates the time spent building the meshes of large models, and
+    // each accessor unpacks independently, so they are all decoded up front on the TBB workers.  buildGeometry()
+    // then picks up the results in its usual order.
+    std::vector<cgltf_accessor*> floatAccessors;
+    std::vector<cgltf_accessor*> indexAccessors;
+    std::unordered_set<cgltf_accessor*> seen;
+    for (size_t meshIndex = 0; meshIndex < _data->meshes_count; meshIndex++) {
+        const auto& mesh = _data->meshes[meshIndex];
+        for (size_t primitiveIndex = 0; primitiveIndex < mesh.primitives_count; primitiveIndex++) {
+            const auto& primitive = mesh.primitives[primitiveIndex];
+            if (primitive.indices && seen.insert(primitive.indices).second) {
+                indexAccessors.push_back(primitive.indices);
+            }
+            for (size_t attributeIndex = 0; attributeIndex < primitive.attributes_count; attributeIndex++) {
+                const auto& attribute = primitive.attributes[attributeIndex];
+                // Joints are read as integers, everything else we use is unpacked as floats
+                if (attribute.data && attribute.type != cgltf_attribute_type_joints && seen.insert(attribute.data).second) {
+                    floatAccessors.push_back(attribute.data);
+                }
+            }
+        }
+    }
+
+    std::vector<QVector<float>> floats(floatAccessors.size());
+    std::vector<QVector<int>> indices(indexAccessors.size());
+    const size_t numAccessors = floatAccessors.size() + indexAccessors.size();
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numAccessors, 1), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i < range.end(); i++) {
+            if (i < floatAccessors.size()) {
+                auto accessor = floatAccessors[i];
+                size_t floatCount = accessor->count * cgltf_num_components(accessor->type);
+                floats[i].resize((int)floatCount);
+                if (cgltf_accessor_unpack_floats(accessor, floats[i].data(), floatCount) != floatCount) {
+                    // Leave it to buildGeometry() to report the error
+                    floats[i].clear();
+                }
+            } else {
+                auto accessor = indexAccessors[i - floatAccessors.size()];
+                auto& accessorIndices = indices[i - floatAccessors.size()];
+                accessorIndices.resize((int)accessor->count);
+                if (cgltf_accessor_unpack_indices(accessor, accessorIndices.data(), sizeof(unsigned int), accessor->count) != accessor->count) {
+                    accessorIndices.clear();
+                }
+            }
+        }
+    });
+
+    for (size_t i = 0; i < floatAccessors.size(); i++) {
+        if (!floats[i].isEmpty()) {
+            _decodedFloats.emplace(floatAccessors[i], std::move(floats[i]));
+        }
+    }
+    for (size_t i = 0; i < indexAccessors.size(); i++) {
+        if (!indices[i].isEmpty()) {
+            _decodedIndices.emplace(indexAccessors[i], std::move(indices[i]));
+        }
+    }
+}
+
+size_t GLTFSerializer::unpackFloats(const cgltf_accessor* accessor, QVector<float>& values, size_t floatCount) {
+    auto decoded = _decodedFloats.find(accessor);
+    if (decoded != _decodedFloats.end() && (size_t)decoded->second.size() == floatCount) {
+        values = decoded->second;
+        return floatCount;
+    }
+    values.resize((int)floatCount);
+    return cgltf_accessor_unpack_floats(accessor, values.data(), floatCount);
+}
+
+size_t GLTFSerializer::unpackIndices(const cgltf_accessor* accessor, QVector<int>& indices) {
+    auto decoded = _decodedIndices.find(accessor);
+    if (decoded != _decodedIndices.end()) {
+        indices = decoded->second;
+        return (size_t)indices.size();
+    }
+    indices.resize((int)accessor->count);
+    return cgltf_accessor_unpack_indices(accessor, indices.data(), sizeof(unsigned int), accessor->count);
+}
+
 bool GLTFSerializer::buildGeometry(HFMModel& hfmModel, const hifi::VariantHash& mapping, const hifi::URL& url) {
     hfmModel.originalURL = url.toString();
 
@@ -391,6 +473,7 @@ bool GLTFSerializer::buildGeometry(HFMModel& hfmModel, const hifi::VariantHash&
 
 
     // Build meshes
+    decodeMeshAccessors();
     int nodeCount = 0;
     hfmModel.meshExtents.reset();
     for (int nodeIndex : sortedNodes) {
@@ -465,8 +548,7 @@ bool GLTFSerializer::buildGeometry(HFMModel& hfmModel, const hifi::VariantHash&
                 QVector<float> weights;
                 int weightStride = 4;
 
-                indices.resize((int)indicesAccessor->count);
-                size_t readIndicesCount = cgltf_accessor_unpack_indices(indicesAccessor, indices.data(), sizeof(unsigned int), indicesAccessor->count);
+                size_t readIndicesCount = unpackIndices(indicesAccessor, indices);
 
                 if (readIndicesCount != indicesAccessor->count) {
                     qWarning(modelformat) << "There was a problem reading glTF INDICES data for model " << _url;
@@ -504,8 +586,7 @@ bool GLTFSerializer::buildGeometry(HFMModel& hfmModel, const hifi::VariantHash&
                             continue;
                         }
 
-                        vertices.resize(accessorCount * 3);
-                        size_t floatCount = cgltf_accessor_unpack_floats(accessor, vertices.data(), accessor->count * 3);
+                        size_t floatCount = unpackFloats(accessor, vertices, accessor->count * 3);
                         if (floatCount != accessor->count * 3) {
                             qWarning(modelformat) << "There was a problem reading glTF POSITION data for model " << _url;
                             hfmModel.loadErrorCount++;
@@ -518,8 +599,7 @@ bool GLTFSerializer::buildGeometry(HFMModel& hfmModel, const hifi::VariantHash&
                             continue;
                         }
 
-                        normals.resize(accessorCount * 3);
-                        size_t floatCount = cgltf_accessor_unpack_floats(accessor, normals.data(), accessor->count * 3);
+                        size_t floatCount = unpackFloats(accessor, normals, accessor->count * 3);
                         if (floatCount != accessor->count * 3) {
                             qWarning(modelformat) << "There was a problem reading glTF NORMAL data for model " << _url;
                             hfmModel.loadErrorCount++;
@@ -536,8 +616,7 @@ bool GLTFSerializer::buildGeometry(HFMModel& hfmModel, const hifi::VariantHash&
                             continue;
                         }
 
-                        tangents.resize(accessorCount * tangentStride);
-                        size_t floatCount = cgltf_accessor_unpack_floats(accessor, tangents.data(), accessor->count * tangentStride);
+                        size_t floatCount = unpackFloats(accessor, tangents, accessor->count * tangentStride);
                         if (floatCount != accessor->count * tangentStride) {
                             qWarning(modelformat) << "There was a problem reading glTF TANGENT data for model " << _url;
                             hfmModel.loadErrorCount++;
@@ -551,8 +630,7 @@ bool GLTFSerializer::buildGeometry(HFMModel& hfmModel, const hifi::VariantHash&
                             continue;
                         }
 
-                        texcoords.resize(accessorCount * 2);
-                        size_t floatCount = cgltf_accessor_unpack_floats(accessor, texcoords.data(), accessor->count * 2);
+                        size_t floatCount = unpackFloats(accessor, texcoords, accessor->count * 2);
                         if (floatCount != accessor->count * 2) {
                             qWarning(modelformat) << "There was a problem reading glTF TEXCOORD_0 data for model " << _url;
                             hfmModel.loadErrorCount++;
@@ -565,8 +643,7 @@ bool GLTFSerializer::buildGeometry(HFMModel& hfmModel, const hifi::VariantHash&
                             continue;
                         }
 
-                        texcoords2.resize(accessorCount * 2);
-                        size_t floatCount = cgltf_accessor_unpack_floats(accessor, texcoords2.data(), accessor->count * 2);
+                        size_t floatCount = unpackFloats(accessor, texcoords2, accessor->count * 2);
                         if (floatCount != accessor->count * 2) {
                             qWarning(modelformat) << "There was a problem reading glTF TEXCOORD_1 data for model " << _url;
                             hfmModel.loadErrorCount++;
@@ -583,8 +660,7 @@ bool GLTFSerializer::buildGeometry(HFMModel& hfmModel, const hifi::VariantHash&
                             continue;
                         }
 
-                        colors.resize(accessorCount * colorStride);
-                        size_t floatCount = cgltf_accessor_unpack_floats(accessor, colors.data(), accessor->count * colorStride);
+                        size_t floatCount = unpackFloats(accessor, colors, accessor->count * colorStride);
                         if (floatCount != accessor->count * colorStride) {
                             qWarning(modelformat) << "There was a problem reading glTF COLOR_0 data for model " << _url;
                             hfmModel.loadErrorCount++;
@@ -629,8 +705,7 @@ bool GLTFSerializer::buildGeometry(HFMModel& hfmModel, const hifi::VariantHash&
                             continue;
                         }
 
-                        weights.resize(accessorCount * weightStride);
-                        size_t floatCount = cgltf_accessor_unpack_floats(accessor, weights.data(), accessor->count * weightStride);
+                        size_t floatCount = unpackFloats(accessor, weights, accessor->count * weightStride);
                         if (floatCount != accessor->count * weightStride) {
                             qWarning(modelformat) << "There was a problem reading glTF WEIGHTS_0 data for model " << _url;
                             hfmModel.loadErrorCount++;
@@ -1205,6 +1280,8 @@ HFMModel::Pointer GLTFSerializer::read(const hifi::ByteArray& data, const hifi::
     auto hfmModelPtr = std::make_shared<HFMModel>();
     HFMModel& hfmModel = *hfmModelPtr;
     buildGeometry(hfmModel, mapping, _url);
+    _decodedFloats.clear();
+    _decodedIndices.clear();
 
     return hfmModelPtr;
 }
@@ -15,6 +15,7 @@
 #define hifi_GLTFSerializer_h
 
 #include <memory.h>
+#include <unordered_map>
 #include <QtNetwork/QNetworkReply>
 #include <hfm/ModelFormatLogging.h>
 #include <hfm/HFMSerializer.h>
@@ -38,11 +39,16 @@ private:
     cgltf_data* _data {nullptr};
     hifi::URL _url;
     QVector<hifi::ByteArray> _externalData;
+    std::unordered_map<const cgltf_accessor*, QVector<float>> _decodedFloats;
+    std::unordered_map<const cgltf_accessor*, QVector<int>> _decodedIndices;
 
     glm::mat4 getModelTransform(const cgltf_node& node);
     bool getSkinInverseBindMatrices(std::vector<std::vector<float>>& inverseBindMatrixValues);
     bool generateTargetData(cgltf_accessor *accessor, float weight, QVector<glm::vec3>& returnVector);
 
+    void decodeMeshAccessors();
+    size_t unpackFloats(const cgltf_accessor* accessor, QVector<float>& values, size_t floatCount);
+    size_t unpackIndices(const cgltf_accessor* accessor, QVector<int>& indices);
     bool buildGeometry(HFMModel& hfmModel, const hifi::VariantHash& mapping, const hifi::URL& url);
 
     bool readBinary(const QString& url, cgltf_buffer &buffer);
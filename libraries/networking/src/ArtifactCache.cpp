@@ -0,0 +1,117 @@
+//
+//  ArtifactCache.cpp
+//  libraries/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ArtifactCache.h"
+
+#include <cstring>
+
+#include <QtCore/QCryptographicHash>
+
+#include <SettingHandle.h>
+
+#include "NetworkLogging.h"
+
+const int ArtifactCache::CURRENT_VERSION = 0x01;
+const int ArtifactCache::INVALID_VERSION = 0x00;
+const char* ArtifactCache::SETTING_VERSION_NAME = "hifi.artifact.cache_version";
+const std::string ArtifactCache::DIRNAME { "artifact_cache" };
+const std::string ArtifactCache::EXTENSION { "artifact" };
+
+const uint32_t ARTIFACT_CACHE_MAGIC = 0x46545241; // "ARTF"
+
+struct ArtifactCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t type;
+    uint32_t typeVersion;
+    uint64_t payloadSize;
+    uint32_t payloadOffset;
+    uint32_t reserved;
+};
+static_assert(sizeof(ArtifactCacheHeader) % 16 == 0, "artifact payloads must stay 16 byte aligned");
+
+// Keeps the cache file in use, so it can't be evicted, for as long as its mapping is alive
+class ArtifactStorage : public storage::Storage {
+public:
+    ArtifactStorage(const cache::FilePointer& file, const storage::StoragePointer& mapped, size_t offset, size_t size) :
+        _file(file), _mapped(mapped), _offset(offset), _size(size) {}
+
+    const uint8_t* data() const override { return _mapped->data() + _offset; }
+    uint8_t* mutableData() override { throw std::runtime_error("Cannot modify ArtifactStorage"); }
+    size_t size() const override { return _size; }
+    operator bool() const override { return *_mapped; }
+
+private:
+    const cache::FilePointer _file;
+    const storage::StoragePointer _mapped;
+    const size_t _offset;
+    const size_t _size;
+};
+
+ArtifactCache::ArtifactCache(const std::string& dirname) :
+    FileCache(dirname, EXTENSION) { }
+
+void ArtifactCache::initialize() {
+    FileCache::initialize();
+    Setting::Handle<int> cacheVersionHandle(SETTING_VERSION_NAME, INVALID_VERSION);
+    auto cacheVersion = cacheVersionHandle.get();
+    if (cacheVersion != CURRENT_VERSION) {
+        wipe();
+        cacheVersionHandle.set(CURRENT_VERSION);
+    }
+}
+
+std::string ArtifactCache::computeKey(uint32_t type, uint32_t typeVersion, const QByteArray& data, const QByteArray& variant) {
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    const uint32_t artifactInfo[] = { type, typeVersion, (uint32_t)variant.size() };
+    hash.addData((const char*)artifactInfo, sizeof(artifactInfo));
+    hash.addData(variant);
+    hash.addData(data);
+    return hash.result().toHex().toStdString();
+}
+
+storage::StoragePointer ArtifactCache::loadArtifact(const std::string& key, uint32_t type, uint32_t typeVersion) {
+    auto file = getFile(key);
+    if (!file) {
+        return nullptr;
+    }
+    auto mapped = std::make_shared<storage::FileStorage>(file->getFilepath().c_str());
+    if (!*mapped || mapped->size() < sizeof(ArtifactCacheHeader)) {
+        return nullptr;
+    }
+    ArtifactCacheHeader header;
+    memcpy(&header, mapped->data(), sizeof(ArtifactCacheHeader));
+    if (header.magic != ARTIFACT_CACHE_MAGIC || header.version != (uint32_t)CURRENT_VERSION ||
+            header.type != type || header.typeVersion != typeVersion ||
+            header.payloadOffset < sizeof(ArtifactCacheHeader) || header.payloadOffset > mapped->size() ||
+            header.payloadSize != (uint64_t)(mapped->size() - header.payloadOffset)) {
+        qCWarning(networking) << "ArtifactCache: ignoring corrupt entry" << key.c_str();
+        return nullptr;
+    }
+    return std::make_shared<ArtifactStorage>(file, mapped, header.payloadOffset, header.payloadSize);
+}
+
+void ArtifactCache::saveArtifact(const std::string& key, uint32_t type, uint32_t typeVersion, const QByteArray& payload) {
+    ArtifactCacheHeader header;
+    header.magic = ARTIFACT_CACHE_MAGIC;
+    header.version = (uint32_t)CURRENT_VERSION;
+    header.type = type;
+    header.typeVersion = typeVersion;
+    header.payloadSize = (uint64_t)payload.size();
+    header.payloadOffset = (uint32_t)sizeof(ArtifactCacheHeader);
+    header.reserved = 0;
+
+    QByteArray data;
+    data.reserve((int)sizeof(ArtifactCacheHeader) + payload.size());
+    data.append((const char*)&header, sizeof(ArtifactCacheHeader));
+    data.append(payload);
+    writeFile(data.constData(), Metadata(key, data.size()));
+}
@@ -0,0 +1,55 @@
+//
+//  ArtifactCache.h
+//  libraries/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_ArtifactCache_h
+#define hifi_ArtifactCache_h
+
+#include <string>
+
+#include <QtCore/QByteArray>
+
+#include <shared/FileCache.h>
+#include <shared/Storage.h>
+
+// The ArtifactCache persists the post-processed form of resources (decoded audio, for example) on disk so that a
+// resource seen before can skip its processing.  Entries are keyed by a hash of the downloaded data together with
+// the artifact type and version, so changed content or a changed artifact format never picks up a stale entry.
+//
+// Artifacts are read back through a memory mapping of the cache file: the payload is 16 byte aligned in the file so
+// that it can be used in place.  The cache is size-bounded by the FileCache LRU and is safe to use from any thread.
+class ArtifactCache : public cache::FileCache {
+    Q_OBJECT
+
+public:
+    // Whenever a change is made to the entry layout that isn't backward compatible this value should be
+    // incremented.  This will force the artifact cache to be wiped.  Changes to the format of a single artifact type
+    // only need that type's version to be bumped.
+    static const int CURRENT_VERSION;
+    static const int INVALID_VERSION;
+    static const char* SETTING_VERSION_NAME;
+    static const std::string DIRNAME;
+    static const std::string EXTENSION;
+
+    ArtifactCache(const std::string& dirname = DIRNAME);
+
+    void initialize() override;
+
+    /// \param type four character code identifying the kind of artifact
+    /// \param variant anything besides the data that changes how the data is processed (e.g. the file extension)
+    static std::string computeKey(uint32_t type, uint32_t typeVersion, const QByteArray& data,
+        const QByteArray& variant = QByteArray());
+
+    /// \return mapped payload of the entry for key, or nullptr if there isn't a valid one
+    storage::StoragePointer loadArtifact(const std::string& key, uint32_t type, uint32_t typeVersion);
+    void saveArtifact(const std::string& key, uint32_t type, uint32_t typeVersion, const QByteArray& payload);
+};
+
+#endif // hifi_ArtifactCache_h
@@ -26,17 +26,52 @@
 #include <Profile.h>
 #include <QUrlQuery>
 
+#include "ArtifactCache.h"
 #include "NetworkAccessManager.h"
 #include "NetworkLogging.h"
 #include "NodeList.h"
 
+// a pending request gains this much priority for every second it has been waiting
+const float WAIT_PRIORITY_PER_SECOND = 0.05f;
+// how much more a pending request has to matter than a loading one to take its slot
+const float PREEMPT_PRIORITY_MARGIN = 0.5f;
+
+// protocol limits are adjusted once per interval, from the bytes downloaded over that interval
+const quint64 THROUGHPUT_INTERVAL_USECS = USECS_PER_SECOND;
+const float THROUGHPUT_TOLERANCE = 0.1f;
+const uint32_t MIN_PROTOCOL_REQUEST_LIMIT = 2;
+
+ResourceCacheSharedItems::Protocol ResourceCacheSharedItems::getProtocol(const QUrl& url) {
+    auto scheme = url.scheme();
+    if (scheme == HIFI_URL_SCHEME_FILE || scheme == URL_SCHEME_QRC) {
+        return FILE_PROTOCOL;
+    } else if (scheme == HIFI_URL_SCHEME_HTTP || scheme == HIFI_URL_SCHEME_HTTPS) {
+        return HTTP_PROTOCOL;
+    } else if (scheme == URL_SCHEME_ATP) {
+        return ATP_PROTOCOL;
+    }
+    return OTHER_PROTOCOL;
+}
+
+uint32_t ResourceCacheSharedItems::getProtocolLimit(Protocol protocol) const {
+    if (protocol == FILE_PROTOCOL) {
+        return _requestLimit;
+    }
+    return std::min(_protocolStats[protocol].limit, _requestLimit);
+}
+
 bool ResourceCacheSharedItems::appendRequest(QWeakPointer<Resource> resource, float priority) {
     Lock lock(_mutex);
-    if ((uint32_t)_loadingRequests.size() < _requestLimit) {
-        _loadingRequests.append({ resource, priority });
+    auto locked = resource.lock();
+    Protocol protocol = locked ? getProtocol(locked->getURL()) : OTHER_PROTOCOL;
+    auto& stats = _protocolStats[protocol];
+    if ((uint32_t)_loadingRequests.size() < _requestLimit && stats.numLoading < getProtocolLimit(protocol)) {
+        _loadingRequests.append({ resource, priority, protocol, usecTimestampNow() });
+        stats.numLoading++;
+        stats.isSaturated = stats.isSaturated || stats.numLoading >= getProtocolLimit(protocol);
         return true;
     } else {
-        _pendingRequests.append(resource);
+        _pendingRequests.append({ resource, usecTimestampNow() });
         return false;
     }
 }
@@ -51,12 +86,17 @@ uint32_t ResourceCacheSharedItems::getRequestLimit() const {
     return _requestLimit;
 }
 
+uint32_t ResourceCacheSharedItems::getProtocolRequestLimit(Protocol protocol) const {
+    Lock lock(_mutex);
+    return getProtocolLimit(protocol);
+}
+
 QList<QSharedPointer<Resource>> ResourceCacheSharedItems::getPendingRequests() const {
     QList<QSharedPointer<Resource>> result;
     Lock lock(_mutex);
 
-    foreach (QWeakPointer<Resource> resource, _pendingRequests) {
-        auto locked = resource.lock();
+    foreach (const PendingRequest& request, _pendingRequests) {
+        auto locked = request.resource.lock();
         if (locked) {
             result.append(locked);
         }
@@ -74,10 +114,10 @@ QList<std::pair<QSharedPointer<Resource>, float>> ResourceCacheSharedItems::getL
     QList<std::pair<QSharedPointer<Resource>, float>> result;
     Lock lock(_mutex);
 
-    foreach(auto resourcePair, _loadingRequests) {
-        auto locked = resourcePair.first.lock();
+    foreach(const LoadingRequest& request, _loadingRequests) {
+        auto locked = request.resource.lock();
         if (locked) {
-            result.append({ locked, resourcePair.second });
+            result.append({ locked, request.priority });
         }
     }
 
@@ -91,14 +131,21 @@ uint32_t ResourceCacheSharedItems::getLoadingRequestsCount() const {
 
 void ResourceCacheSharedItems::removeRequest(QWeakPointer<Resource> resource) {
     Lock lock(_mutex);
+    auto now = usecTimestampNow();
 
     // resource can only be removed if it still has a ref-count, as
     // QWeakPointer has no operator== implementation for two weak ptrs, so
     // manually loop in case resource has been freed.
     for (int i = 0; i < _loadingRequests.size();) {
-        auto request = _loadingRequests.at(i).first;
+        const LoadingRequest& request = _loadingRequests.at(i);
+        auto locked = request.resource.toStrongRef();
         // Clear our resource and any freed resources
-        if (!request || request.toStrongRef().data() == resource.toStrongRef().data()) {
+        if (!locked || locked.data() == resource.toStrongRef().data()) {
+            Protocol protocol = request.protocol;
+            _protocolStats[protocol].numLoading--;
+            if (locked && !request.isPreempted) {
+                updateProtocolLimit(protocol, locked->getBytesReceived(), now);
+            }
             _loadingRequests.removeAt(i);
             continue;
         }
@@ -106,33 +153,78 @@ void ResourceCacheSharedItems::removeRequest(QWeakPointer<Resource> resource) {
     }
 }
 
+void ResourceCacheSharedItems::updateProtocolLimit(Protocol protocol, qint64 bytesReceived, quint64 now) {
+    if (protocol == FILE_PROTOCOL) {
+        return;
+    }
+    auto& stats = _protocolStats[protocol];
+    stats.intervalBytes += bytesReceived;
+    if (stats.intervalStart == 0) {
+        stats.intervalStart = now;
+        return;
+    }
+    quint64 elapsed = now - stats.intervalStart;
+    if (elapsed < THROUGHPUT_INTERVAL_USECS) {
+        return;
+    }
+
+    float throughput = (float)stats.intervalBytes * (float)USECS_PER_SECOND / (float)elapsed;
+    // an idle protocol's throughput only says how much was asked of it, so the limit is only tuned while it's busy:
+    // keep stepping the way throughput improves and turn around when it drops
+    if (stats.isSaturated) {
+        if (throughput < stats.throughput * (1.0f - THROUGHPUT_TOLERANCE)) {
+            stats.step = -stats.step;
+        }
+        if (throughput < stats.throughput * (1.0f - THROUGHPUT_TOLERANCE) ||
+                throughput > stats.throughput * (1.0f + THROUGHPUT_TOLERANCE)) {
+            int limit = (int)getProtocolLimit(protocol) + stats.step;
+            stats.limit = (uint32_t)std::max(std::min(limit, (int)_requestLimit), (int)MIN_PROTOCOL_REQUEST_LIMIT);
+        }
+    }
+    stats.throughput = throughput;
+    stats.intervalStart = now;
+    stats.intervalBytes = 0;
+    stats.isSaturated = stats.numLoading >= getProtocolLimit(protocol);
+}
+
 std::pair<QSharedPointer<Resource>, float> ResourceCacheSharedItems::getHighestPendingRequest() {
     // look for the highest priority pending request
     int highestIndex = -1;
     float highestPriority = -FLT_MAX;
     QSharedPointer<Resource> highestResource;
     Lock lock(_mutex);
+    auto now = usecTimestampNow();
 
     bool currentHighestIsFile = false;
 
     for (int i = 0; i < _pendingRequests.size();) {
         // Clear any freed resources
-        auto resource = _pendingRequests.at(i).lock();
+        const PendingRequest& request = _pendingRequests.at(i);
+        auto resource = request.resource.lock();
         if (!resource) {
             _pendingRequests.removeAt(i);
             continue;
         }
+        i++;
+
+        // Skip protocols that are already at their limit
+        Protocol protocol = getProtocol(resource->getURL());
+        auto& stats = _protocolStats[protocol];
+        if (stats.numLoading >= getProtocolLimit(protocol)) {
+            stats.isSaturated = true;
+            continue;
+        }
 
         // Check load priority
-        float priority = resource->getLoadPriority();
-        bool isFile = resource->getURL().scheme() == HIFI_URL_SCHEME_FILE;
+        float waitTime = (float)(now - std::min(now, request.queuedTime)) / (float)USECS_PER_SECOND;
+        float priority = resource->getLoadPriority() + WAIT_PRIORITY_PER_SECOND * waitTime;
+        bool isFile = protocol == FILE_PROTOCOL;
         if (priority >= highestPriority && (isFile || !currentHighestIsFile)) {
             highestPriority = priority;
-            highestIndex = i;
+            highestIndex = i - 1;
             highestResource = resource;
             currentHighestIsFile = isFile;
         }
-        i++;
     }
 
     if (highestIndex >= 0) {
@@ -142,10 +234,43 @@ std::pair<QSharedPointer<Resource>, float> ResourceCacheSharedItems::getHighestP
     return { highestResource, highestPriority };
 }
 
+QSharedPointer<Resource> ResourceCacheSharedItems::getPreemptableRequest(float priority) {
+    QSharedPointer<Resource> lowestResource;
+    LoadingRequest* lowestRequest = nullptr;
+    float lowestPriority = priority - PREEMPT_PRIORITY_MARGIN;
+    Lock lock(_mutex);
+
+    for (auto& request : _loadingRequests) {
+        // restarting a request that has started to arrive would waste what's been downloaded so far, and local
+        // files are quick enough that there's no point
+        auto resource = request.resource.lock();
+        if (!resource || resource->_wasPreempted || request.protocol == FILE_PROTOCOL || resource->getBytesReceived() > 0) {
+            continue;
+        }
+        float loadPriority = resource->getLoadPriority();
+        if (loadPriority < lowestPriority) {
+            lowestPriority = loadPriority;
+            lowestRequest = &request;
+            lowestResource = resource;
+        }
+    }
+
+    if (lowestRequest) {
+        // the flag on the loading request keeps the aborted attempt out of the throughput measurement, the one on the
+        // resource survives it being queued up again
+        lowestRequest->isPreempted = true;
+        lowestResource->_wasPreempted = true;
+    }
+    return lowestResource;
+}
+
 void ResourceCacheSharedItems::clear() {
     Lock lock(_mutex);
     _pendingRequests.clear();
     _loadingRequests.clear();
+    for (auto& stats : _protocolStats) {
+        stats.numLoading = 0;
+    }
 }
 
 ScriptableResourceCache::ScriptableResourceCache(QSharedPointer<ResourceCache> resourceCache) {
@@ -266,6 +391,23 @@ ResourceCache::~ResourceCache() {
     clearUnusedResources();
 }
 
+// set once at startup but read from processing threads
+static std::shared_ptr<ArtifactCache> artifactCache;
+
+void ResourceCache::setArtifactCache(const std::shared_ptr<ArtifactCache>& cache) {
+    std::atomic_store(&artifactCache, cache);
+}
+
+std::shared_ptr<ArtifactCache> ResourceCache::getArtifactCache() {
+    return std::atomic_load(&artifactCache);
+}
+
+float ResourceCache::getArtifactHitRate() const {
+    size_t numHits = _artifactCounters->numHits;
+    size_t numLookups = numHits + _artifactCounters->numMisses;
+    return numLookups > 0 ? (float)numHits / (float)numLookups : 0.0f;
+}
+
 void ResourceCache::clearATPAssets() {
     {
         QWriteLocker locker(&_resourcesLock);
@@ -347,7 +489,9 @@ void ResourceCache::setRequestLimit(uint32_t limit) {
 
     // Now go fill any new request spots
     while (sharedItems->getLoadingRequestsCount() < limit && sharedItems->getPendingRequestsCount() > 0) {
-        attemptHighestPriorityRequest();
+        if (!attemptHighestPriorityRequest()) {
+            break;
+        }
     }
 }
 
@@ -539,6 +683,11 @@ bool ResourceCache::attemptRequest(QSharedPointer<Resource> resource, float prio
         resource->makeRequest();
         return true;
     }
+
+    // a resource that matters much more than one still waiting on its first byte takes that one's place
+    if (auto preempted = sharedItems->getPreemptableRequest(resource->getLoadPriority())) {
+        QMetaObject::invokeMethod(preempted.data(), "preempt");
+    }
     return false;
 }
 
@@ -547,9 +696,11 @@ void ResourceCache::requestCompleted(QWeakPointer<Resource> resource) {
 
     sharedItems->removeRequest(resource);
 
-    // Now go fill any new request spots
+    // Now go fill any new request spots, until the pending requests left are all held back by their protocol's limit
     while (sharedItems->getLoadingRequestsCount() < sharedItems->getRequestLimit() && sharedItems->getPendingRequestsCount() > 0) {
-        attemptHighestPriorityRequest();
+        if (!attemptHighestPriorityRequest()) {
+            break;
+        }
     }
 }
 
@@ -628,6 +779,24 @@ float Resource::getLoadPriority() {
     return highestPriority;
 }
 
+void Resource::preempt() {
+    // only give up the slot if nothing has arrived since the request was chosen
+    if (!_request || _loaded || _failedToLoad || _bytesReceived > 0) {
+        return;
+    }
+
+    PROFILE_ASYNC_END(resource, "Resource:" + getType(), QString::number(_requestID));
+    _request->disconnect(this);
+    _request->deleteLater();
+    _request = nullptr;
+    ResourceCache::requestCompleted(_self);
+
+    // back in the queue, to be picked up again by priority
+    if (DependencyManager::get<ResourceCacheSharedItems>()->appendRequest(_self, NAN)) {
+        makeRequest();
+    }
+}
+
 void Resource::refresh() {
     if (_request && !(_loaded || _failedToLoad)) {
         return;
@@ -734,6 +903,37 @@ void Resource::finishedLoading(bool success) {
     emit finished(success);
 }
 
+void Resource::setCache(ResourceCache* cache) {
+    _cache = cache;
+    // A resource only ever belongs to one cache, and it is set before any processing is dispatched.  The counters are
+    // kept when the resource is detached, so a lookup still in flight has something to count into.
+    if (cache && !_artifactCounters) {
+        _artifactCounters = cache->_artifactCounters;
+    }
+}
+
+storage::StoragePointer Resource::loadArtifact(const std::string& key, uint32_t type, uint32_t typeVersion) {
+    auto cache = ResourceCache::getArtifactCache();
+    if (!cache) {
+        return nullptr;
+    }
+    auto artifact = cache->loadArtifact(key, type, typeVersion);
+    if (_artifactCounters) {
+        if (artifact) {
+            _artifactCounters->numHits++;
+        } else {
+            _artifactCounters->numMisses++;
+        }
+    }
+    return artifact;
+}
+
+void Resource::saveArtifact(const std::string& key, uint32_t type, uint32_t typeVersion, const QByteArray& artifact) {
+    if (auto cache = ResourceCache::getArtifactCache()) {
+        cache->saveArtifact(key, type, typeVersion, artifact);
+    }
+}
+
 void Resource::setSize(const qint64& bytes) {
     emit updateSize(bytes - _bytes);
     _bytes = bytes;
@@ -14,6 +14,7 @@
 #ifndef hifi_ResourceCache_h
 #define hifi_ResourceCache_h
 
+#include <array>
 #include <atomic>
 #include <mutex>
 #include <math.h>
@@ -32,6 +33,7 @@
 #include <QtNetwork/QNetworkRequest>
 
 #include <DependencyManager.h>
+#include <shared/Storage.h>
 
 #include "ResourceManager.h"
 
@@ -39,6 +41,7 @@ Q_DECLARE_METATYPE(size_t)
 
 class QNetworkReply;
 class QTimer;
+class ArtifactCache;
 
 class Resource;
 
@@ -67,23 +70,71 @@ class ResourceCacheSharedItems : public Dependency  {
     using Lock = std::unique_lock<Mutex>;
 
 public:
+    // Besides the global request limit each protocol has its own, which climbs or backs off with the throughput the
+    // protocol achieves while it's busy, so that a slow ATP server doesn't hold back HTTP downloads and vice versa.
+    // Local files are always allowed the global limit.
+    enum Protocol {
+        FILE_PROTOCOL = 0,
+        HTTP_PROTOCOL,
+        ATP_PROTOCOL,
+        OTHER_PROTOCOL,
+        NUM_PROTOCOLS
+    };
+    static Protocol getProtocol(const QUrl& url);
+
     bool appendRequest(QWeakPointer<Resource> newRequest, float priority);
     void removeRequest(QWeakPointer<Resource> doneRequest);
     void setRequestLimit(uint32_t limit);
     uint32_t getRequestLimit() const;
+    uint32_t getProtocolRequestLimit(Protocol protocol) const;
     QList<QSharedPointer<Resource>> getPendingRequests() const;
+
+    /// Pending requests are ranked by their load priority plus a bonus for the time they've been waiting, so that
+    /// nothing starves while higher priority resources keep arriving.
     std::pair<QSharedPointer<Resource>, float> getHighestPendingRequest();
     uint32_t getPendingRequestsCount() const;
     QList<std::pair<QSharedPointer<Resource>, float>> getLoadingRequests() const;
     uint32_t getLoadingRequestsCount() const;
+
+    /// \return the lowest priority loading request that hasn't received anything yet, if priority beats it by
+    /// enough that it should give up its slot, or nullptr if there's none.  A resource is only returned once, even
+    /// after it has been queued up again.
+    QSharedPointer<Resource> getPreemptableRequest(float priority);
     void clear();
 
 private:
     ResourceCacheSharedItems() = default;
 
+    struct PendingRequest {
+        QWeakPointer<Resource> resource;
+        quint64 queuedTime;
+    };
+
+    struct LoadingRequest {
+        QWeakPointer<Resource> resource;
+        float priority;
+        Protocol protocol;
+        quint64 startTime;
+        bool isPreempted { false };
+    };
+
+    struct ProtocolStats {
+        uint32_t numLoading { 0 };
+        uint32_t limit { std::numeric_limits<uint32_t>::max() };
+        int step { 1 };
+        bool isSaturated { false };
+        quint64 intervalStart { 0 };
+        qint64 intervalBytes { 0 };
+        float throughput { 0.0f };
+    };
+
+    uint32_t getProtocolLimit(Protocol protocol) const;
+    void updateProtocolLimit(Protocol protocol, qint64 bytesReceived, quint64 now);
+
     mutable Mutex _mutex;
-    QList<QWeakPointer<Resource>> _pendingRequests;
-    QList<std::pair<QWeakPointer<Resource>, float>> _loadingRequests;
+    QList<PendingRequest> _pendingRequests;
+    QList<LoadingRequest> _loadingRequests;
+    std::array<ProtocolStats, NUM_PROTOCOLS> _protocolStats;
     const uint32_t DEFAULT_REQUEST_LIMIT = 10;
     uint32_t _requestLimit { DEFAULT_REQUEST_LIMIT };
 };
@@ -201,6 +252,9 @@ class ResourceCache : public QObject {
     Q_PROPERTY(size_t numCached READ getNumCachedResources NOTIFY dirty)
     Q_PROPERTY(size_t sizeTotal READ getSizeTotalResources NOTIFY dirty)
     Q_PROPERTY(size_t sizeCached READ getSizeCachedResources NOTIFY dirty)
+    Q_PROPERTY(size_t numArtifactHits READ getNumArtifactHits NOTIFY dirty)
+    Q_PROPERTY(size_t numArtifactMisses READ getNumArtifactMisses NOTIFY dirty)
+    Q_PROPERTY(float artifactHitRate READ getArtifactHitRate NOTIFY dirty)
 
 public:
 
@@ -209,6 +263,14 @@ public:
     size_t getNumCachedResources() const { return _numUnusedResources; }
     size_t getSizeCachedResources() const { return _unusedResourcesSize; }
 
+    size_t getNumArtifactHits() const { return _artifactCounters->numHits; }
+    size_t getNumArtifactMisses() const { return _artifactCounters->numMisses; }
+    float getArtifactHitRate() const;
+
+    /// The on-disk cache of processed resources shared by all the resource caches, or nullptr if there's none
+    static void setArtifactCache(const std::shared_ptr<ArtifactCache>& artifactCache);
+    static std::shared_ptr<ArtifactCache> getArtifactCache();
+
     Q_INVOKABLE QVariantList getResourceList();
 
     static void setRequestLimit(uint32_t limit);
@@ -299,6 +361,13 @@ private:
 
     std::atomic<size_t> _numUnusedResources { 0 };
     std::atomic<qint64> _unusedResourcesSize { 0 };
+
+    // Shared with the resources, which count their artifact lookups on processing threads
+    struct ArtifactCounters {
+        std::atomic<size_t> numHits { 0 };
+        std::atomic<size_t> numMisses { 0 };
+    };
+    std::shared_ptr<ArtifactCounters> _artifactCounters { std::make_shared<ArtifactCounters>() };
 };
 
 /// Wrapper to expose resource caches to JS/QML
@@ -313,11 +382,20 @@ class ScriptableResourceCache : public QObject {
      * @property {number} numCached - Total number of cached resource. <em>Read-only.</em>
      * @property {number} sizeTotal - Size in bytes of all resources. <em>Read-only.</em>
      * @property {number} sizeCached - Size in bytes of all cached resources. <em>Read-only.</em>
+     * @property {number} numArtifactHits - Number of resources whose processed form was loaded from the disk cache.
+     *     <em>Read-only.</em>
+     * @property {number} numArtifactMisses - Number of resources that had to be processed because their processed form
+     *     wasn't in the disk cache. <em>Read-only.</em>
+     * @property {number} artifactHitRate - Fraction, <code>0.0</code> &ndash; <code>1.0</code>, of disk cache lookups that
+     *     were hits. <em>Read-only.</em>
      */
     Q_PROPERTY(size_t numTotal READ getNumTotalResources NOTIFY dirty)
     Q_PROPERTY(size_t numCached READ getNumCachedResources NOTIFY dirty)
     Q_PROPERTY(size_t sizeTotal READ getSizeTotalResources NOTIFY dirty)
     Q_PROPERTY(size_t sizeCached READ getSizeCachedResources NOTIFY dirty)
+    Q_PROPERTY(size_t numArtifactHits READ getNumArtifactHits NOTIFY dirty)
+    Q_PROPERTY(size_t numArtifactMisses READ getNumArtifactMisses NOTIFY dirty)
+    Q_PROPERTY(float artifactHitRate READ getArtifactHitRate NOTIFY dirty)
 
     /*@jsdoc
      * @property {number} numGlobalQueriesPending - Total number of global queries pending (across all resource cache managers).
@@ -401,6 +479,9 @@ private:
     size_t getSizeTotalResources() const { return _resourceCache->getSizeTotalResources(); }
     size_t getNumCachedResources() const { return _resourceCache->getNumCachedResources(); }
     size_t getSizeCachedResources() const { return _resourceCache->getSizeCachedResources(); }
+    size_t getNumArtifactHits() const { return _resourceCache->getNumArtifactHits(); }
+    size_t getNumArtifactMisses() const { return _resourceCache->getNumArtifactMisses(); }
+    float getArtifactHitRate() const { return _resourceCache->getArtifactHitRate(); }
 
     size_t getNumGlobalQueriesPending() const { return ResourceCache::getPendingRequestCount(); }
     size_t getNumGlobalQueriesLoading() const { return ResourceCache::getLoadingRequestCount(); }
@@ -453,7 +534,7 @@ public:
 
     void setSelf(const QWeakPointer<Resource>& self) { _self = self; }
 
-    void setCache(ResourceCache* cache) { _cache = cache; }
+    void setCache(ResourceCache* cache);
 
     virtual void deleter() { allReferencesCleared(); }
 
@@ -466,6 +547,12 @@ public:
     void setExtraHash(size_t extraHash) { _extraHash = extraHash; }
     size_t getExtraHash() const { return _extraHash; }
 
+    /// Processed forms of the downloaded data can be kept in the ArtifactCache, keyed by a hash of that data, so that
+    /// processing can be skipped the next time the same data is seen.  These are safe to call from processing threads.
+    /// \return mapped artifact for key, or nullptr if there's no artifact cache or no valid entry
+    storage::StoragePointer loadArtifact(const std::string& key, uint32_t type, uint32_t typeVersion);
+    void saveArtifact(const std::string& key, uint32_t type, uint32_t typeVersion, const QByteArray& artifact);
+
 signals:
     /// Fired when the resource begins downloading.
     void loading();
@@ -492,6 +579,10 @@ signals:
 protected slots:
     void attemptRequest();
 
+    /// Gives up this resource's request slot to a higher priority one and queues it up again.
+    /// Resources that make their own requests instead of _request must override this to cancel them.
+    virtual void preempt();
+
 protected:
     virtual void init(bool resetLoaded = true);
 
@@ -535,6 +626,8 @@ protected:
     QHash<QPointer<QObject>, std::function<float()>> _loadPriorityOperators;
     QWeakPointer<Resource> _self;
     QPointer<ResourceCache> _cache;
+    // Taken from _cache on the owning thread, for loadArtifact() to use on processing threads
+    std::shared_ptr<ResourceCache::ArtifactCounters> _artifactCounters;
 
     qint64 _bytesReceived { 0 };
     qint64 _bytesTotal { 0 };
@@ -542,6 +635,7 @@ protected:
 
     int _requestID;
     ResourceRequest* _request { nullptr };
+    bool _wasPreempted { false }; // guarded by the ResourceCacheSharedItems mutex, a request only gives up its slot once
 
     size_t _extraHash { std::numeric_limits<size_t>::max() };
 
@@ -551,6 +645,7 @@ public slots:
 
 private:
     friend class ResourceCache;
+    friend class ResourceCacheSharedItems;
     friend class ScriptableResource;
 
     void setLRUKey(int lruKey) { _lruKey = lruKey; }
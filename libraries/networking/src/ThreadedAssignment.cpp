@@ -11,13 +11,17 @@
 
 #include "ThreadedAssignment.h"
 
+#include <algorithm>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
 
+#include <Gzip.h>
 #include <LogHandler.h>
+#include <Trace.h>
 #include <shared/QtHelpers.h>
 
 #include <platform/Platform.h>
@@ -104,6 +108,9 @@ void ThreadedAssignment::commonInit(const QString& targetName, NodeType_t nodeTy
 
     // stop sending stats if we disconnect
     connect(&nodeList->getDomainHandler(), &DomainHandler::disconnectedFromDomain, &_statsTimer, &QTimer::stop);
+
+    nodeList->getPacketReceiver().registerListener(PacketType::TraceDumpRequest,
+        PacketReceiver::makeUnsourcedListenerReference<ThreadedAssignment>(this, &ThreadedAssignment::handleTraceDumpRequest));
 }
 
 void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObject) {
@@ -156,6 +163,29 @@ void ThreadedAssignment::checkInWithDomainServerOrExit() {
     }
 }
 
+void ThreadedAssignment::handleTraceDumpRequest(QSharedPointer<ReceivedMessage> message) {
+    static const quint32 MAX_TRACE_DUMP_SECONDS = 10 * 60;
+
+    auto nodeList = DependencyManager::get<NodeList>();
+    auto domainSockAddr = nodeList->getDomainHandler().getSockAddr();
+    if (message->getSenderSockAddr() != domainSockAddr || !DependencyManager::isSet<tracing::Tracer>()) {
+        return;
+    }
+
+    quint32 seconds;
+    message->readPrimitive(&seconds);
+    seconds = std::min(seconds, MAX_TRACE_DUMP_SECONDS);
+
+    auto since = tracing::Tracer::now() - (int64_t)seconds * USECS_PER_SECOND;
+    QByteArray dump;
+    gzip(DependencyManager::get<tracing::Tracer>()->dump(since), dump);
+    qCDebug(networking) << "Sending the last" << seconds << "seconds of trace to the domain-server," << dump.size() << "bytes";
+
+    auto packetList = NLPacketList::create(PacketType::TraceDump, QByteArray(), true, true);
+    packetList->write(dump);
+    nodeList->sendPacketList(std::move(packetList), domainSockAddr);
+}
+
 void ThreadedAssignment::domainSettingsRequestFailed() {
     qCDebug(networking) << "Failed to retreive settings object from domain-server. Bailing on assignment.";
     stop();
@@ -54,6 +54,7 @@ protected slots:
 
 private slots:
     void checkInWithDomainServerOrExit();
+    void handleTraceDumpRequest(QSharedPointer<ReceivedMessage> message);
 };
 
 typedef QSharedPointer<ThreadedAssignment> SharedAssignmentPointer;
@@ -38,10 +38,10 @@ PacketVersion versionForPacketType(PacketType packetType) {
             return static_cast<PacketVersion>(EntityQueryPacketVersion::CborData);
         case PacketType::AvatarIdentity:
         case PacketType::AvatarData:
-            return static_cast<PacketVersion>(AvatarMixerPacketVersion::RemoveAttachments);
+            return static_cast<PacketVersion>(AvatarMixerPacketVersion::CompactJointRotations);
         case PacketType::BulkAvatarData:
         case PacketType::KillAvatar:
-            return static_cast<PacketVersion>(AvatarMixerPacketVersion::RemoveAttachments);
+            return static_cast<PacketVersion>(AvatarMixerPacketVersion::CompactJointRotations);
         case PacketType::MessagesData:
             return static_cast<PacketVersion>(MessageDataVersion::TextOrBinaryData);
         // ICE packets
@@ -100,7 +100,9 @@ PacketVersion versionForPacketType(PacketType packetType) {
             return static_cast<PacketVersion>(EntityVersion::ParticleSpin);
         case PacketType::BulkAvatarTraitsAck:
         case PacketType::BulkAvatarTraits:
-            return static_cast<PacketVersion>(AvatarMixerPacketVersion::AvatarTraitsAck);
+            return static_cast<PacketVersion>(AvatarMixerPacketVersion::TraitContentHashes);
+        case PacketType::AvatarTraitHashes:
+            return static_cast<PacketVersion>(AvatarMixerPacketVersion::TraitHashReports);
         default:
             return 23;
     }
@@ -147,6 +147,9 @@ public:
         StopInjector,
         AvatarZonePresence,
         WebRTCSignaling,
+        AvatarTraitHashes,
+        TraceDumpRequest,
+        TraceDump,
         NUM_PACKET_TYPE
     };
 
@@ -168,6 +171,7 @@ public:
     const static QSet<PacketTypeEnum::Value> getNonVerifiedPackets() {
         const static QSet<PacketTypeEnum::Value> NON_VERIFIED_PACKETS = QSet<PacketTypeEnum::Value>()
             << PacketTypeEnum::Value::NodeJsonStats
+            << PacketTypeEnum::Value::TraceDump
             << PacketTypeEnum::Value::EntityQuery
             << PacketTypeEnum::Value::OctreeDataNack
             << PacketTypeEnum::Value::EntityEditNack
@@ -200,7 +204,8 @@ public:
             << PacketTypeEnum::Value::ReplicatedMicrophoneAudioWithEcho << PacketTypeEnum::Value::ReplicatedInjectAudio
             << PacketTypeEnum::Value::ReplicatedSilentAudioFrame << PacketTypeEnum::Value::ReplicatedAvatarIdentity
             << PacketTypeEnum::Value::ReplicatedKillAvatar << PacketTypeEnum::Value::ReplicatedBulkAvatarData
-            << PacketTypeEnum::Value::AvatarZonePresence << PacketTypeEnum::Value::WebRTCSignaling;
+            << PacketTypeEnum::Value::AvatarZonePresence << PacketTypeEnum::Value::WebRTCSignaling
+            << PacketTypeEnum::Value::TraceDumpRequest;
         return NON_SOURCED_PACKETS;
     }
 
@@ -439,6 +444,9 @@ enum class AvatarMixerPacketVersion : PacketVersion {
     SendVerificationFailed,
     ARKitBlendshapes,
     RemoveAttachments,
+    CompactJointRotations,
+    TraitContentHashes,
+    TraitHashReports,
 };
 
 enum class DomainConnectRequestVersion : PacketVersion {
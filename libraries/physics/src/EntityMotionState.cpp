@@ -19,6 +19,7 @@
 #include <LogHandler.h>
 #include <PhysicsCollisionGroups.h>
 #include <Profile.h>
+#include <LinearMath/btTransformUtil.h>
 
 #include "BulletUtil.h"
 #include "PhysicsEngine.h"
@@ -28,6 +29,11 @@
 const uint8_t LOOPS_FOR_SIMULATION_ORPHAN = 50;
 const quint64 USECS_BETWEEN_OWNERSHIP_BIDS = USECS_PER_SECOND / 5;
 
+// Bodies in the outer physics region (R2) that someone else is simulating only need to be roughly right:
+// they are allowed to fall asleep at higher speeds and their kinematic motion is integrated at a lower rate.
+const float REDUCED_LOD_SLEEPING_THRESHOLD_SCALE = 3.0f;
+const uint32_t REDUCED_LOD_KINEMATIC_SUBSTEPS = 3; // integrate kinematic motion every third substep (30Hz)
+
 
 EntityMotionState::EntityMotionState(btCollisionShape* shape, EntityItemPointer entity) :
     ObjectMotionState(nullptr),
@@ -136,6 +142,10 @@ void EntityMotionState::handleEasyChanges(uint32_t& flags) {
         updateServerPhysicsVariables();
     }
     ObjectMotionState::handleEasyChanges(flags);
+    if (flags & Simulation::DIRTY_TRANSFORM) {
+        // don't sweep a reduced LOD kinematic body from where it was to where it has been moved
+        _hasKinematicSamples = false;
+    }
 
     if (flags & Simulation::DIRTY_SIMULATOR_ID) {
         if (_entity->getSimulatorID().isNull()) {
@@ -160,6 +170,8 @@ void EntityMotionState::handleEasyChanges(uint32_t& flags) {
             _nextBidExpiry = usecTimestampNow() + USECS_BETWEEN_OWNERSHIP_BIDS;
             _numInactiveUpdates = 0;
         }
+        // ownership affects the simulation LOD
+        updateSleepingThresholds();
     }
     if (flags & Simulation::DIRTY_SIMULATION_OWNERSHIP_PRIORITY) {
         // The DIRTY_SIMULATOR_OWNERSHIP_PRIORITY bit means one of the following:
@@ -787,7 +799,27 @@ bool EntityMotionState::isLocallyOwnedOrShouldBe() const {
 }
 
 void EntityMotionState::setRegion(uint8_t region) {
-    _region = region;
+    if (region != _region) {
+        _region = region;
+        updateSleepingThresholds();
+    }
+}
+
+bool EntityMotionState::isReducedLOD() const {
+    // R1 bodies are near enough to interact with and we must simulate what we own faithfully
+    return _region == workload::Region::R2 && !isLocallyOwned();
+}
+
+// virtual
+float EntityMotionState::getSleepingThresholdScale() const {
+    return isReducedLOD() ? REDUCED_LOD_SLEEPING_THRESHOLD_SCALE : 1.0f;
+}
+
+void EntityMotionState::updateSleepingThresholds() {
+    if (_body && _motionType == MOTION_TYPE_DYNAMIC) {
+        float scale = getSleepingThresholdScale();
+        _body->setSleepingThresholds(scale * DYNAMIC_LINEAR_SPEED_THRESHOLD, scale * DYNAMIC_ANGULAR_SPEED_THRESHOLD);
+    }
 }
 
 void EntityMotionState::initForBid() {
@@ -828,7 +860,36 @@ void EntityMotionState::clearObjectVelocities() const {
 }
 
 void EntityMotionState::saveKinematicState(btScalar timeStep) {
-    _body->saveKinematicState(timeStep);
+    if (isReducedLOD() && !hasInternalKinematicChanges()) {
+        uint32_t thisStep = ObjectMotionState::getWorldSimulationStep();
+        if (!_hasKinematicSamples || thisStep - _lastKinematicSampleStep >= REDUCED_LOD_KINEMATIC_SUBSTEPS) {
+            // getWorldTransform() integrates the entity over all of the substeps since the last sample
+            btTransform sample;
+            getWorldTransform(sample);
+            _kinematicSamples[0] = _hasKinematicSamples ? _kinematicSamples[1] : _body->getWorldTransform();
+            _kinematicSamples[1] = sample;
+            _lastKinematicSampleStep = thisStep;
+            _hasKinematicSamples = true;
+        }
+        // Between samples the body trails the entity and moves evenly from the previous sample to the latest one,
+        // reaching it on the substep before the next sample, so its velocity matches the motion it actually makes.
+        btScalar fraction = (btScalar)(thisStep - _lastKinematicSampleStep + 1) / (btScalar)REDUCED_LOD_KINEMATIC_SUBSTEPS;
+        btTransform transform;
+        transform.setOrigin(_kinematicSamples[0].getOrigin().lerp(_kinematicSamples[1].getOrigin(), fraction));
+        transform.setRotation(_kinematicSamples[0].getRotation().slerp(_kinematicSamples[1].getRotation(), fraction));
+        btVector3 linearVelocity;
+        btVector3 angularVelocity;
+        btTransformUtil::calculateVelocity(_kinematicSamples[0], _kinematicSamples[1],
+            (btScalar)REDUCED_LOD_KINEMATIC_SUBSTEPS * PHYSICS_ENGINE_FIXED_SUBSTEP, linearVelocity, angularVelocity);
+        _body->setWorldTransform(transform);
+        _body->setInterpolationWorldTransform(transform);
+        _body->setLinearVelocity(linearVelocity);
+        _body->setInterpolationLinearVelocity(linearVelocity);
+        _body->setInterpolationAngularVelocity(angularVelocity);
+    } else {
+        _hasKinematicSamples = false;
+        _body->saveKinematicState(timeStep);
+    }
 
     // This is a WORKAROUND for a quirk in Bullet: due to floating point error slow spinning kinematic objects will
     // have a measured angular velocity of zero.  This probably isn't a bug that the Bullet team is interested in
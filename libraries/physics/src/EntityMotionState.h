@@ -97,6 +97,12 @@ public:
     OwnershipState getOwnershipState() const { return _ownershipState; }
 
     void setRegion(uint8_t region);
+    uint8_t getRegion() const { return _region; }
+
+    // true when the body is simulated at reduced fidelity because it is far away and owned by someone else
+    bool isReducedLOD() const;
+    float getSleepingThresholdScale() const override;
+
     void saveKinematicState(btScalar timeStep) override;
 
 protected:
@@ -118,6 +124,7 @@ protected:
     bool isInPhysicsSimulation() const { return _body != nullptr; }
     bool shouldBeInPhysicsSimulation() const;
     void setMotionType(PhysicsMotionType motionType) override;
+    void updateSleepingThresholds();
 
     // EntityMotionState keeps a SharedPointer to its EntityItem which is only set in the CTOR
     // and is only cleared in the DTOR
@@ -157,6 +164,11 @@ protected:
     uint8_t _bumpedPriority { 0 }; // the target simulation priority according to collision history
     uint8_t _region { workload::Region::INVALID };
 
+    // reduced LOD kinematic bodies are only integrated every few substeps and interpolated between the last two samples
+    btTransform _kinematicSamples[2];
+    uint32_t _lastKinematicSampleStep { 0 };
+    bool _hasKinematicSamples { false };
+
     bool isServerlessMode();
 };
 
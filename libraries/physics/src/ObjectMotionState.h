@@ -168,6 +168,7 @@ public:
 
     virtual bool isLocallyOwned() const { return false; }
     virtual bool isLocallyOwnedOrShouldBe() const { return false; } // aka shouldEmitCollisionEvents()
+    virtual float getSleepingThresholdScale() const { return 1.0f; } // > 1.0 lets dynamic bodies fall asleep sooner
     virtual void saveKinematicState(btScalar timeStep);
 
     friend class PhysicsEngine;
@@ -673,6 +673,24 @@ void PhysicalEntitySimulation::addDynamic(EntityDynamicPointer dynamic) {
     }
 }
 
+PhysicalEntitySimulation::RegionStats PhysicalEntitySimulation::getRegionStats(uint8_t region) const {
+    RegionStats stats;
+    for (auto motionState : _physicalObjects) {
+        EntityMotionState* entityState = static_cast<EntityMotionState*>(motionState);
+        if (entityState->getRegion() == region) {
+            ++stats.numBodies;
+            btRigidBody* body = entityState->getRigidBody();
+            if (body && body->isActive()) {
+                ++stats.numActiveBodies;
+            }
+            if (entityState->isReducedLOD()) {
+                ++stats.numReducedLODBodies;
+            }
+        }
+    }
+    return stats;
+}
+
 void PhysicalEntitySimulation::removeDynamic(const QUuid dynamicID) {
     QMutexLocker lock(&_dynamicsMutex);
     _dynamicsToRemove += dynamicID;
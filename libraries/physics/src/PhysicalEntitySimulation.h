@@ -99,6 +99,15 @@ public:
     void sendOwnershipBids(uint32_t numSubsteps);
     void sendOwnedUpdates(uint32_t numSubsteps);
 
+    class RegionStats {
+    public:
+        uint32_t numBodies { 0 };
+        uint32_t numActiveBodies { 0 };
+        uint32_t numReducedLODBodies { 0 };
+    };
+    // counts the bodies in the physics simulation that are in a workload region
+    RegionStats getRegionStats(uint8_t region) const;
+
 private:
     void buildMotionStatesForEntitiesThatNeedThem();
 
@@ -19,13 +19,16 @@
 #include <PhysicsCollisionGroups.h>
 #include <Profile.h>
 #include <BulletCollision/CollisionShapes/btTriangleShape.h>
+#include <LinearMath/btThreads.h>
 
 #include "CharacterController.h"
 #include "ObjectMotionState.h"
 #include "PhysicsHelpers.h"
 #include "PhysicsDebugDraw.h"
+#include "ThreadSafeCollisionDispatcher.h"
 #include "ThreadSafeDynamicsWorld.h"
 #include "PhysicsLogging.h"
+#include "PhysicsTaskScheduler.h"
 
 
 
@@ -36,6 +39,10 @@ PhysicsEngine::PhysicsEngine(const glm::vec3& offset) :
 
 PhysicsEngine::~PhysicsEngine() {
     _myAvatarController = nullptr;
+    if (_taskScheduler) {
+        btSetTaskScheduler(btGetSequentialTaskScheduler());
+        delete _taskScheduler;
+    }
     delete _collisionConfig;
     delete _collisionDispatcher;
     delete _broadphaseFilter;
@@ -46,10 +53,14 @@ PhysicsEngine::~PhysicsEngine() {
 
 void PhysicsEngine::init() {
     if (!_dynamicsWorld) {
+        // install the task scheduler (the sequential one by default) before anything that sizes itself from it
+        setNumSimulationThreads(_numSimulationThreads);
+
         _collisionConfig = new btDefaultCollisionConfiguration();
-        _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
+        _collisionDispatcher = new ThreadSafeCollisionDispatcher(_collisionConfig);
         _broadphaseFilter = new btDbvtBroadphase();
-        _constraintSolver = new btSequentialImpulseConstraintSolver;
+        // one sequential solver per thread: each island is solved whole by whichever solver is free
+        _constraintSolver = new btConstraintSolverPoolMt(MAX_PHYSICS_SIMULATION_THREADS);
         _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, _constraintSolver, _collisionConfig);
         _physicsDebugDraw.reset(new PhysicsDebugDraw());
 
@@ -72,6 +83,35 @@ void PhysicsEngine::init() {
     }
 }
 
+int PhysicsEngine::setNumSimulationThreads(int numThreads) {
+    numThreads = glm::clamp(numThreads, 1, MAX_PHYSICS_SIMULATION_THREADS);
+    if (numThreads > 1 && !_taskScheduler && !_taskSchedulerUnreachable) {
+        _taskScheduler = new PhysicsTaskScheduler();
+        btSetTaskScheduler(_taskScheduler);
+        if (!_taskScheduler->isReachable()) {
+            // Bullet was built without BT_THREADSAFE and runs every parallel loop itself
+            qCWarning(physics) << "Bullet was built without thread support: physics simulation will use one thread";
+            btSetTaskScheduler(btGetSequentialTaskScheduler());
+            delete _taskScheduler;
+            _taskScheduler = nullptr;
+            _taskSchedulerUnreachable = true;
+        }
+    }
+    if (numThreads > 1 && _taskScheduler) {
+        _taskScheduler->setNumThreads(numThreads);
+        btSetTaskScheduler(_taskScheduler);
+        numThreads = _taskScheduler->getNumThreads();
+    } else {
+        btSetTaskScheduler(btGetSequentialTaskScheduler());
+        numThreads = 1;
+    }
+    if (numThreads != _numSimulationThreads) {
+        qCDebug(physics) << "physics simulation threads:" << numThreads;
+        _numSimulationThreads = numThreads;
+    }
+    return _numSimulationThreads;
+}
+
 uint32_t PhysicsEngine::getNumSubsteps() const {
     return _dynamicsWorld->getNumSubsteps();
 }
@@ -130,7 +170,10 @@ void PhysicsEngine::addObjectToDynamicsWorld(ObjectMotionState* motionState) {
 
             // NOTE: Bullet will deactivate any object whose velocity is below these thresholds for longer than 2 seconds.
             // (the 2 seconds is determined by: static btRigidBody::gDeactivationTime
-            body->setSleepingThresholds(DYNAMIC_LINEAR_SPEED_THRESHOLD, DYNAMIC_ANGULAR_SPEED_THRESHOLD);
+            // Far away bodies may scale these up to sleep sooner.
+            float sleepingThresholdScale = motionState->getSleepingThresholdScale();
+            body->setSleepingThresholds(sleepingThresholdScale * DYNAMIC_LINEAR_SPEED_THRESHOLD,
+                                        sleepingThresholdScale * DYNAMIC_ANGULAR_SPEED_THRESHOLD);
             if (!motionState->isMoving()) {
                 // try to initialize this object as inactive
                 body->forceActivationState(ISLAND_SLEEPING);
@@ -324,9 +367,11 @@ void PhysicsEngine::stepSimulation() {
         this->doOwnershipInfectionForConstraints();
     };
 
+    uint64_t startTime = usecTimestampNow();
     int numSubsteps = _dynamicsWorld->stepSimulationWithSubstepCallback(timeStep, PHYSICS_ENGINE_MAX_NUM_SUBSTEPS,
                                                                         PHYSICS_ENGINE_FIXED_SUBSTEP, onSubStep);
     if (numSubsteps > 0) {
+        _stepTime.addSample((float)(usecTimestampNow() - startTime) / (float)USECS_PER_MSEC);
         _hasOutgoingChanges = true;
         if (_physicsDebugDraw->getDebugMode()) {
             BT_PROFILE("debugDrawWorld");
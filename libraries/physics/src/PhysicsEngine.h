@@ -17,6 +17,7 @@
 #include <vector>
 
 #include <QUuid>
+#include <SimpleMovingAverage.h>
 #include <btBulletDynamicsCommon.h>
 #include <BulletCollision/CollisionDispatch/btGhostObject.h>
 
@@ -28,9 +29,11 @@
 #include "ObjectConstraint.h"
 
 const float HALF_SIMULATION_EXTENT = 512.0f; // meters
+const int MAX_PHYSICS_SIMULATION_THREADS = 16;
 
 class CharacterController;
 class PhysicsDebugDraw;
+class PhysicsTaskScheduler;
 
 // simple class for keeping track of contacts
 class ContactKey {
@@ -99,6 +102,14 @@ public:
     uint32_t getNumSubsteps() const;
     int32_t getNumCollisionObjects() const;
 
+    /// \brief spreads narrowphase, island solving and integration over numThreads threads (1 = main thread only)
+    /// \return the number of threads actually in use, which may be fewer than requested
+    int setNumSimulationThreads(int numThreads);
+    int getNumSimulationThreads() const { return _numSimulationThreads; }
+
+    /// \return moving average of the time spent stepping the dynamics world (msec)
+    float getAverageStepTime() const { return _stepTime.average; }
+
     void removeObjects(const VectorOfMotionStates& objects);
     void removeSetOfObjects(const SetOfMotionStates& objects); // only called during teardown
 
@@ -169,11 +180,13 @@ private:
     void doOwnershipInfection(const btCollisionObject* objectA, const btCollisionObject* objectB);
 
     btClock _clock;
+    MovingAverage<float, 30> _stepTime;
     btDefaultCollisionConfiguration* _collisionConfig = NULL;
     btCollisionDispatcher* _collisionDispatcher = NULL;
     btBroadphaseInterface* _broadphaseFilter = NULL;
-    btSequentialImpulseConstraintSolver* _constraintSolver = NULL;
+    btConstraintSolverPoolMt* _constraintSolver = NULL;
     ThreadSafeDynamicsWorld* _dynamicsWorld = NULL;
+    PhysicsTaskScheduler* _taskScheduler = NULL;
     btGhostPairCallback* _ghostPairCallback = NULL;
     std::unique_ptr<PhysicsDebugDraw> _physicsDebugDraw;
 
@@ -189,6 +202,8 @@ private:
     CharacterController* _myAvatarController;
 
     uint32_t _numContactFrames { 0 };
+    int _numSimulationThreads { 1 };
+    bool _taskSchedulerUnreachable { false };
 
     bool _dumpNextStats { false };
     bool _saveNextStats { false };
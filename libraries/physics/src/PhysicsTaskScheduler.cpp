@@ -0,0 +1,82 @@
+//
+//  PhysicsTaskScheduler.cpp
+//  libraries/physics/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "PhysicsTaskScheduler.h"
+
+#include <algorithm>
+
+#include <tbb/blocked_range.h>
+#include <tbb/info.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+
+namespace {
+    class EmptyParallelForBody : public btIParallelForBody {
+    public:
+        virtual void forLoop(int iBegin, int iEnd) const override {}
+    };
+}
+
+PhysicsTaskScheduler::PhysicsTaskScheduler() : btITaskScheduler("PhysicsTaskScheduler") {
+    _arena = std::make_unique<tbb::task_arena>(_numThreads);
+}
+
+PhysicsTaskScheduler::~PhysicsTaskScheduler() {
+}
+
+int PhysicsTaskScheduler::getMaxNumThreads() const {
+    // btGetCurrentThreadIndex() hands out at most BT_MAX_THREAD_COUNT indices, one of them to the calling thread
+    return std::min((int)tbb::info::default_concurrency(), (int)BT_MAX_THREAD_COUNT - 1);
+}
+
+void PhysicsTaskScheduler::setNumThreads(int numThreads) {
+    numThreads = std::max(1, std::min(numThreads, getMaxNumThreads()));
+    if (numThreads != _numThreads) {
+        _numThreads = numThreads;
+        _arena = std::make_unique<tbb::task_arena>(_numThreads);
+    }
+}
+
+void PhysicsTaskScheduler::parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) {
+    ++_numParallelForCalls;
+    _arena->execute([&] {
+        tbb::parallel_for(tbb::blocked_range<int>(iBegin, iEnd, std::max(grainSize, 1)),
+            [&](const tbb::blocked_range<int>& range) {
+                body.forLoop(range.begin(), range.end());
+            }, tbb::simple_partitioner());
+    });
+}
+
+btScalar PhysicsTaskScheduler::parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) {
+    btScalar sum = btScalar(0);
+    _arena->execute([&] {
+        sum = tbb::parallel_deterministic_reduce(tbb::blocked_range<int>(iBegin, iEnd, std::max(grainSize, 1)), btScalar(0),
+            [&](const tbb::blocked_range<int>& range, btScalar partialSum) {
+                return partialSum + body.sumLoop(range.begin(), range.end());
+            },
+            [](btScalar a, btScalar b) {
+                return a + b;
+            }, tbb::simple_partitioner());
+    });
+    return sum;
+}
+
+int PhysicsTaskScheduler::getCurrentThreadIndex() {
+    // negative when the calling thread isn't in an arena
+    int index = tbb::this_task_arena::current_thread_index();
+    return std::max(0, std::min(index, (int)BT_MAX_THREAD_COUNT - 1));
+}
+
+bool PhysicsTaskScheduler::isReachable() {
+    uint32_t numCalls = _numParallelForCalls;
+    btParallelFor(0, 1, 1, EmptyParallelForBody());
+    return _numParallelForCalls != numCalls;
+}
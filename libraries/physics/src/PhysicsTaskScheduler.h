@@ -0,0 +1,50 @@
+//
+//  PhysicsTaskScheduler.h
+//  libraries/physics/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_PhysicsTaskScheduler_h
+#define hifi_PhysicsTaskScheduler_h
+
+#include <atomic>
+#include <memory>
+
+#include <LinearMath/btThreads.h>
+#include <tbb/task_arena.h>
+
+// Runs Bullet's parallel loops on the TBB worker pool that the rest of the application already uses, instead of
+// starting a second pool of Bullet threads.  The loops run in a task arena limited to the requested thread count.
+// Ranges are split the same way every time so parallelSum() results don't depend on thread timing.
+class PhysicsTaskScheduler : public btITaskScheduler {
+public:
+    PhysicsTaskScheduler();
+    ~PhysicsTaskScheduler();
+
+    virtual int getMaxNumThreads() const override;
+    virtual int getNumThreads() const override { return _numThreads; }
+    virtual void setNumThreads(int numThreads) override;
+    virtual void parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) override;
+    virtual btScalar parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) override;
+
+    // Bullet only forwards btParallelFor() to the installed scheduler when it was built with BT_THREADSAFE,
+    // otherwise it runs the loop itself.  Returns true if a loop reached this scheduler while it was installed.
+    bool isReachable();
+
+    // Bullet numbers every thread that ever enters it and wraps that count past BT_MAX_THREAD_COUNT, but any thread
+    // of the TBB pool can join the arena.  The arena slot is unique among the threads running a loop, so per-thread
+    // data is indexed by it instead.  Always in [0, BT_MAX_THREAD_COUNT), 0 outside of a loop.
+    static int getCurrentThreadIndex();
+
+private:
+    std::unique_ptr<tbb::task_arena> _arena;
+    int _numThreads { 1 };
+    std::atomic<uint32_t> _numParallelForCalls { 0 };
+};
+
+#endif // hifi_PhysicsTaskScheduler_h
@@ -0,0 +1,117 @@
+//
+//  ShapeCache.cpp
+//  libraries/physics/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ShapeCache.h"
+
+#include <cstring>
+
+#include <QCryptographicHash>
+#include <QFile>
+
+#include <SettingHandle.h>
+
+#include "PhysicsLogging.h"
+#include "ShapeFactory.h"
+
+const int ShapeCache::CURRENT_VERSION = 0x01;
+const int ShapeCache::INVALID_VERSION = 0x00;
+const char* ShapeCache::SETTING_VERSION_NAME = "hifi.shape.cache_version";
+const std::string ShapeCache::DIRNAME { "shape_cache" };
+const std::string ShapeCache::EXTENSION { "shape" };
+
+// small meshes build their bvh faster than we can read it back from disk
+const int MIN_CACHED_MESH_TRIANGLES = 1024;
+
+const uint32_t SHAPE_CACHE_MAGIC = 0x50414853; // "SHAP"
+
+struct ShapeCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t shapeType;
+    uint32_t dataSize;
+};
+
+ShapeCache::ShapeCache(const std::string& dirname) :
+    FileCache(dirname, EXTENSION) { }
+
+void ShapeCache::initialize() {
+    FileCache::initialize();
+    Setting::Handle<int> cacheVersionHandle(SETTING_VERSION_NAME, INVALID_VERSION);
+    auto cacheVersion = cacheVersionHandle.get();
+    if (cacheVersion != CURRENT_VERSION) {
+        wipe();
+        cacheVersionHandle.set(CURRENT_VERSION);
+    }
+}
+
+bool ShapeCache::isCacheable(const ShapeInfo& info) {
+    const int VERTICES_PER_TRIANGLE = 3;
+    return info.getType() == SHAPE_TYPE_STATIC_MESH &&
+        info.getTriangleIndices().size() >= MIN_CACHED_MESH_TRIANGLES * VERTICES_PER_TRIANGLE;
+}
+
+std::string ShapeCache::computeKey(const ShapeInfo& info) {
+    // ShapeInfo::getHash() only covers type, extents, offset and url, so we also hash the mesh itself
+    // and the Bullet build details that the serialized data depends on
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    const uint32_t buildInfo[] = { (uint32_t)BT_BULLET_VERSION, (uint32_t)sizeof(btScalar), (uint32_t)CURRENT_VERSION };
+    hash.addData((const char*)buildInfo, sizeof(buildInfo));
+    uint64_t infoHash = info.getHash();
+    hash.addData((const char*)&infoHash, sizeof(infoHash));
+    for (const ShapeInfo::PointList& points : info.getPointCollection()) {
+        hash.addData((const char*)points.constData(), points.size() * (int)sizeof(glm::vec3));
+    }
+    const ShapeInfo::TriangleIndices& indices = info.getTriangleIndices();
+    hash.addData((const char*)indices.constData(), indices.size() * (int)sizeof(int32_t));
+    return hash.result().toHex().toStdString();
+}
+
+const btCollisionShape* ShapeCache::loadShape(const ShapeInfo& info, const std::string& key) {
+    auto file = getFile(key);
+    if (!file) {
+        return nullptr;
+    }
+    QFile input(file->getFilepath().c_str());
+    if (!input.open(QIODevice::ReadOnly)) {
+        return nullptr;
+    }
+    QByteArray data = input.readAll();
+    if (data.size() < (int)sizeof(ShapeCacheHeader)) {
+        return nullptr;
+    }
+    ShapeCacheHeader header;
+    memcpy(&header, data.constData(), sizeof(ShapeCacheHeader));
+    if (header.magic != SHAPE_CACHE_MAGIC || header.version != (uint32_t)CURRENT_VERSION ||
+            header.shapeType != (uint32_t)info.getType() ||
+            header.dataSize != (uint32_t)(data.size() - (int)sizeof(ShapeCacheHeader))) {
+        qCWarning(physics) << "ShapeCache: ignoring corrupt entry" << key.c_str();
+        return nullptr;
+    }
+    return ShapeFactory::createStaticMeshShapeFromBvh(info, data.mid(sizeof(ShapeCacheHeader)));
+}
+
+void ShapeCache::saveShape(const std::string& key, const btCollisionShape* shape) {
+    QByteArray bvhData = ShapeFactory::serializeStaticMeshBvh(shape);
+    if (bvhData.isEmpty()) {
+        return;
+    }
+    ShapeCacheHeader header;
+    header.magic = SHAPE_CACHE_MAGIC;
+    header.version = (uint32_t)CURRENT_VERSION;
+    header.shapeType = (uint32_t)SHAPE_TYPE_STATIC_MESH;
+    header.dataSize = (uint32_t)bvhData.size();
+
+    QByteArray data;
+    data.reserve((int)sizeof(ShapeCacheHeader) + bvhData.size());
+    data.append((const char*)&header, sizeof(ShapeCacheHeader));
+    data.append(bvhData);
+    writeFile(data.constData(), Metadata(key, data.size()));
+}
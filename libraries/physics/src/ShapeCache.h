@@ -0,0 +1,52 @@
+//
+//  ShapeCache.h
+//  libraries/physics/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_ShapeCache_h
+#define hifi_ShapeCache_h
+
+#include <string>
+
+#include <btBulletDynamicsCommon.h>
+
+#include <ShapeInfo.h>
+#include <shared/FileCache.h>
+
+// The ShapeCache persists the expensive parts of complex collision shapes on disk so they needn't be rebuilt
+// on the next visit.  Entries are keyed by a hash of the ShapeInfo's content (including its mesh data) so a
+// changed model never picks up a stale shape.  Only static meshes are cached: their bvh dominates the build
+// time and everything else is cheap to rebuild from the ShapeInfo.
+//
+// The cache is safe to use from ShapeFactory::Worker threads.
+class ShapeCache : public cache::FileCache {
+    Q_OBJECT
+
+public:
+    // Whenever a change is made to the serialized format that isn't backward compatible this value should be
+    // incremented.  This will force the shape cache to be wiped.
+    static const int CURRENT_VERSION;
+    static const int INVALID_VERSION;
+    static const char* SETTING_VERSION_NAME;
+    static const std::string DIRNAME;
+    static const std::string EXTENSION;
+
+    ShapeCache(const std::string& dirname = DIRNAME);
+
+    void initialize() override;
+
+    static bool isCacheable(const ShapeInfo& info);
+    static std::string computeKey(const ShapeInfo& info);
+
+    /// \return new shape built from the cached entry for key, or nullptr if there isn't a valid one
+    const btCollisionShape* loadShape(const ShapeInfo& info, const std::string& key);
+    void saveShape(const std::string& key, const btCollisionShape* shape);
+};
+
+#endif // hifi_ShapeCache_h
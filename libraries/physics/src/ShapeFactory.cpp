@@ -11,11 +11,14 @@
 
 #include "ShapeFactory.h"
 
+#include <cstring>
+
 #include <glm/gtx/norm.hpp>
 
 #include <SharedUtil.h> // for MILLIMETERS_PER_METER
 
 #include "BulletUtil.h"
+#include "ShapeCache.h"
 
 
 class StaticMeshShape : public btBvhTriangleMeshShape {
@@ -27,7 +30,30 @@ public:
         assert(_dataArray);
     }
 
+    // uses a bvh that was previously serialized by serializeBvh() rather than building a new one
+    StaticMeshShape(btTriangleIndexVertexArray* dataArray, const QByteArray& bvhData)
+    :   btBvhTriangleMeshShape(dataArray, true, false), _dataArray(dataArray) {
+        assert(_dataArray);
+        // the bvh is deserialized in place so it needs its own aligned copy of the data
+        _bvhBuffer = btAlignedAlloc(bvhData.size(), 16);
+        memcpy(_bvhBuffer, bvhData.data(), bvhData.size());
+        btOptimizedBvh* bvh = btOptimizedBvh::deSerializeInPlace(_bvhBuffer, (unsigned int)bvhData.size(), false);
+        if (bvh) {
+            setOptimizedBvh(bvh);
+        } else {
+            btAlignedFree(_bvhBuffer);
+            _bvhBuffer = nullptr;
+            buildOptimizedBvh();
+        }
+    }
+
     ~StaticMeshShape() {
+        if (_bvhBuffer) {
+            // we don't own the in-place bvh so btBvhTriangleMeshShape won't delete it
+            m_bvh->~btOptimizedBvh();
+            btAlignedFree(_bvhBuffer);
+            _bvhBuffer = nullptr;
+        }
         assert(_dataArray);
         IndexedMeshArray& meshes = _dataArray->getIndexedMeshArray();
         for (int32_t i = 0; i < meshes.size(); ++i) {
@@ -44,9 +70,24 @@ public:
         _dataArray = nullptr;
     }
 
+    QByteArray serializeBvh() const {
+        QByteArray data;
+        if (m_bvh) {
+            unsigned int size = m_bvh->calculateSerializeBufferSize();
+            // serializeInPlace() wants an aligned buffer
+            void* buffer = btAlignedAlloc(size, 16);
+            if (m_bvh->serializeInPlace(buffer, size, false)) {
+                data = QByteArray((const char*)buffer, (int)size);
+            }
+            btAlignedFree(buffer);
+        }
+        return data;
+    }
+
 private:
     // the StaticMeshShape owns its vertex/index data
     btTriangleIndexVertexArray* _dataArray;
+    void* _bvhBuffer { nullptr };
 };
 
 // the dataArray must be created before we create the StaticMeshShape
@@ -270,6 +311,33 @@ btTriangleIndexVertexArray* createStaticMeshArray(const ShapeInfo& info) {
     return dataArray;
 }
 
+// util method
+btCollisionShape* applyOffset(btCollisionShape* shape, const ShapeInfo& info) {
+    if (glm::length2(info.getOffset()) > MIN_SHAPE_OFFSET * MIN_SHAPE_OFFSET) {
+        // we need to apply an offset
+        btTransform offset;
+        offset.setIdentity();
+        offset.setOrigin(glmToBullet(info.getOffset()));
+
+        if (shape->getShapeType() == (int)COMPOUND_SHAPE_PROXYTYPE) {
+            // this shape is already compound
+            // walk through the child shapes and adjust their transforms
+            btCompoundShape* compound = static_cast<btCompoundShape*>(shape);
+            int32_t numSubShapes = compound->getNumChildShapes();
+            for (int32_t i = 0; i < numSubShapes; ++i) {
+                compound->updateChildTransform(i, offset * compound->getChildTransform(i), false);
+            }
+            compound->recalculateLocalAabb();
+        } else {
+            // wrap this shape in a compound
+            auto compound = new btCompoundShape();
+            compound->addChildShape(offset, shape);
+            shape = compound;
+        }
+    }
+    return shape;
+}
+
 const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info) {
     btCollisionShape* shape = nullptr;
     int type = info.getType();
@@ -434,34 +502,39 @@ const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info)
         break;
     }
     if (shape) {
-        if (glm::length2(info.getOffset()) > MIN_SHAPE_OFFSET * MIN_SHAPE_OFFSET) {
-            // we need to apply an offset
-            btTransform offset;
-            offset.setIdentity();
-            offset.setOrigin(glmToBullet(info.getOffset()));
-
-            if (shape->getShapeType() == (int)COMPOUND_SHAPE_PROXYTYPE) {
-                // this shape is already compound
-                // walk through the child shapes and adjust their transforms
-                btCompoundShape* compound = static_cast<btCompoundShape*>(shape);
-                int32_t numSubShapes = compound->getNumChildShapes();
-                for (int32_t i = 0; i < numSubShapes; ++i) {
-                    compound->updateChildTransform(i, offset * compound->getChildTransform(i), false);
-                }
-                compound->recalculateLocalAabb();
-            } else {
-                // wrap this shape in a compound
-                auto compound = new btCompoundShape();
-                compound->addChildShape(offset, shape);
-                shape = compound;
-            }
-        }
+        shape = applyOffset(shape, info);
     } else {
         // TODO: warn about this case
     }
     return shape;
 }
 
+const btCollisionShape* ShapeFactory::createStaticMeshShapeFromBvh(const ShapeInfo& info, const QByteArray& bvhData) {
+    assert(info.getType() == SHAPE_TYPE_STATIC_MESH);
+    btCollisionShape* shape = nullptr;
+    btTriangleIndexVertexArray* dataArray = createStaticMeshArray(info);
+    if (dataArray) {
+        shape = applyOffset(new StaticMeshShape(dataArray, bvhData), info);
+    }
+    return shape;
+}
+
+QByteArray ShapeFactory::serializeStaticMeshBvh(const btCollisionShape* shape) {
+    assert(shape);
+    if (shape->getShapeType() == (int)COMPOUND_SHAPE_PROXYTYPE) {
+        // the mesh may have been wrapped in a compound to apply an offset
+        const btCompoundShape* compound = static_cast<const btCompoundShape*>(shape);
+        if (compound->getNumChildShapes() != 1) {
+            return QByteArray();
+        }
+        shape = compound->getChildShape(0);
+    }
+    if (shape->getShapeType() != (int)TRIANGLE_MESH_SHAPE_PROXYTYPE) {
+        return QByteArray();
+    }
+    return static_cast<const StaticMeshShape*>(shape)->serializeBvh();
+}
+
 void ShapeFactory::deleteShape(const btCollisionShape* shape) {
     assert(shape);
     // ShapeFactory is responsible for deleting all shapes, even the const ones that are stored
@@ -484,6 +557,21 @@ void ShapeFactory::deleteShape(const btCollisionShape* shape) {
 }
 
 void ShapeFactory::Worker::run() {
-    shape = ShapeFactory::createShapeFromInfo(shapeInfo);
+    quint64 start = usecTimestampNow();
+    if (shapeCache && ShapeCache::isCacheable(shapeInfo)) {
+        std::string key = ShapeCache::computeKey(shapeInfo);
+        shape = shapeCache->loadShape(shapeInfo, key);
+        if (shape) {
+            loadedFromCache = true;
+        } else {
+            shape = ShapeFactory::createShapeFromInfo(shapeInfo);
+            if (shape) {
+                shapeCache->saveShape(key, shape);
+            }
+        }
+    } else {
+        shape = ShapeFactory::createShapeFromInfo(shapeInfo);
+    }
+    buildTime = usecTimestampNow() - start;
     emit submitWork(this);
 }
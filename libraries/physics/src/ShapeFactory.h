@@ -12,6 +12,8 @@
 #ifndef hifi_ShapeFactory_h
 #define hifi_ShapeFactory_h
 
+#include <memory>
+
 #include <btBulletDynamicsCommon.h>
 #include <glm/glm.hpp>
 #include <QObject>
@@ -19,12 +21,18 @@
 
 #include <ShapeInfo.h>
 
+class ShapeCache;
+
 // The ShapeFactory assembles and correctly disassembles btCollisionShapes.
 
 namespace ShapeFactory {
     const btCollisionShape* createShapeFromInfo(const ShapeInfo& info);
     void deleteShape(const btCollisionShape* shape);
 
+    // static mesh shapes spend most of their construction time building the bvh, which can be saved and reused
+    const btCollisionShape* createStaticMeshShapeFromBvh(const ShapeInfo& info, const QByteArray& bvhData);
+    QByteArray serializeStaticMeshBvh(const btCollisionShape* shape);
+
     class Worker : public QObject, public QRunnable {
         Q_OBJECT
     public:
@@ -32,6 +40,9 @@ namespace ShapeFactory {
         void run() override;
         ShapeInfo shapeInfo;
         const btCollisionShape* shape;
+        std::shared_ptr<ShapeCache> shapeCache;
+        quint64 buildTime { 0 }; // usec
+        bool loadedFromCache { false };
     signals:
         void submitWork(Worker*);
     };
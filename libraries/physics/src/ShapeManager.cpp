@@ -66,6 +66,7 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
                 worker->shapeInfo = info;
                 _deadWorker = nullptr;
             }
+            worker->shapeCache = _shapeCache;
             // we will delete worker manually later
             worker->setAutoDelete(false);
             QObject::connect(worker, &ShapeFactory::Worker::submitWork, this, &ShapeManager::acceptWork);
@@ -206,6 +207,15 @@ bool ShapeManager::hasShape(const btCollisionShape* shape) const {
     return false;
 }
 
+float ShapeManager::getAverageShapeBuildTime() const {
+    return _numShapesBuilt > 0 ? (float)_totalShapeBuildTime / (float)(USECS_PER_MSEC * _numShapesBuilt) : 0.0f;
+}
+
+float ShapeManager::getAverageShapeLoadTime() const {
+    return _numShapesLoadedFromCache > 0 ?
+        (float)_totalShapeLoadTime / (float)(USECS_PER_MSEC * _numShapesLoadedFromCache) : 0.0f;
+}
+
 // slot: called when ShapeFactory::Worker is done building shape
 void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
     auto itr = std::find(_pendingMeshShapes.begin(), _pendingMeshShapes.end(), worker->shapeInfo.getHash());
@@ -222,6 +232,14 @@ void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
 
         // cache the new shape
         if (worker->shape) {
+            if (worker->loadedFromCache) {
+                ++_numShapesLoadedFromCache;
+                _totalShapeLoadTime += worker->buildTime;
+            } else {
+                ++_numShapesBuilt;
+                _totalShapeBuildTime += worker->buildTime;
+            }
+
             ShapeReference newRef;
             // refCount is zero because nothing is using the shape yet
             newRef.refCount = 0;
@@ -277,6 +295,9 @@ void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
     // save this dead worker for later
     worker->shapeInfo.clear();
     worker->shape = nullptr;
+    worker->shapeCache.reset();
+    worker->buildTime = 0;
+    worker->loadedFromCache = false;
     _deadWorker = worker;
     ++_workDeliveryCount;
 }
@@ -14,6 +14,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <vector>
 
 #include <QObject>
@@ -22,6 +23,7 @@
 
 #include <ShapeInfo.h>
 
+#include "ShapeCache.h"
 #include "ShapeFactory.h"
 #include "HashKey.h"
 
@@ -46,6 +48,9 @@
 // doesn't delete it right away.  Instead it puts the shape's key on a list delete
 // later.  When that list grows big enough the ShapeManager will remove any matching
 // entries that still have zero ref-count.
+//
+// Static mesh shapes are built on worker threads.  If a ShapeCache has been supplied the workers will first try
+// to load the shape from disk, and will save any large shape they had to build from scratch.
 
 
 class ShapeManager : public QObject {
@@ -74,6 +79,14 @@ public:
     uint32_t getWorkRequestCount() const { return _workRequestCount; }
     uint32_t getWorkDeliveryCount() const { return _workDeliveryCount; }
 
+    void setShapeCache(std::shared_ptr<ShapeCache> shapeCache) { _shapeCache = shapeCache; }
+
+    // off-thread shape stats
+    uint32_t getNumShapesBuilt() const { return _numShapesBuilt; }
+    uint32_t getNumShapesLoadedFromCache() const { return _numShapesLoadedFromCache; }
+    float getAverageShapeBuildTime() const; // msec
+    float getAverageShapeLoadTime() const; // msec
+
 protected slots:
     void acceptWork(ShapeFactory::Worker* worker);
 
@@ -107,6 +120,11 @@ private:
     uint32_t _ringIndex { 0 };
     std::atomic_uint _workRequestCount { 0 };
     std::atomic_uint _workDeliveryCount { 0 };
+    std::shared_ptr<ShapeCache> _shapeCache;
+    quint64 _totalShapeBuildTime { 0 }; // usec
+    quint64 _totalShapeLoadTime { 0 }; // usec
+    uint32_t _numShapesBuilt { 0 };
+    uint32_t _numShapesLoadedFromCache { 0 };
 };
 
 #endif // hifi_ShapeManager_h
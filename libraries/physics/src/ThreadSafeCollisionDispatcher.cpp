@@ -0,0 +1,102 @@
+//
+//  ThreadSafeCollisionDispatcher.cpp
+//  libraries/physics/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ThreadSafeCollisionDispatcher.h"
+
+#include <algorithm>
+
+#include <BulletCollision/CollisionShapes/btCollisionShape.h>
+#include <BulletCollision/NarrowPhaseCollision/btPersistentManifold.h>
+#include <LinearMath/btThreads.h>
+
+#include "PhysicsTaskScheduler.h"
+#include "Profile.h"
+
+static bool manifoldLessThan(const btPersistentManifold* a, const btPersistentManifold* b) {
+    int a0 = a->getBody0()->getWorldArrayIndex();
+    int b0 = b->getBody0()->getWorldArrayIndex();
+    if (a0 != b0) {
+        return a0 < b0;
+    }
+    return a->getBody1()->getWorldArrayIndex() < b->getBody1()->getWorldArrayIndex();
+}
+
+ThreadSafeCollisionDispatcher::ThreadSafeCollisionDispatcher(btCollisionConfiguration* collisionConfiguration, int grainSize) :
+    btCollisionDispatcherMt(collisionConfiguration, grainSize) {
+    // btCollisionDispatcherMt sizes these for the scheduler installed at construction
+    m_batchManifoldsPtr.resize(BT_MAX_THREAD_COUNT);
+    m_batchReleasePtr.resize(BT_MAX_THREAD_COUNT);
+}
+
+btPersistentManifold* ThreadSafeCollisionDispatcher::getNewManifold(const btCollisionObject* body0,
+                                                                    const btCollisionObject* body1) {
+    if (!m_batchUpdating) {
+        return btCollisionDispatcherMt::getNewManifold(body0, body1);
+    }
+    // same as btCollisionDispatcherMt::getNewManifold(), but batched by arena slot rather than btGetCurrentThreadIndex()
+    btScalar contactBreakingThreshold = (m_dispatcherFlags & CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD) ?
+        btMin(body0->getCollisionShape()->getContactBreakingThreshold(gContactBreakingThreshold),
+              body1->getCollisionShape()->getContactBreakingThreshold(gContactBreakingThreshold)) :
+        gContactBreakingThreshold;
+    btScalar contactProcessingThreshold = btMin(body0->getContactProcessingThreshold(), body1->getContactProcessingThreshold());
+
+    void* mem = m_persistentManifoldPoolAllocator->allocate(sizeof(btPersistentManifold));
+    if (!mem) {
+        if (m_dispatcherFlags & CD_DISABLE_CONTACTPOOL_DYNAMIC_ALLOCATION) {
+            btAssert(0);
+            return nullptr;
+        }
+        mem = btAlignedAlloc(sizeof(btPersistentManifold), 16);
+    }
+    btPersistentManifold* manifold = new (mem) btPersistentManifold(body0, body1, 0, contactBreakingThreshold,
+                                                                    contactProcessingThreshold);
+    m_batchManifoldsPtr[PhysicsTaskScheduler::getCurrentThreadIndex()].push_back(manifold);
+    return manifold;
+}
+
+void ThreadSafeCollisionDispatcher::releaseManifold(btPersistentManifold* manifold) {
+    if (!m_batchUpdating) {
+        btCollisionDispatcherMt::releaseManifold(manifold);
+        return;
+    }
+    // freed by btCollisionDispatcherMt::dispatchAllCollisionPairs() once the batch is done
+    clearManifold(manifold);
+    m_batchReleasePtr[PhysicsTaskScheduler::getCurrentThreadIndex()].push_back(manifold);
+}
+
+void ThreadSafeCollisionDispatcher::dispatchAllCollisionPairs(btOverlappingPairCache* pairCache, const btDispatcherInfo& info,
+                                                              btDispatcher* dispatcher) {
+    btCollisionDispatcherMt::dispatchAllCollisionPairs(pairCache, info, dispatcher);
+    btITaskScheduler* taskScheduler = btGetTaskScheduler();
+    if (taskScheduler && taskScheduler->getNumThreads() > 1) {
+        sortManifolds();
+    }
+}
+
+void ThreadSafeCollisionDispatcher::sortManifolds() {
+    int numManifolds = m_manifoldsPtr.size();
+    if (numManifolds < 2) {
+        return;
+    }
+    btPersistentManifold** begin = &m_manifoldsPtr[0];
+    btPersistentManifold** end = begin + numManifolds;
+    // manifolds that survive from the previous step are already in order, so this is usually a cheap check
+    if (std::is_sorted(begin, end, manifoldLessThan)) {
+        return;
+    }
+    DETAILED_PROFILE_RANGE(simulation_physics, "sortManifolds");
+    // stable: manifolds of one object pair (e.g. compound children) were all created by the same near callback
+    // on one thread, so their relative order is already deterministic
+    std::stable_sort(begin, end, manifoldLessThan);
+    for (int i = 0; i < numManifolds; ++i) {
+        m_manifoldsPtr[i]->m_index1a = i;
+    }
+}
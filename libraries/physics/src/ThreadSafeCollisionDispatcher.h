@@ -0,0 +1,38 @@
+//
+//  ThreadSafeCollisionDispatcher.h
+//  libraries/physics/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_ThreadSafeCollisionDispatcher_h
+#define hifi_ThreadSafeCollisionDispatcher_h
+
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+
+// Runs the narrowphase across Bullet's task scheduler threads.  When more than one thread is in use new manifolds
+// are appended in whatever order the worker threads finish, so after each dispatch we re-sort the manifold list by
+// the world indices of the colliding objects.  This keeps the per-island contact order, and hence the solver results,
+// independent of thread timing.
+// The per-thread manifold batches are sized for every thread Bullet can run on and indexed by the scheduler's arena
+// slot (see PhysicsTaskScheduler::getCurrentThreadIndex()), since the dispatcher may outlive thread count changes.
+class ThreadSafeCollisionDispatcher : public btCollisionDispatcherMt {
+public:
+    static const int DEFAULT_GRAIN_SIZE = 40;
+
+    ThreadSafeCollisionDispatcher(btCollisionConfiguration* collisionConfiguration, int grainSize = DEFAULT_GRAIN_SIZE);
+
+    virtual void dispatchAllCollisionPairs(btOverlappingPairCache* pairCache, const btDispatcherInfo& info,
+                                           btDispatcher* dispatcher) override;
+    virtual btPersistentManifold* getNewManifold(const btCollisionObject* body0, const btCollisionObject* body1) override;
+    virtual void releaseManifold(btPersistentManifold* manifold) override;
+
+private:
+    void sortManifolds();
+};
+
+#endif // hifi_ThreadSafeCollisionDispatcher_h
@@ -24,9 +24,11 @@
 ThreadSafeDynamicsWorld::ThreadSafeDynamicsWorld(
         btDispatcher* dispatcher,
         btBroadphaseInterface* pairCache,
-        btConstraintSolver* constraintSolver,
+        btConstraintSolverPoolMt* constraintSolverPool,
         btCollisionConfiguration* collisionConfiguration)
-    :   btDiscreteDynamicsWorld(dispatcher, pairCache, constraintSolver, collisionConfiguration) {
+    :   btDiscreteDynamicsWorldMt(dispatcher, pairCache, constraintSolverPool, nullptr, collisionConfiguration) {
+    // NOTE: we don't supply a multi-threaded solver for large islands (the nullptr above) because its batched
+    // constraint order depends on thread timing.  Each island is instead solved whole by one pooled solver.
 }
 
 int ThreadSafeDynamicsWorld::stepSimulationWithSubstepCallback(btScalar timeStep, int maxSubSteps,
@@ -92,6 +94,12 @@ int ThreadSafeDynamicsWorld::stepSimulationWithSubstepCallback(btScalar timeStep
     return subSteps;
 }
 
+void ThreadSafeDynamicsWorld::createPredictiveContacts(btScalar timeStep) {
+    // The parallel version appends predictive manifolds in thread completion order, and CCD objects are few,
+    // so we create them serially to keep the manifold order deterministic.
+    btDiscreteDynamicsWorld::createPredictiveContacts(timeStep);
+}
+
 // call this instead of non-virtual btDiscreteDynamicsWorld::synchronizeSingleMotionState()
 void ThreadSafeDynamicsWorld::synchronizeMotionState(btRigidBody* body) {
     btAssert(body);
@@ -56,7 +56,7 @@ float Clip::position() const {
 }
 
 // FIXME move to frame?
-bool writeFrame(QIODevice& output, const Frame& frame, bool compressed = true) {
+bool writeFrame(QIODevice& output, const Frame& frame) {
     if (frame.type == Frame::TYPE_INVALID) {
         qWarning() << "Attempting to write invalid frame";
         return true;
@@ -71,19 +71,15 @@ bool writeFrame(QIODevice& output, const Frame& frame, bool compressed = true) {
     if (written != sizeof(Frame::Time)) {
         return false;
     }
-    QByteArray frameData = frame.data;
-    if (compressed) {
-        frameData = qCompress(frameData);
-    }
 
-    uint16_t dataSize = frameData.size();
+    uint16_t dataSize = frame.data.size();
     written = output.write((char*)&dataSize, sizeof(FrameSize));
     if (written != sizeof(uint16_t)) {
         return false;
     }
 
     if (dataSize != 0) {
-        written = output.write(frameData);
+        written = output.write(frame.data.constData(), dataSize);
         if (written != dataSize) {
             return false;
         }
@@ -91,6 +87,24 @@ bool writeFrame(QIODevice& output, const Frame& frame, bool compressed = true) {
     return true;
 }
 
+// Writes the index entries as frames of up to MAX_INDEX_FRAME_ENTRIES entries, followed by the footer that locates them
+static bool writeFrameIndex(QIODevice& output, quint64 indexOffset, const QByteArray& index, uint32_t entryCount) {
+    static const int MAX_INDEX_FRAME_SIZE = PointerClip::MAX_INDEX_FRAME_ENTRIES * PointerClip::INDEX_ENTRY_SIZE;
+    for (int i = 0; i < index.size(); i += MAX_INDEX_FRAME_SIZE) {
+        if (!writeFrame(output, Frame({ Frame::TYPE_INDEX, 0, index.mid(i, MAX_INDEX_FRAME_SIZE) }))) {
+            return false;
+        }
+    }
+
+    uint32_t magic = PointerClip::INDEX_MAGIC;
+    QByteArray footer;
+    footer.reserve(PointerClip::INDEX_FOOTER_SIZE);
+    footer.append((const char*)&indexOffset, sizeof(quint64));
+    footer.append((const char*)&entryCount, sizeof(uint32_t));
+    footer.append((const char*)&magic, sizeof(uint32_t));
+    return writeFrame(output, Frame({ Frame::TYPE_INDEX, 0, footer }));
+}
+
 const QString Clip::FRAME_TYPE_MAP = QStringLiteral("frameTypes");
 const QString Clip::FRAME_COMREPSSION_FLAG = QStringLiteral("compressed");
 
@@ -103,20 +117,36 @@ bool Clip::write(QIODevice& output) {
 
     QJsonObject rootObject;
     rootObject.insert(FRAME_TYPE_MAP, frameTypeObj);
-    // Always mark new files as compressed
-    rootObject.insert(FRAME_COMREPSSION_FLAG, true);
+    // New files are never compressed, so that their frames can be read in place from the mapped file
+    rootObject.insert(FRAME_COMREPSSION_FLAG, false);
     QByteArray headerFrameData = QCborValue::fromJsonValue(rootObject).toCbor();
-    // Never compress the header frame
-    if (!writeFrame(output, Frame({ Frame::TYPE_HEADER, 0, headerFrameData }), false)) {
+    if (!writeFrame(output, Frame({ Frame::TYPE_HEADER, 0, headerFrameData }))) {
         return false;
     }
+    quint64 offset = PointerClip::MINIMUM_FRAME_SIZE + headerFrameData.size();
+
+    QByteArray index;
+    uint32_t entryCount = 0;
+    index.reserve((int)(frameCount() * PointerClip::INDEX_ENTRY_SIZE));
 
     seek(0);
 
     for (auto frame = nextFrame(); frame; frame = nextFrame()) {
+        if (frame->type == Frame::TYPE_INVALID) {
+            continue;
+        }
         if (!writeFrame(output, *frame)) {
             return false;
         }
+
+        quint64 dataOffset = offset + PointerClip::MINIMUM_FRAME_SIZE;
+        FrameSize dataSize = frame->data.size();
+        index.append((const char*)&dataOffset, sizeof(quint64));
+        index.append((const char*)&(frame->timeOffset), sizeof(Frame::Time));
+        index.append((const char*)&(frame->type), sizeof(FrameType));
+        index.append((const char*)&dataSize, sizeof(FrameSize));
+        offset = dataOffset + dataSize;
+        ++entryCount;
     }
-    return true;
+    return writeFrameIndex(output, offset, index, entryCount);
 }
@@ -27,8 +27,10 @@ NetworkClipLoader::NetworkClipLoader(const QUrl& url) :
 }
 
 void NetworkClip::init(const QByteArray& clipData) {
-    _clipData = clipData;
-    PointerClip::init((uchar*)_clipData.data(), _clipData.size());
+    // Frames read from the clip are views of the downloaded data, so it's owned by the clip and its frames together
+    auto ownedClipData = std::make_shared<const QByteArray>(clipData);
+    PointerClip::init(DataPointer(ownedClipData, reinterpret_cast<const uchar*>(ownedClipData->constData())),
+                      ownedClipData->size());
 }
 
 void NetworkClipLoader::downloadFinished(const QByteArray& data) {
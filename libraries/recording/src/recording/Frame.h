@@ -36,6 +36,8 @@ struct FrameHeader {
 
     static const FrameType TYPE_INVALID = 0xFFFF;
     static const FrameType TYPE_HEADER = 0x0;
+    // Frames of the clip file index, never registered so that older readers skip them
+    static const FrameType TYPE_INDEX = 0xFFFE;
 
     static Time secondsToFrameTime(float seconds);
     static float frameTimeToSeconds(Time frameTime);
@@ -60,6 +62,9 @@ public:
     using Handler = std::function<void(Frame::ConstPointer frame)>;
 
     QByteArray data;
+    // Set when data is a view of memory it doesn't own, such as a memory mapped clip, to keep that memory alive as long
+    // as the frame.  Handlers that keep the data around after returning need to deep copy it.
+    std::shared_ptr<const void> dataOwner;
 
     Frame() {}
     Frame(FrameType type, float timeOffset, const QByteArray& data)
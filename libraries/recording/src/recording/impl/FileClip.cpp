@@ -21,21 +21,32 @@
 
 using namespace recording;
 
-FileClip::FileClip(const QString& fileName) : _file(fileName) {
-    auto size = _file.size();
+FileClip::FileClip(const QString& fileName) : _fileName(fileName) {
+    auto file = std::make_shared<QFile>(fileName);
+    auto size = file->size();
     qDebug(recordingLog) << "Opening file of size: " << size;
-    bool opened = _file.open(QIODevice::ReadOnly);
+    bool opened = file->open(QIODevice::ReadOnly);
     if (!opened) {
         qCWarning(recordingLog) << "Unable to open file " << fileName;
         return;
     }
-    auto mappedFile = _file.map(0, size, QFile::MapPrivateOption);
-    init(mappedFile, size);
+    auto mappedFile = file->map(0, size, QFile::MapPrivateOption);
+    if (!mappedFile) {
+        qCWarning(recordingLog) << "Unable to map file " << fileName;
+        return;
+    }
+
+    // Frames read from the clip are views of the mapping, so the file stays mapped until both the clip and the last
+    // of its frames are gone
+    DataPointer data(mappedFile, [file](const uchar* mapped) {
+        file->unmap(const_cast<uchar*>(mapped));
+    });
+    init(data, size);
 }
 
 
 QString FileClip::getName() const {
-    return _file.fileName();
+    return _fileName;
 }
 
 
@@ -59,9 +70,5 @@ bool FileClip::write(const QString& fileName, Clip::Pointer clip) {
 
 FileClip::~FileClip() {
     Locker lock(_mutex);
-    _file.unmap(_data);
-    if (_file.isOpen()) {
-        _file.close();
-    }
     reset();
 }
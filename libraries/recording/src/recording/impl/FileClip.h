@@ -28,7 +28,7 @@ public:
     static bool write(const QString& filePath, Clip::Pointer clip);
 
 private:
-    QFile _file;
+    QString _fileName;
 };
 
 }
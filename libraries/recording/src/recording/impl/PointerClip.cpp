@@ -45,49 +45,125 @@ FrameTranslationMap parseTranslationMap(const QJsonDocument& doc) {
 }
 
 
-PointerFrameHeaderList parseFrameHeaders(uchar* const start, const size_t& size) {
+// Reads the header of the frame at offset, failing if the frame doesn't end before limit
+static bool readFrameHeader(const uchar* const start, size_t limit, size_t offset, PointerFrameHeader& header) {
+    if (offset > limit || limit - offset < PointerClip::MINIMUM_FRAME_SIZE) {
+        return false;
+    }
+    auto current = start + offset;
+    memcpy(&(header.type), current, sizeof(FrameType));
+    current += sizeof(FrameType);
+    memcpy(&(header.timeOffset), current, sizeof(Frame::Time));
+    current += sizeof(Frame::Time);
+    memcpy(&(header.size), current, sizeof(FrameSize));
+    current += sizeof(FrameSize);
+    header.fileOffset = current - start;
+    return (limit - header.fileOffset) >= header.size;
+}
+
+PointerFrameHeaderList parseFrameHeaders(const uchar* const start, const size_t& size) {
     PointerFrameHeaderList results;
-    auto current = start;
-    auto end = current + size;
+    size_t offset = 0;
     // Read all the frame headers
     // FIXME move to Frame::readHeader?
-    while (end - current >= PointerClip::MINIMUM_FRAME_SIZE) {
-        PointerFrameHeader header;
-        memcpy(&(header.type), current, sizeof(FrameType));
-        current += sizeof(FrameType);
-        memcpy(&(header.timeOffset), current, sizeof(Frame::Time));
-        current += sizeof(Frame::Time);
-        memcpy(&(header.size), current, sizeof(FrameSize));
-        current += sizeof(FrameSize);
-        header.fileOffset = current - start;
-        if (end - current < header.size) {
-            break;
-        }
-        current += header.size;
+    PointerFrameHeader header;
+    while (readFrameHeader(start, size, offset, header)) {
+        offset = header.fileOffset + header.size;
         results.push_back(header);
     }
-    qDebug(recordingLog) << "Parsed source data into " << results.size() << " frames";
-//    int i = 0;
-//    for (const auto& frameHeader : results) {
-//        qDebug(recordingLog) << "Frame " << i++ << " time " << frameHeader.timeOffset << " Type " << frameHeader.type;
-//    }
     return results;
 }
 
+// Reads the frame headers from the index at the end of the clip, without touching the frames themselves
+static bool parseFrameIndex(const uchar* const start, const size_t& size, PointerFrameHeaderList& results) {
+    static const size_t FOOTER_FRAME_SIZE = PointerClip::MINIMUM_FRAME_SIZE + PointerClip::INDEX_FOOTER_SIZE;
+    if (size < FOOTER_FRAME_SIZE) {
+        return false;
+    }
+
+    const size_t footerOffset = size - FOOTER_FRAME_SIZE;
+    PointerFrameHeader footer;
+    if (!readFrameHeader(start, size, footerOffset, footer) || footer.type != Frame::TYPE_INDEX ||
+        footer.size != PointerClip::INDEX_FOOTER_SIZE) {
+        return false;
+    }
+
+    quint64 indexOffset;
+    uint32_t entryCount;
+    uint32_t magic;
+    auto current = start + footer.fileOffset;
+    memcpy(&indexOffset, current, sizeof(quint64));
+    current += sizeof(quint64);
+    memcpy(&entryCount, current, sizeof(uint32_t));
+    current += sizeof(uint32_t);
+    memcpy(&magic, current, sizeof(uint32_t));
+    if (magic != PointerClip::INDEX_MAGIC || indexOffset > footerOffset ||
+        entryCount > (footerOffset - indexOffset) / PointerClip::INDEX_ENTRY_SIZE) {
+        return false;
+    }
+
+    // The file header isn't part of the index
+    PointerFrameHeader fileHeader;
+    if (!readFrameHeader(start, indexOffset, 0, fileHeader)) {
+        return false;
+    }
+    results.reserve(entryCount + 1);
+    results.push_back(fileHeader);
+
+    size_t offset = indexOffset;
+    while (offset < footerOffset) {
+        PointerFrameHeader indexFrame;
+        if (!readFrameHeader(start, footerOffset, offset, indexFrame) || indexFrame.type != Frame::TYPE_INDEX ||
+            (indexFrame.size % PointerClip::INDEX_ENTRY_SIZE) != 0) {
+            return false;
+        }
+
+        auto entry = start + indexFrame.fileOffset;
+        auto end = entry + indexFrame.size;
+        for (; entry < end; entry += PointerClip::INDEX_ENTRY_SIZE) {
+            PointerFrameHeader header;
+            current = entry;
+            memcpy(&(header.fileOffset), current, sizeof(quint64));
+            current += sizeof(quint64);
+            memcpy(&(header.timeOffset), current, sizeof(Frame::Time));
+            current += sizeof(Frame::Time);
+            memcpy(&(header.type), current, sizeof(FrameType));
+            current += sizeof(FrameType);
+            memcpy(&(header.size), current, sizeof(FrameSize));
+            if (header.fileOffset > indexOffset || indexOffset - header.fileOffset < header.size) {
+                return false;
+            }
+            results.push_back(header);
+        }
+        offset = indexFrame.fileOffset + indexFrame.size;
+    }
+    return results.size() == (size_t)entryCount + 1;
+}
+
 void PointerClip::reset() {
+    ArrayClip::reset();
     _frames.clear();
-    _data = nullptr;
+    _frameTypeTables.clear();
+    _data.reset();
     _size = 0;
+    _indexed = false;
     _header = QJsonDocument();
 }
 
-void PointerClip::init(uchar* data, size_t size) {
+void PointerClip::init(const DataPointer& data, size_t size) {
     reset();
 
     _data = data;
     _size = size;
 
-    auto parsedFrameHeaders = parseFrameHeaders(data, size);
+    PointerFrameHeaderList parsedFrameHeaders;
+    _indexed = _data && parseFrameIndex(_data.get(), size, parsedFrameHeaders);
+    if (!_indexed && _data) {
+        parsedFrameHeaders = parseFrameHeaders(_data.get(), size);
+    }
+    qDebug(recordingLog) << "Parsed source data into " << parsedFrameHeaders.size() << " frames"
+        << (_indexed ? "from the index" : "");
+
     // Verify that at least one frame exists and that the first frame is a header
     if (0 == parsedFrameHeaders.size()) {
         qWarning() << "No frames found, invalid file";
@@ -97,15 +173,15 @@ void PointerClip::init(uchar* data, size_t size) {
 
     // Grab the file header
     {
-        auto fileHeaderFrameHeader = *parsedFrameHeaders.begin();
-        parsedFrameHeaders.pop_front();
+        const auto& fileHeaderFrameHeader = parsedFrameHeaders.front();
         if (fileHeaderFrameHeader.type != Frame::TYPE_HEADER) {
             qWarning() << "Missing header frame, invalid file";
             reset();
             return;
         }
 
-        QByteArray fileHeaderData((char*)_data + fileHeaderFrameHeader.fileOffset, fileHeaderFrameHeader.size);
+        auto fileHeaderData = QByteArray::fromRawData(reinterpret_cast<const char*>(_data.get()) + fileHeaderFrameHeader.fileOffset,
+                                                      fileHeaderFrameHeader.size);
 
         _header = QJsonDocument(QCborValue::fromCbor(fileHeaderData).toJsonValue().toObject());
     }
@@ -124,9 +200,10 @@ void PointerClip::init(uchar* data, size_t size) {
             return;
         }
 
-        // Update the loaded headers with the frame data
-        _frames.reserve(parsedFrameHeaders.size());
-        for (auto& frameHeader : parsedFrameHeaders) {
+        // Update the loaded headers with the frame data, the index frames are dropped here as they are never in the map
+        _frames.reserve(parsedFrameHeaders.size() - 1);
+        for (auto itr = parsedFrameHeaders.begin() + 1; itr != parsedFrameHeaders.end(); ++itr) {
+            auto frameHeader = *itr;
             if (!translationMap.contains(frameHeader.type)) {
                 continue;
             }
@@ -135,6 +212,9 @@ void PointerClip::init(uchar* data, size_t size) {
         }
     }
 
+    for (uint32_t i = 0; i < (uint32_t)_frames.size(); ++i) {
+        _frameTypeTables[_frames[i].type].push_back(i);
+    }
 }
 
 // Internal only function, needs no locking
@@ -146,15 +226,43 @@ FrameConstPointer PointerClip::readFrame(size_t frameIndex) const {
         result->type = header.type;
         result->timeOffset = header.timeOffset;
         if (header.size) {
-            result->data.insert(0, reinterpret_cast<char*>(_data)+header.fileOffset, header.size);
+            auto frameData = _data.get() + header.fileOffset;
             if (_compressed) {
-                result->data = qUncompress(result->data);
+                result->data = qUncompress(frameData, header.size);
+            } else {
+                result->data = QByteArray::fromRawData(reinterpret_cast<const char*>(frameData), header.size);
+                result->dataOwner = _data;
             }
         }
     }
     return result;
 }
 
+size_t PointerClip::frameCountOfType(FrameType type) const {
+    Locker lock(_mutex);
+    auto table = _frameTypeTables.find(type);
+    return table != _frameTypeTables.end() ? table->second.size() : 0;
+}
+
+FrameConstPointer PointerClip::lastFrameOfType(FrameType type, Frame::Time time) const {
+    Locker lock(_mutex);
+    auto table = _frameTypeTables.find(type);
+    if (table == _frameTypeTables.end()) {
+        return FrameConstPointer();
+    }
+
+    const auto& frameIndices = table->second;
+    auto itr = std::upper_bound(frameIndices.begin(), frameIndices.end(), time,
+        [this](Frame::Time time, uint32_t frameIndex)->bool {
+            return time < _frames[frameIndex].timeOffset;
+        }
+    );
+    if (itr == frameIndices.begin()) {
+        return FrameConstPointer();
+    }
+    return readFrame(*(itr - 1));
+}
+
 void PointerClip::addFrame(FrameConstPointer) {
     throw std::runtime_error("Pointer clips are read only, use duplicate to create a read/write clip");
 }
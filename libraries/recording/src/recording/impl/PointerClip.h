@@ -12,6 +12,7 @@
 
 #include "ArrayClip.h"
 
+#include <map>
 #include <mutex>
 
 #include <QtCore/QJsonDocument>
@@ -21,36 +22,60 @@
 namespace recording {
 
 struct PointerFrameHeader : public FrameHeader {
-    FrameType type;
-    Frame::Time timeOffset;
-    uint16_t size;
+    FrameSize size;
     quint64 fileOffset;
 };
 
-using PointerFrameHeaderList = std::list<PointerFrameHeader>;
+using PointerFrameHeaderList = std::vector<PointerFrameHeader>;
 
+// A read only clip over clip file data held in memory, usually a memory mapped file.
+//
+// Clips written by Clip::write end with an index of the frame times, types and offsets, which is read instead of
+// walking every frame of the clip, so opening even hours long clips only touches the index.  Their frames are stored
+// uncompressed and read as views of the clip data rather than copies, so playing a clip back costs no more memory than
+// the index.  Older clips, without an index or with compressed frames, are still read by walking the frames and
+// decompressing them.
 class PointerClip : public ArrayClip<PointerFrameHeader> {
 public:
     using Pointer = std::shared_ptr<PointerClip>;
+    using DataPointer = std::shared_ptr<const uchar>;
 
     PointerClip() {};
-    PointerClip(uchar* data, size_t size) { init(data, size); }
+    PointerClip(const DataPointer& data, size_t size) { init(data, size); }
 
-    void init(uchar* data, size_t size);
+    void init(const DataPointer& data, size_t size);
     virtual void addFrame(FrameConstPointer) override;
     const QJsonDocument& getHeader() const {
         return _header;
     }
 
+    bool isIndexed() const { return _indexed; }
+
+    size_t frameCountOfType(FrameType type) const;
+    /// \return the last frame of the given type at or before time, or nullptr if there is none
+    FrameConstPointer lastFrameOfType(FrameType type, Frame::Time time) const;
+
     // FIXME move to frame?
     static const qint64 MINIMUM_FRAME_SIZE = sizeof(FrameType) + sizeof(Frame::Time) + sizeof(FrameSize);
+
+    // The index follows the last frame of the clip as TYPE_INDEX frames, each holding up to MAX_INDEX_FRAME_ENTRIES
+    // entries of the data offset, time, type and size of a frame.  The last frame of the clip is a TYPE_INDEX footer
+    // holding the offset of the first index frame, the number of entries and INDEX_MAGIC.
+    static const uint32_t INDEX_MAGIC = 0x49524648; // "HFRI"
+    static const FrameSize INDEX_ENTRY_SIZE = sizeof(quint64) + sizeof(Frame::Time) + sizeof(FrameType) + sizeof(FrameSize);
+    static const FrameSize INDEX_FOOTER_SIZE = sizeof(quint64) + sizeof(uint32_t) + sizeof(uint32_t);
+    static const size_t MAX_INDEX_FRAME_ENTRIES = std::numeric_limits<FrameSize>::max() / INDEX_ENTRY_SIZE;
+
 protected:
     void reset() override;
     virtual FrameConstPointer readFrame(size_t index) const override;
     QJsonDocument _header;
-    uchar* _data { nullptr };
+    DataPointer _data;
     size_t _size { 0 };
     bool _compressed { true };
+    bool _indexed { false };
+    // The indices into _frames of the frames of each type, in time order
+    std::map<FrameType, std::vector<uint32_t>> _frameTypeTables;
 };
 
 }
@@ -39,6 +39,7 @@ namespace render {
             int _outOfView = 0;
             int _tooSmall = 0;
             int _rendered = 0;
+            float _cullTime = 0.0f; // msec
         };
 
         int _materialSwitches = 0;
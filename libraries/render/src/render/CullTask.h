@@ -84,15 +84,18 @@ namespace render {
         Q_PROPERTY(int numItems READ getNumItems)
         Q_PROPERTY(bool freezeFrustum MEMBER freezeFrustum WRITE setFreezeFrustum)
         Q_PROPERTY(bool skipCulling MEMBER skipCulling WRITE setSkipCulling)
+        Q_PROPERTY(bool parallel MEMBER parallel WRITE setParallel)
     public:
         int numItems{ 0 };
         int getNumItems() { return numItems; }
 
         bool freezeFrustum{ false };
         bool skipCulling{ false };
+        bool parallel{ true };
     public slots:
         void setFreezeFrustum(bool enabled) { freezeFrustum = enabled; emit dirty(); }
         void setSkipCulling(bool enabled) { skipCulling = enabled; emit dirty(); }
+        void setParallel(bool enabled) { parallel = enabled; emit dirty(); }
     signals:
         void dirty();
     };
@@ -115,6 +118,7 @@ namespace render {
         bool _freezeFrustum { false }; // initialized by Config
         bool _justFrozeFrustum { false };
         bool _overrideSkipCulling { false };
+        bool _parallel { true }; // cull the items on several threads
         ViewFrustum _frozenFrustum;
 
         void configure(const Config& config);
@@ -190,6 +190,7 @@ Scene::Scene(glm::vec3 origin, float size) :
 
 Scene::~Scene() {
     qCDebug(renderlogging) << "Scene::~Scene()";
+    takeTransactionQueue();
 }
 
 ItemID Scene::allocateID() {
@@ -203,28 +204,48 @@ bool Scene::isAllocatedID(const ItemID& id) const {
 
 /// Enqueue change batch to the scene
 void Scene::enqueueTransaction(const Transaction& transaction) {
-    std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-    _transactionQueue.emplace_back(transaction);
+    pushTransaction(new TransactionNode(Transaction(transaction)));
 }
 
 void Scene::enqueueTransaction(Transaction&& transaction) {
-    std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-    _transactionQueue.emplace_back(std::move(transaction));
+    pushTransaction(new TransactionNode(std::move(transaction)));
+}
+
+void Scene::pushTransaction(TransactionNode* node) {
+    node->next = _transactionQueue.load(std::memory_order_relaxed);
+    while (!_transactionQueue.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+}
+
+TransactionQueue Scene::takeTransactionQueue() {
+    TransactionNode* head = _transactionQueue.exchange(nullptr, std::memory_order_acquire);
+    size_t numTransactions = 0;
+    for (TransactionNode* node = head; node; node = node->next) {
+        ++numTransactions;
+    }
+
+    // the list is newest first: fill the queue from the back to restore the order they were enqueued in
+    TransactionQueue transactionQueue(numTransactions);
+    size_t i = numTransactions;
+    while (head) {
+        TransactionNode* node = head;
+        head = node->next;
+        transactionQueue[--i] = std::move(node->transaction);
+        delete node;
+    }
+    return transactionQueue;
 }
 
 uint32_t Scene::enqueueFrame() {
     PROFILE_RANGE(render, __FUNCTION__);
-    TransactionQueue localTransactionQueue;
-    {
-        std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-        localTransactionQueue.swap(_transactionQueue);
-    }
+    TransactionQueue localTransactionQueue = takeTransactionQueue();
 
+    // merge() reserves the total size of each kind of change up front
     Transaction consolidatedTransaction;
     consolidatedTransaction.merge(std::move(localTransactionQueue));
     {
         std::unique_lock<std::mutex> lock(_transactionFramesMutex);
-        _transactionFrames.push_back(consolidatedTransaction);
+        _transactionFrames.push_back(std::move(consolidatedTransaction));
     }
 
     return ++_transactionFrameNumber;
@@ -148,9 +148,11 @@ public:
     size_t getNumItems() const { return _numAllocatedItems.load(); }
 
     // Enqueue transaction to the scene
+    // Thread safe and lock free
     void enqueueTransaction(const Transaction& transaction);
 
     // Enqueue transaction to the scene
+    // Thread safe and lock free
     void enqueueTransaction(Transaction&& transaction);
 
     // Enqueue end of frame transactions boundary
@@ -212,10 +214,19 @@ protected:
     // Thread safe elements that can be accessed from anywhere
     std::atomic<unsigned int> _IDAllocator{ 1 }; // first valid itemID will be One
     std::atomic<unsigned int> _numAllocatedItems{ 1 }; // num of allocated items, matching the _items.size()
-    std::mutex _transactionQueueMutex;
-    TransactionQueue _transactionQueue;
 
-    
+    // Transactions are published by pushing them onto a lock free list (newest first)
+    // which enqueueFrame() takes in one exchange.  Producers never wait on each other or on the consumer.
+    class TransactionNode {
+    public:
+        TransactionNode(Transaction&& transaction) : transaction(std::move(transaction)) {}
+        Transaction transaction;
+        TransactionNode* next { nullptr };
+    };
+    std::atomic<TransactionNode*> _transactionQueue { nullptr };
+    void pushTransaction(TransactionNode* node);
+    TransactionQueue takeTransactionQueue();
+
     std::mutex _transactionFramesMutex;
     using TransactionFrames = std::vector<Transaction>;
     TransactionFrames _transactionFrames;
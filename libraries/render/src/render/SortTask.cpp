@@ -12,116 +12,272 @@
 #include "SortTask.h"
 #include "ShapePipeline.h"
 
+#include <array>
 #include <assert.h>
+#include <chrono>
+#include <cstring>
+#include <limits>
+
+#include <Profile.h>
+#include <Radix2InplaceSort.h>
+#include <TBBHelpers.h>
 #include <ViewFrustum.h>
 
 using namespace render;
 
-struct ItemBoundSort {
-    float _centerDepth = 0.0f;
-    float _nearDepth = 0.0f;
-    float _farDepth = 0.0f;
-    ItemID _id = 0;
-    AABox _bounds;
+// Lists that are shorter than this are sorted with std::sort, larger ones are radix sorted
+const size_t MIN_RADIX_SORT_SIZE = 1024;
+// Lists that are larger than this are radix sorted in parallel
+const size_t MIN_PARALLEL_SORT_SIZE = 8192;
+// When an insertion sort needs more shifts per item than this the order isn't coherent anymore
+const size_t MAX_INSERTION_SHIFTS_PER_ITEM = 8;
 
-    ItemBoundSort() {}
-    ItemBoundSort(float centerDepth, float nearDepth, float farDepth, ItemID id, const AABox& bounds) : _centerDepth(centerDepth), _nearDepth(nearDepth), _farDepth(farDepth), _id(id), _bounds(bounds) {}
-};
+// The parallel radix sort first scatters the keys in buckets according to their top bits (the sign bit is the same for
+// every key) and then sorts the buckets independently
+const uint32_t RADIX_BUCKET_BITS = 11;
+const uint32_t RADIX_BUCKET_SHIFT = 31 - RADIX_BUCKET_BITS;
+const uint32_t NUM_RADIX_BUCKETS = 1 << RADIX_BUCKET_BITS;
+const uint32_t RADIX_BUCKET_MASK = NUM_RADIX_BUCKETS - 1;
 
-struct FrontToBackSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
-        return (left._centerDepth < right._centerDepth);
-    }
-};
+const uint32_t INVALID_SLOT = std::numeric_limits<uint32_t>::max();
 
-struct BackToFrontSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
-        return (left._centerDepth > right._centerDepth);
-    }
-};
+struct DepthKeyRadix2Scanner {
+    using state_type = uint32_t;
 
-void render::depthSortItems(const RenderContextPointer& renderContext, bool frontToBack, 
-                            const ItemBounds& inItems, ItemBounds& outItems, AABox* bounds) {
-    assert(renderContext->args);
-    assert(renderContext->args->hasViewFrustum());
+    state_type _initialMask { 0x80000000u };
 
-    auto& scene = renderContext->_scene;
-    RenderArgs* args = renderContext->args;
+    DepthKeyRadix2Scanner() {}
+    DepthKeyRadix2Scanner(state_type initialMask) : _initialMask(initialMask) {}
 
+    state_type initial_state() const { return _initialMask; }
+    bool advance(state_type& mask) const { mask >>= 1; return mask != 0; }
+    bool bit(const DepthSorter::Key& key, state_type mask) const { return (key.depth & mask) != 0; }
+};
 
-    // Allocate and simply copy
-    outItems.clear();
-    outItems.reserve(inItems.size());
+static bool lessDepth(const DepthSorter::Key& left, const DepthSorter::Key& right) {
+    return left.depth < right.depth;
+}
 
+bool DepthSorter::insertionSort(size_t maxShifts) {
+    size_t numShifts = 0;
+    for (size_t i = 1; i < _keys.size(); ++i) {
+        Key key = _keys[i];
+        size_t j = i;
+        while (j > 0 && _keys[j - 1].depth > key.depth) {
+            _keys[j] = _keys[j - 1];
+            --j;
+        }
+        _keys[j] = key;
+        numShifts += i - j;
+        if (numShifts > maxShifts) {
+            return false;
+        }
+    }
+    return true;
+}
 
-    // Make a local dataset of the center distance and closest point distance
-    std::vector<ItemBoundSort> itemBoundSorts;
-    itemBoundSorts.reserve(outItems.size());
+void DepthSorter::radixSort(bool parallel) {
+    if (_keys.size() < MIN_RADIX_SORT_SIZE) {
+        std::sort(_keys.begin(), _keys.end(), lessDepth);
+        return;
+    }
+    if (!parallel || _keys.size() < MIN_PARALLEL_SORT_SIZE) {
+        radix2InplaceSort<DepthKeyRadix2Scanner>(_keys.begin(), _keys.end());
+        return;
+    }
 
-    for (auto itemDetails : inItems) {
-        auto item = scene->getItem(itemDetails.id);
-        auto bound = itemDetails.bound; // item.getBound(args);
-        float distanceSquared = args->getViewFrustum().distanceToCameraSquared(bound.calcCenter());
+    std::array<uint32_t, NUM_RADIX_BUCKETS + 1> offsets;
+    offsets.fill(0);
+    for (const auto& key : _keys) {
+        ++offsets[((key.depth >> RADIX_BUCKET_SHIFT) & RADIX_BUCKET_MASK) + 1];
+    }
+    for (uint32_t i = 1; i <= NUM_RADIX_BUCKETS; ++i) {
+        offsets[i] += offsets[i - 1];
+    }
+    std::array<uint32_t, NUM_RADIX_BUCKETS> ends;
+    std::copy(offsets.begin(), offsets.end() - 1, ends.begin());
+    _swapKeys.resize(_keys.size());
+    for (const auto& key : _keys) {
+        _swapKeys[ends[(key.depth >> RADIX_BUCKET_SHIFT) & RADIX_BUCKET_MASK]++] = key;
+    }
+    _keys.swap(_swapKeys);
+
+    const DepthKeyRadix2Scanner scanner(1u << (RADIX_BUCKET_SHIFT - 1));
+    tbb::parallel_for(tbb::blocked_range<uint32_t>(0, NUM_RADIX_BUCKETS), [&](const tbb::blocked_range<uint32_t>& range) {
+        for (uint32_t bucket = range.begin(); bucket != range.end(); ++bucket) {
+            if (offsets[bucket + 1] - offsets[bucket] > 1) {
+                radix2InplaceSort(_keys.begin() + offsets[bucket], _keys.begin() + offsets[bucket + 1], scanner);
+            }
+        }
+    });
+}
+
+DepthSorter::Stats DepthSorter::sort(const ViewFrustum& viewFrustum, bool frontToBack, bool coherent, bool parallel,
+                                     const ItemBounds& inItems, ItemBounds& outItems, size_t& previousSize, AABox* bounds) {
+    PROFILE_RANGE(render, "DepthSorter::sort");
+    auto startTime = std::chrono::high_resolution_clock::now();
+    Stats stats;
+    stats.numItems = inItems.size();
 
-        itemBoundSorts.emplace_back(ItemBoundSort(distanceSquared, distanceSquared, distanceSquared, itemDetails.id, bound));
+    // The squared distances are positive so their bits compare like unsigned integers, and flipping them all reverses the order
+    _keys.resize(inItems.size());
+    for (size_t i = 0; i < inItems.size(); ++i) {
+        float distanceSquared = viewFrustum.distanceToCameraSquared(inItems[i].bound.calcCenter());
+        uint32_t depth;
+        memcpy(&depth, &distanceSquared, sizeof(depth));
+        _keys[i] = { frontToBack ? depth : ~depth, (uint32_t)i };
     }
 
-    // sort against Z
-    if (frontToBack) {
-        FrontToBackSort frontToBackSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), frontToBackSort);
-    } else {
-        BackToFrontSort  backToFrontSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), backToFrontSort);
+    if (coherent && previousSize > 0 && _keys.size() > 1) {
+        // Put the items back in the order they had in the previous frame, the new ones at the end
+        const uint32_t previousFrame = _frame - 1;
+        _slots.assign(previousSize, INVALID_SLOT);
+        _newcomers.clear();
+        for (size_t i = 0; i < inItems.size(); ++i) {
+            auto id = inItems[i].id;
+            if (id < _ranks.size() && _ranks[id].frame == previousFrame && _ranks[id].rank < previousSize &&
+                    _slots[_ranks[id].rank] == INVALID_SLOT) {
+                _slots[_ranks[id].rank] = (uint32_t)i;
+            } else {
+                _newcomers.push_back((uint32_t)i);
+            }
+        }
+        _swapKeys.clear();
+        for (auto slot : _slots) {
+            if (slot != INVALID_SLOT) {
+                _swapKeys.push_back(_keys[slot]);
+            }
+        }
+        for (auto newcomer : _newcomers) {
+            _swapKeys.push_back(_keys[newcomer]);
+        }
+        _keys.swap(_swapKeys);
+
+        stats.isCoherent = insertionSort(_keys.size() * MAX_INSERTION_SHIFTS_PER_ITEM);
+    }
+    if (!stats.isCoherent) {
+        radixSort(parallel);
     }
 
     // Finally once sorted result to a list of itemID and keep uniques
+    outItems.clear();
+    outItems.reserve(inItems.size());
+    if (bounds && !_keys.empty() && bounds->isNull()) {
+        *bounds = inItems[_keys.front().index].bound;
+    }
     render::ItemID previousID = Item::INVALID_ITEM_ID;
-    if (!bounds) {
-        for (auto& item : itemBoundSorts) {
-            if (item._id != previousID) {
-                outItems.emplace_back(ItemBound(item._id, item._bounds));
-                previousID = item._id;
+    for (const auto& key : _keys) {
+        const auto& item = inItems[key.index];
+        if (item.id != previousID) {
+            if (item.id >= _ranks.size()) {
+                _ranks.resize(item.id + 1);
             }
-        }
-    } else if (!itemBoundSorts.empty()) {
-        if (bounds->isNull()) {
-            *bounds = itemBoundSorts.front()._bounds;
-        }
-        for (auto& item : itemBoundSorts) {
-            if (item._id != previousID) {
-                outItems.emplace_back(ItemBound(item._id, item._bounds));
-                previousID = item._id;
-                *bounds += item._bounds;
+            _ranks[item.id] = { _frame, (uint32_t)outItems.size() };
+            outItems.emplace_back(ItemBound(item.id, item.bound));
+            previousID = item.id;
+            if (bounds) {
+                *bounds += item.bound;
             }
         }
     }
+    previousSize = outItems.size();
+
+    stats.msecs = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+    return stats;
+}
+
+void DepthSortConfig::resetStats() {
+    numItems = 0;
+    numBuckets = 0;
+    numCoherentBuckets = 0;
+    maxBucketSortTime = 0.0;
+    maxBucketSortSize = 0;
+}
+
+void DepthSortConfig::addBucketStats(const DepthSorter::Stats& stats) {
+    numItems += (int)stats.numItems;
+    numBuckets++;
+    if (stats.isCoherent) {
+        numCoherentBuckets++;
+    }
+    if (stats.msecs > maxBucketSortTime) {
+        maxBucketSortTime = stats.msecs;
+        maxBucketSortSize = (int)stats.numItems;
+    }
+}
+
+void render::depthSortItems(const RenderContextPointer& renderContext, bool frontToBack,
+                            const ItemBounds& inItems, ItemBounds& outItems, AABox* bounds) {
+    assert(renderContext->args);
+    assert(renderContext->args->hasViewFrustum());
+
+    // Without any history to start from this is a plain (radix) sort
+    DepthSorter sorter;
+    size_t previousSize = 0;
+    sorter.sort(renderContext->args->getViewFrustum(), frontToBack, false, true, inItems, outItems, previousSize, bounds);
 }
 
 void PipelineSortShapes::run(const RenderContextPointer& renderContext, const ItemBounds& inItems, ShapeBounds& outShapes) {
     auto& scene = renderContext->_scene;
-    outShapes.clear();
 
-    for (const auto& item : inItems) {
-        auto key = scene->getItem(item.id).getShapeKey();
-        auto outItems = outShapes.find(key);
-        if (outItems == outShapes.end()) {
-            outItems = outShapes.insert(std::make_pair(key, ItemBounds{})).first;
-            outItems->second.reserve(inItems.size());
+    // Keep the buckets of the previous frame around, they most likely have the right capacity already
+    for (auto& items : outShapes) {
+        items.second.clear();
+    }
+
+    // Fetching the shape keys goes through the payloads, spread that over the workers when there are many items
+    const size_t MIN_PARALLEL_SIZE = 4096;
+    _keys.resize(inItems.size());
+    if (inItems.size() < MIN_PARALLEL_SIZE) {
+        for (size_t i = 0; i < inItems.size(); ++i) {
+            _keys[i] = scene->getItem(inItems[i].id).getShapeKey();
         }
+    } else {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, inItems.size(), 1024), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                _keys[i] = scene->getItem(inItems[i].id).getShapeKey();
+            }
+        });
+    }
 
-        outItems->second.push_back(item);
+    // Consecutive items often share their shape key, skip the lookup for those
+    ShapeKey::KeyEqual keyEqual;
+    auto outItems = outShapes.end();
+    for (size_t i = 0; i < inItems.size(); ++i) {
+        const auto& key = _keys[i];
+        if (outItems == outShapes.end() || !keyEqual(outItems->first, key)) {
+            outItems = outShapes.find(key);
+            if (outItems == outShapes.end()) {
+                outItems = outShapes.insert(std::make_pair(key, ItemBounds{})).first;
+            }
+        }
+        outItems->second.push_back(inItems[i]);
     }
 
-    for (auto& items : outShapes) {
-        items.second.shrink_to_fit();
+    for (auto items = outShapes.begin(); items != outShapes.end();) {
+        if (items->second.empty()) {
+            items = outShapes.erase(items);
+        } else {
+            ++items;
+        }
     }
 }
 
+void DepthSortShapes::configure(const Config& config) {
+    _coherent = config.coherent;
+    _parallel = config.parallel;
+}
+
 void DepthSortShapes::run(const RenderContextPointer& renderContext, const ShapeBounds& inShapes, ShapeBounds& outShapes) {
+    assert(renderContext->args);
+    assert(renderContext->args->hasViewFrustum());
+    auto config = std::static_pointer_cast<Config>(renderContext->jobConfig);
+    config->resetStats();
+
     outShapes.clear();
     outShapes.reserve(inShapes.size());
 
+    _sorter.beginFrame();
     for (auto& pipeline : inShapes) {
         auto& inItems = pipeline.second;
         auto outItems = outShapes.find(pipeline.first);
@@ -129,11 +285,22 @@ void DepthSortShapes::run(const RenderContextPointer& renderContext, const Shape
             outItems = outShapes.insert(std::make_pair(pipeline.first, ItemBounds{})).first;
         }
 
-        depthSortItems(renderContext, _frontToBack, inItems, outItems->second);
+        config->addBucketStats(_sorter.sort(renderContext->args->getViewFrustum(), _frontToBack, _coherent, _parallel,
+            inItems, outItems->second, _previousSizes[pipeline.first]));
     }
 }
 
+void DepthSortShapesAndComputeBounds::configure(const Config& config) {
+    _coherent = config.coherent;
+    _parallel = config.parallel;
+}
+
 void DepthSortShapesAndComputeBounds::run(const RenderContextPointer& renderContext, const ShapeBounds& inShapes, Outputs& outputs) {
+    assert(renderContext->args);
+    assert(renderContext->args->hasViewFrustum());
+    auto config = std::static_pointer_cast<Config>(renderContext->jobConfig);
+    config->resetStats();
+
     auto& outShapes = outputs.edit0();
     auto& outBounds = outputs.edit1();
 
@@ -141,6 +308,7 @@ void DepthSortShapesAndComputeBounds::run(const RenderContextPointer& renderCont
     outShapes.reserve(inShapes.size());
     outBounds = AABox();
 
+    _sorter.beginFrame();
     for (auto& pipeline : inShapes) {
         auto& inItems = pipeline.second;
         auto outItems = outShapes.find(pipeline.first);
@@ -149,11 +317,24 @@ void DepthSortShapesAndComputeBounds::run(const RenderContextPointer& renderCont
         }
         AABox bounds;
 
-        depthSortItems(renderContext, _frontToBack, inItems, outItems->second, &bounds);
+        config->addBucketStats(_sorter.sort(renderContext->args->getViewFrustum(), _frontToBack, _coherent, _parallel,
+            inItems, outItems->second, _previousSizes[pipeline.first], &bounds));
         outBounds += bounds;
     }
 }
 
+void DepthSortItems::configure(const Config& config) {
+    _coherent = config.coherent;
+    _parallel = config.parallel;
+}
+
 void DepthSortItems::run(const RenderContextPointer& renderContext, const ItemBounds& inItems, ItemBounds& outItems) {
-    depthSortItems(renderContext, _frontToBack, inItems, outItems);
+    assert(renderContext->args);
+    assert(renderContext->args->hasViewFrustum());
+    auto config = std::static_pointer_cast<Config>(renderContext->jobConfig);
+    config->resetStats();
+
+    _sorter.beginFrame();
+    config->addBucketStats(_sorter.sort(renderContext->args->getViewFrustum(), _frontToBack, _coherent, _parallel,
+        inItems, outItems, _previousSize));
 }
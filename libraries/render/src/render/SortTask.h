@@ -12,46 +12,155 @@
 #ifndef hifi_render_SortTask_h
 #define hifi_render_SortTask_h
 
+#include <unordered_map>
+#include <vector>
+
 #include "Engine.h"
 
 namespace render {
     void depthSortItems(const RenderContextPointer& renderContext, bool frontToBack, const ItemBounds& inItems, ItemBounds& outItems, AABox* bounds = nullptr);
 
+    // Sorts lists of item bounds by depth, remembering the order of each list from the previous frame.
+    // That order barely changes from one frame to the next, so an insertion sort seeded with it has very little to do.
+    // When the order isn't coherent anymore (camera cut, teleport...) the list is radix sorted, in parallel if large.
+    class DepthSorter {
+    public:
+        struct Stats {
+            size_t numItems { 0 };
+            bool isCoherent { false };
+            float msecs { 0.0f };
+        };
+
+        void beginFrame() { ++_frame; }
+
+        // previousSize is the size of the list in the previous frame, it is updated for the next one
+        Stats sort(const ViewFrustum& viewFrustum, bool frontToBack, bool coherent, bool parallel,
+            const ItemBounds& inItems, ItemBounds& outItems, size_t& previousSize, AABox* bounds = nullptr);
+
+        // The depth of an item turned into an unsigned key, sorted in increasing order whatever the direction
+        struct Key {
+            uint32_t depth;
+            uint32_t index;
+        };
+
+    private:
+        struct Rank {
+            uint32_t frame { 0 };
+            uint32_t rank { 0 };
+        };
+
+        bool insertionSort(size_t maxShifts);
+        void radixSort(bool parallel);
+
+        // The rank of every item in its list the last time it was sorted, indexed by ItemID
+        std::vector<Rank> _ranks;
+        // Starts past the default frame of the ranks so that they never look like they're from the previous frame
+        uint32_t _frame { 1 };
+
+        // Scratch buffers, kept around so sorting doesn't allocate once warmed up
+        std::vector<Key> _keys;
+        std::vector<Key> _swapKeys;
+        std::vector<uint32_t> _slots;
+        std::vector<uint32_t> _newcomers;
+    };
+
+    class DepthSortConfig : public Job::Config {
+        Q_OBJECT
+        Q_PROPERTY(int numItems READ getNumItems NOTIFY newStats)
+        Q_PROPERTY(int numBuckets READ getNumBuckets NOTIFY newStats)
+        Q_PROPERTY(int numCoherentBuckets READ getNumCoherentBuckets NOTIFY newStats)
+        Q_PROPERTY(double maxBucketSortTime READ getMaxBucketSortTime NOTIFY newStats) // ms
+        Q_PROPERTY(int maxBucketSortSize READ getMaxBucketSortSize NOTIFY newStats)
+        Q_PROPERTY(bool coherent MEMBER coherent WRITE setCoherent)
+        Q_PROPERTY(bool parallel MEMBER parallel WRITE setParallel)
+    public:
+        int numItems { 0 };
+        int numBuckets { 0 };
+        int numCoherentBuckets { 0 };
+        double maxBucketSortTime { 0.0 };
+        int maxBucketSortSize { 0 };
+
+        int getNumItems() const { return numItems; }
+        int getNumBuckets() const { return numBuckets; }
+        int getNumCoherentBuckets() const { return numCoherentBuckets; }
+        double getMaxBucketSortTime() const { return maxBucketSortTime; }
+        int getMaxBucketSortSize() const { return maxBucketSortSize; }
+
+        void resetStats();
+        // Every bucket sorted in the frame reports its cost, the slowest one is kept
+        void addBucketStats(const DepthSorter::Stats& stats);
+
+        bool coherent { true };
+        bool parallel { true };
+    public slots:
+        void setCoherent(bool enabled) { coherent = enabled; emit dirty(); }
+        void setParallel(bool enabled) { parallel = enabled; emit dirty(); }
+    signals:
+        void dirty();
+    };
+
     class PipelineSortShapes {
     public:
         using JobModel = Job::ModelIO<PipelineSortShapes, ItemBounds, ShapeBounds>;
         void run(const RenderContextPointer& renderContext, const ItemBounds& inItems, ShapeBounds& outShapes);
+
+    private:
+        std::vector<ShapeKey> _keys;
     };
 
     class DepthSortShapes {
     public:
-        using JobModel = Job::ModelIO<DepthSortShapes, ShapeBounds, ShapeBounds>;
+        using Config = DepthSortConfig;
+        using JobModel = Job::ModelIO<DepthSortShapes, ShapeBounds, ShapeBounds, Config>;
 
         bool _frontToBack;
         DepthSortShapes(bool frontToBack = true) : _frontToBack(frontToBack) {}
 
+        void configure(const Config& config);
         void run(const RenderContextPointer& renderContext, const ShapeBounds& inShapes, ShapeBounds& outShapes);
+
+    private:
+        DepthSorter _sorter;
+        std::unordered_map<ShapeKey, size_t, ShapeKey::Hash, ShapeKey::KeyEqual> _previousSizes;
+        bool _coherent { true };
+        bool _parallel { true };
     };
 
     class DepthSortShapesAndComputeBounds {
     public:
+        using Config = DepthSortConfig;
         using Outputs = VaryingSet2<ShapeBounds, AABox>;
-        using JobModel = Job::ModelIO<DepthSortShapesAndComputeBounds, ShapeBounds, Outputs>;
+        using JobModel = Job::ModelIO<DepthSortShapesAndComputeBounds, ShapeBounds, Outputs, Config>;
 
         bool _frontToBack;
         DepthSortShapesAndComputeBounds(bool frontToBack = true) : _frontToBack(frontToBack) {}
 
+        void configure(const Config& config);
         void run(const RenderContextPointer& renderContext, const ShapeBounds& inShapes, Outputs& outputs);
+
+    private:
+        DepthSorter _sorter;
+        std::unordered_map<ShapeKey, size_t, ShapeKey::Hash, ShapeKey::KeyEqual> _previousSizes;
+        bool _coherent { true };
+        bool _parallel { true };
     };
 
     class DepthSortItems {
     public:
-        using JobModel = Job::ModelIO<DepthSortItems, ItemBounds, ItemBounds>;
+        using Config = DepthSortConfig;
+        using JobModel = Job::ModelIO<DepthSortItems, ItemBounds, ItemBounds, Config>;
 
         bool _frontToBack;
         DepthSortItems(bool frontToBack = true) : _frontToBack(frontToBack) {}
 
+        void configure(const Config& config);
         void run(const RenderContextPointer& renderContext, const ItemBounds& inItems, ItemBounds& outItems);
+
+    private:
+        DepthSorter _sorter;
+        size_t _previousSize { 0 };
+        bool _coherent { true };
+        bool _parallel { true };
     };
 }
 
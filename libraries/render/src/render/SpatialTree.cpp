@@ -11,6 +11,7 @@
 #include "SpatialTree.h"
 
 #include <ViewFrustum.h>
+#include <TBBHelpers.h>
 
 using namespace render;
 
@@ -444,12 +445,17 @@ int Octree::select(CellSelection& selection, const FrustumSelector& selector) co
     // Always include the root cell partially containing potentially outer objects
     selectCellBrick(cellID, selection, false);
 
-    // then traverse deeper
-    for (int i = 0; i < NUM_OCTANTS; i++) {
+    // then traverse deeper, one octant per task, and append the octants in order so the selection
+    // doesn't depend on which task finishes first
+    CellSelection octantSelections[NUM_OCTANTS];
+    tbb::parallel_for(0, (int)NUM_OCTANTS, [&](int i) {
         Index subCellID = cell.child((Link)i);
         if (subCellID != INVALID_CELL) {
-            selectTraverse(subCellID, selection, selector);
+            selectTraverse(subCellID, octantSelections[i], selector);
         }
+    });
+    for (const auto& octantSelection : octantSelections) {
+        selection.append(octantSelection);
     }
 
     return (int)selection.size() - numSelectedsIn;
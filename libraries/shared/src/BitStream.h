@@ -0,0 +1,101 @@
+//
+//  BitStream.h
+//  libraries/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_BitStream_h
+#define hifi_BitStream_h
+
+#include <assert.h>
+#include <stdint.h>
+
+// Writes values of arbitrary bit width (up to 32 bits) into a byte buffer, most significant bit first.
+// Writes past the capacity are dropped and flag the stream as overflowed.
+class BitWriter {
+public:
+    BitWriter(uint8_t* buffer, int capacity) : _buffer(buffer), _capacityBits(capacity * 8) {}
+
+    void write(uint32_t value, int numBits);
+
+    bool hasOverflowed() const { return _hasOverflowed; }
+    int getNumBits() const { return _numBits; }
+    int getNumBytes() const { return (_numBits + 7) >> 3; }
+    int getRemainingBits() const { return _capacityBits - _numBits; }
+
+private:
+    uint8_t* _buffer;
+    int _capacityBits;
+    int _numBits { 0 };
+    bool _hasOverflowed { false };
+};
+
+// Reads values written by BitWriter.  Reads past the end of the buffer return zero and flag the stream as overflowed.
+class BitReader {
+public:
+    BitReader(const uint8_t* buffer, int size) : _buffer(buffer), _sizeBits(size * 8) {}
+
+    uint32_t read(int numBits);
+    void skip(int numBits);
+
+    bool hasOverflowed() const { return _hasOverflowed; }
+    int getNumBits() const { return _numBits; }
+    int getNumBytes() const { return (_numBits + 7) >> 3; }
+
+private:
+    const uint8_t* _buffer;
+    int _sizeBits;
+    int _numBits { 0 };
+    bool _hasOverflowed { false };
+};
+
+inline void BitWriter::write(uint32_t value, int numBits) {
+    assert(numBits >= 0 && numBits <= 32);
+    if (_numBits + numBits > _capacityBits) {
+        _hasOverflowed = true;
+        return;
+    }
+    for (int i = numBits - 1; i >= 0; i--) {
+        int byteIndex = _numBits >> 3;
+        int bitIndex = 7 - (_numBits & 7);
+        if (bitIndex == 7) {
+            _buffer[byteIndex] = 0;
+        }
+        if ((value >> i) & 1) {
+            _buffer[byteIndex] |= (uint8_t)(1 << bitIndex);
+        }
+        _numBits++;
+    }
+}
+
+inline uint32_t BitReader::read(int numBits) {
+    assert(numBits >= 0 && numBits <= 32);
+    if (_numBits + numBits > _sizeBits) {
+        _hasOverflowed = true;
+        return 0;
+    }
+    uint32_t value = 0;
+    for (int i = 0; i < numBits; i++) {
+        int byteIndex = _numBits >> 3;
+        int bitIndex = 7 - (_numBits & 7);
+        value = (value << 1) | ((_buffer[byteIndex] >> bitIndex) & 1);
+        _numBits++;
+    }
+    return value;
+}
+
+inline void BitReader::skip(int numBits) {
+    if (_numBits + numBits > _sizeBits) {
+        _hasOverflowed = true;
+        _numBits = _sizeBits;
+        return;
+    }
+    _numBits += numBits;
+}
+
+#endif // hifi_BitStream_h
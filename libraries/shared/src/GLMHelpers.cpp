@@ -15,6 +15,7 @@
 
 #include <glm/gtc/matrix_transform.hpp>
 
+#include "BitStream.h"
 #include "NumericalConstants.h"
 
 const vec3 Vectors::UNIT_X{ 1.0f, 0.0f, 0.0f };
@@ -231,6 +232,90 @@ int unpackOrientationQuatFromSixBytes(const unsigned char* buffer, glm::quat& qu
     return 6;
 }
 
+static uint32_t quantizeToBits(float value, float minValue, float maxValue, int numBits) {
+    const uint32_t range = (1u << numBits) - 1;
+    float normalized = glm::clamp((value - minValue) / (maxValue - minValue), 0.0f, 1.0f);
+    return (uint32_t)(normalized * (float)range + 0.5f);
+}
+
+static float dequantizeFromBits(uint32_t value, float minValue, float maxValue, int numBits) {
+    const float range = (float)((1u << numBits) - 1);
+    return minValue + ((float)value / range) * (maxValue - minValue);
+}
+
+void packOrientationQuatToBits(BitWriter& writer, const glm::quat& quatInput, int bitsPerComponent) {
+    // find largest component
+    uint8_t largestComponent = 0;
+    for (int i = 1; i < 4; i++) {
+        if (fabs(quatInput[i]) > fabs(quatInput[largestComponent])) {
+            largestComponent = i;
+        }
+    }
+
+    // ensure that the sign of the dropped component is always negative.
+    glm::quat q = quatInput[largestComponent] > 0 ? -quatInput : quatInput;
+
+    const float MAGNITUDE = 1.0f / sqrtf(2.0f);
+    writer.write(largestComponent, 2);
+    for (int i = 0; i < 4; i++) {
+        if (i != largestComponent) {
+            writer.write(quantizeToBits(q[i], -MAGNITUDE, MAGNITUDE, bitsPerComponent), bitsPerComponent);
+        }
+    }
+}
+
+void unpackOrientationQuatFromBits(BitReader& reader, glm::quat& quatOutput, int bitsPerComponent) {
+    uint8_t largestComponent = (uint8_t)reader.read(2);
+
+    const float MAGNITUDE = 1.0f / sqrtf(2.0f);
+    float floatComponents[3];
+    for (int i = 0; i < 3; i++) {
+        floatComponents[i] = dequantizeFromBits(reader.read(bitsPerComponent), -MAGNITUDE, MAGNITUDE, bitsPerComponent);
+    }
+
+    // missingComponent is always negative.
+    float missingComponent = -sqrtf(glm::max(0.0f, 1.0f - floatComponents[0] * floatComponents[0] -
+                                             floatComponents[1] * floatComponents[1] - floatComponents[2] * floatComponents[2]));
+
+    for (int i = 0, j = 0; i < 4; i++) {
+        if (i != largestComponent) {
+            quatOutput[i] = floatComponents[j];
+            j++;
+        } else {
+            quatOutput[i] = missingComponent;
+        }
+    }
+}
+
+static glm::quat computeOrientationQuatDelta(const glm::quat& reference, const glm::quat& quatInput) {
+    glm::quat delta = glm::inverse(reference) * quatInput;
+    // q and -q are the same rotation, pick the one with a positive real part so it can be dropped
+    return delta.w < 0.0f ? -delta : delta;
+}
+
+bool isOrientationQuatDeltaInRange(const glm::quat& reference, const glm::quat& quatInput, float maxComponent) {
+    glm::quat delta = computeOrientationQuatDelta(reference, quatInput);
+    return fabsf(delta.x) <= maxComponent && fabsf(delta.y) <= maxComponent && fabsf(delta.z) <= maxComponent;
+}
+
+void packOrientationQuatDeltaToBits(BitWriter& writer, const glm::quat& reference, const glm::quat& quatInput,
+                                    int bitsPerComponent, float maxComponent) {
+    glm::quat delta = computeOrientationQuatDelta(reference, quatInput);
+    writer.write(quantizeToBits(delta.x, -maxComponent, maxComponent, bitsPerComponent), bitsPerComponent);
+    writer.write(quantizeToBits(delta.y, -maxComponent, maxComponent, bitsPerComponent), bitsPerComponent);
+    writer.write(quantizeToBits(delta.z, -maxComponent, maxComponent, bitsPerComponent), bitsPerComponent);
+}
+
+void unpackOrientationQuatDeltaFromBits(BitReader& reader, const glm::quat& reference, glm::quat& quatOutput,
+                                        int bitsPerComponent, float maxComponent) {
+    glm::quat delta;
+    delta.x = dequantizeFromBits(reader.read(bitsPerComponent), -maxComponent, maxComponent, bitsPerComponent);
+    delta.y = dequantizeFromBits(reader.read(bitsPerComponent), -maxComponent, maxComponent, bitsPerComponent);
+    delta.z = dequantizeFromBits(reader.read(bitsPerComponent), -maxComponent, maxComponent, bitsPerComponent);
+    delta.w = sqrtf(glm::max(0.0f, 1.0f - delta.x * delta.x - delta.y * delta.y - delta.z * delta.z));
+    quatOutput = glm::normalize(reference * delta);
+}
+
 bool closeEnough(float a, float b, float relativeError) {
     assert(relativeError >= 0.0f);
     // NOTE: we add EPSILON to the denominator so we can avoid checking for division by zero.
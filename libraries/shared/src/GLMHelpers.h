@@ -51,6 +51,9 @@ using glm::quat;
 
 #include "SharedUtil.h"
 
+class BitReader;
+class BitWriter;
+
 // this is where the coordinate system is represented
 const glm::vec3 IDENTITY_RIGHT = glm::vec3( 1.0f, 0.0f, 0.0f);
 const glm::vec3 IDENTITY_UP    = glm::vec3( 0.0f, 1.0f, 0.0f);
@@ -118,6 +121,20 @@ int unpackOrientationQuatFromBytes(const unsigned char* buffer, glm::quat& quatO
 int packOrientationQuatToSixBytes(unsigned char* buffer, const glm::quat& quatInput);
 int unpackOrientationQuatFromSixBytes(const unsigned char* buffer, glm::quat& quatOutput);
 
+// variable precision version of the smallest three encoding above, written to a bit stream.
+// Uses 2 + 3 * bitsPerComponent bits.
+void packOrientationQuatToBits(BitWriter& writer, const glm::quat& quatInput, int bitsPerComponent);
+void unpackOrientationQuatFromBits(BitReader& reader, glm::quat& quatOutput, int bitsPerComponent);
+
+// small rotations relative to a reference orientation are encoded as the vector part of the delta quaternion,
+// each component quantized to bitsPerComponent over -maxComponent..maxComponent.  Uses 3 * bitsPerComponent bits.
+// Deltas outside that range are clamped, use isOrientationQuatDeltaInRange() to check beforehand.
+bool isOrientationQuatDeltaInRange(const glm::quat& reference, const glm::quat& quatInput, float maxComponent);
+void packOrientationQuatDeltaToBits(BitWriter& writer, const glm::quat& reference, const glm::quat& quatInput,
+                                    int bitsPerComponent, float maxComponent);
+void unpackOrientationQuatDeltaFromBits(BitReader& reader, const glm::quat& reference, glm::quat& quatOutput,
+                                        int bitsPerComponent, float maxComponent);
+
 // Ratios need the be highly accurate when less than 10, but not very accurate above 10, and they
 // are never greater than 1000 to 1, this allows us to encode each component in 16bits
 int packFloatRatioToTwoByte(unsigned char* buffer, float ratio);
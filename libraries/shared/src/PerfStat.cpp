@@ -19,6 +19,7 @@
 #include <QThread>
 
 #include "NumericalConstants.h"
+#include "Profile.h"
 #include "SharedLogging.h"
 
 // ----------------------------------------------------------------------------
@@ -85,6 +86,10 @@ QHash<QThread*, QString> PerformanceTimer::_fullNames;
 QMap<QString, PerformanceTimerRecord> PerformanceTimer::_records;
 
 PerformanceTimer::PerformanceTimer(const QString& name) {
+    if (tracing::enabled() && trace_timer().isDebugEnabled()) {
+        _traceName = tracing::internName(name);
+        _traceStart = tracing::Tracer::now();
+    }
     if (_isActive) {
         _name = name;
         {
@@ -98,6 +103,11 @@ PerformanceTimer::PerformanceTimer(const QString& name) {
 }
 
 PerformanceTimer::~PerformanceTimer() {
+    if (_traceName != tracing::TRACE_NAME_NONE) {
+        auto traceEnd = tracing::Tracer::now();
+        tracing::Tracer::traceEvent(trace_timer(), _traceName, tracing::Complete, _traceStart, tracing::TRACE_NAME_NONE,
+                                    (double)(traceEnd - _traceStart));
+    }
     if (_isActive && _start != 0) {
         quint64 elapsedUsec = (usecTimestampNow() - _start);
         std::lock_guard<std::mutex> guard(_mutex);
@@ -18,6 +18,7 @@
 #include <stdint.h>
 #include "SharedUtil.h"
 #include "SimpleMovingAverage.h"
+#include "Trace.h"
 
 #include <atomic>
 #include <cstring>
@@ -91,6 +92,9 @@ public:
 private:
     quint64 _start = 0;
     QString _name;
+    // timers are also recorded as trace.timer events whenever tracing, even when the timers aren't active
+    int64_t _traceStart { 0 };
+    tracing::NameID _traceName { tracing::TRACE_NAME_NONE };
     static std::atomic<bool> _isActive;
 
     static std::mutex _mutex;  // used to guard multi-threaded access to _fullNames and _records
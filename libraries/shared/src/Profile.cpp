@@ -34,55 +34,83 @@ Q_LOGGING_CATEGORY(trace_simulation_physics_detail, "trace.simulation.physics.de
 Q_LOGGING_CATEGORY(trace_startup, "trace.startup")
 Q_LOGGING_CATEGORY(trace_workload, "trace.workload")
 Q_LOGGING_CATEGORY(trace_baker, "trace.baker")
+Q_LOGGING_CATEGORY(trace_timer, "trace.timer")
 
 #if defined(NSIGHT_FOUND)
 #include "nvToolsExt.h"
 #define NSIGHT_TRACING
 #endif
 
-static bool tracingEnabled() {
-    if (!DependencyManager::isSet<tracing::Tracer>()) {
-        return false;
-    }
+static bool shouldTrace(const QLoggingCategory& category) {
+    return tracing::enabled() && category.isDebugEnabled();
+}
 
-    // Cheers, love! The cavalry's here!
-    auto tracer = DependencyManager::get<tracing::Tracer>();
-    return (tracer && tracer->isEnabled());
+ProfileDurationBase::ProfileDurationBase(const QLoggingCategory& category, const QString& name) : _category(category) {
+    if (shouldTrace(category)) {
+        _name = tracing::internName(name);
+    }
 }
 
-ProfileDurationBase::ProfileDurationBase(const QLoggingCategory& category, const QString& name) : _name(name), _category(category) {
+ProfileDurationBase::ProfileDurationBase(const QLoggingCategory& category, const char* name) : _category(category) {
+    if (shouldTrace(category)) {
+        _name = tracing::internName(name);
+    }
 }
 
 ProfileDuration::ProfileDuration(const QLoggingCategory& category,
                    const QString& name,
                    uint32_t argbColor,
                    uint64_t payload,
-                   const QVariantMap& baseArgs) :
+                   const QVariantMap& args) :
+    ProfileDurationBase(category, name) {
+    if (_name != tracing::TRACE_NAME_NONE) {
+        begin(argbColor, payload, args, [&] { return name; });
+    }
+}
+
+ProfileDuration::ProfileDuration(const QLoggingCategory& category,
+                   const char* name,
+                   uint32_t argbColor,
+                   uint64_t payload,
+                   const QVariantMap& args) :
     ProfileDurationBase(category, name) {
-    if (tracingEnabled() && category.isDebugEnabled()) {
+    if (_name != tracing::TRACE_NAME_NONE) {
+        begin(argbColor, payload, args, [&] { return QString::fromUtf8(name); });
+    }
+}
+
+// The name is only needed as a string for ranges with extra arguments, which take the slower path of the tracer
+template <typename NameGetter>
+void ProfileDuration::begin(uint32_t argbColor, uint64_t payload, const QVariantMap& baseArgs, const NameGetter& getName) {
+    static const tracing::NameID PAYLOAD_NAME = tracing::internName("nv_payload");
+    if (baseArgs.isEmpty()) {
+        tracing::Tracer::traceEvent(_category, _name, tracing::DurationBegin, tracing::Tracer::now(), PAYLOAD_NAME, (double)payload);
+    } else {
         QVariantMap args = baseArgs;
         args["nv_payload"] = QVariant::fromValue(payload);
-        tracing::traceEvent(_category, _name, tracing::DurationBegin, "", args);
+        tracing::traceEvent(_category, getName(), tracing::DurationBegin, "", args);
+    }
 
 #if defined(NSIGHT_TRACING)
-        nvtxEventAttributes_t eventAttrib{ 0 };
-        eventAttrib.version = NVTX_VERSION;
-        eventAttrib.size = NVTX_EVENT_ATTRIB_STRUCT_SIZE;
-        eventAttrib.colorType = NVTX_COLOR_ARGB;
-        eventAttrib.color = argbColor;
-        eventAttrib.messageType = NVTX_MESSAGE_TYPE_ASCII;
-        eventAttrib.message.ascii = name.toUtf8().data();
-        eventAttrib.payload.llValue = payload;
-        eventAttrib.payloadType = NVTX_PAYLOAD_TYPE_UNSIGNED_INT64;
+    QByteArray message = getName().toUtf8();
+    nvtxEventAttributes_t eventAttrib{ 0 };
+    eventAttrib.version = NVTX_VERSION;
+    eventAttrib.size = NVTX_EVENT_ATTRIB_STRUCT_SIZE;
+    eventAttrib.colorType = NVTX_COLOR_ARGB;
+    eventAttrib.color = argbColor;
+    eventAttrib.messageType = NVTX_MESSAGE_TYPE_ASCII;
+    eventAttrib.message.ascii = message.data();
+    eventAttrib.payload.llValue = payload;
+    eventAttrib.payloadType = NVTX_PAYLOAD_TYPE_UNSIGNED_INT64;
 
-        nvtxRangePushEx(&eventAttrib);
+    nvtxRangePushEx(&eventAttrib);
 #endif
-    }
 }
 
 ProfileDuration::~ProfileDuration() {
-    if (tracingEnabled() && _category.isDebugEnabled()) {
-        tracing::traceEvent(_category, _name, tracing::DurationEnd);
+    // ranges that began before tracing did are left alone, a lone end would confuse the trace
+    if (_name != tracing::TRACE_NAME_NONE) {
+        tracing::Tracer::traceEvent(_category, _name, tracing::DurationEnd, tracing::Tracer::now());
 #ifdef NSIGHT_TRACING
         nvtxRangePop();
 #endif
@@ -92,7 +120,7 @@ ProfileDuration::~ProfileDuration() {
 // FIXME
 uint64_t ProfileDuration::beginRange(const QLoggingCategory& category, const char* name, uint32_t argbColor) {
 #ifdef NSIGHT_TRACING
-    if (tracingEnabled() && category.isDebugEnabled()) {
+    if (shouldTrace(category)) {
         nvtxEventAttributes_t eventAttrib = { 0 };
         eventAttrib.version = NVTX_VERSION;
         eventAttrib.size = NVTX_EVENT_ATTRIB_STRUCT_SIZE;
@@ -109,7 +137,7 @@ uint64_t ProfileDuration::beginRange(const QLoggingCategory& category, const cha
 // FIXME
 void ProfileDuration::endRange(const QLoggingCategory& category, uint64_t rangeId) {
 #ifdef NSIGHT_TRACING
-    if (tracingEnabled() && category.isDebugEnabled()) {
+    if (shouldTrace(category)) {
         nvtxRangeEnd(rangeId);
     }
 #endif
@@ -119,13 +147,17 @@ ConditionalProfileDuration::ConditionalProfileDuration(const QLoggingCategory& c
     ProfileDurationBase(category, name), _startTime(tracing::Tracer::now()), _minTime(minTime * USECS_PER_MSEC) {
 }
 
+ConditionalProfileDuration::ConditionalProfileDuration(const QLoggingCategory& category, const char* name, uint32_t minTime) :
+    ProfileDurationBase(category, name), _startTime(tracing::Tracer::now()), _minTime(minTime * USECS_PER_MSEC) {
+}
+
 ConditionalProfileDuration::~ConditionalProfileDuration() {
-    if (tracingEnabled() && _category.isDebugEnabled()) {
+    if (_name != tracing::TRACE_NAME_NONE) {
         auto endTime = tracing::Tracer::now();
         auto duration = endTime - _startTime;
         if (duration >= _minTime) {
-            tracing::traceEvent(_category, _startTime, _name, tracing::DurationBegin);
-            tracing::traceEvent(_category, endTime, _name, tracing::DurationEnd);
+            tracing::Tracer::traceEvent(_category, _name, tracing::DurationBegin, _startTime);
+            tracing::Tracer::traceEvent(_category, _name, tracing::DurationEnd, endTime);
         }
     }
 }
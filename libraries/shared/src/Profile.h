@@ -39,26 +39,36 @@ Q_DECLARE_LOGGING_CATEGORY(trace_startup)
 Q_DECLARE_LOGGING_CATEGORY(trace_workload)
 Q_DECLARE_LOGGING_CATEGORY(trace_baker)
 
+Q_DECLARE_LOGGING_CATEGORY(trace_timer)
+
+// Names are only interned while tracing, and ranges record no more than a timestamp and their interned name and payload
 class ProfileDurationBase {
 
 protected:
     ProfileDurationBase(const QLoggingCategory& category, const QString& name);
-    const QString _name;
+    ProfileDurationBase(const QLoggingCategory& category, const char* name);
+    tracing::NameID _name { tracing::TRACE_NAME_NONE };
     const QLoggingCategory& _category;
 };
 
 class ProfileDuration : public ProfileDurationBase {
 public:
     ProfileDuration(const QLoggingCategory& category, const QString& name, uint32_t argbColor = 0xff0000ff, uint64_t payload = 0, const QVariantMap& args = QVariantMap());
+    ProfileDuration(const QLoggingCategory& category, const char* name, uint32_t argbColor = 0xff0000ff, uint64_t payload = 0, const QVariantMap& args = QVariantMap());
     ~ProfileDuration();
 
     static uint64_t beginRange(const QLoggingCategory& category, const char* name, uint32_t argbColor);
     static void endRange(const QLoggingCategory& category, uint64_t rangeId);
+
+private:
+    template <typename NameGetter>
+    void begin(uint32_t argbColor, uint64_t payload, const QVariantMap& args, const NameGetter& getName);
 };
 
 class ConditionalProfileDuration : public ProfileDurationBase {
 public:
     ConditionalProfileDuration(const QLoggingCategory& category, const QString& name, uint32_t minTime);
+    ConditionalProfileDuration(const QLoggingCategory& category, const char* name, uint32_t minTime);
     ~ConditionalProfileDuration();
 
 private:
@@ -8,101 +8,635 @@
 
 #include "Trace.h"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 #include <QtCore/QDebug>
 #include <QtCore/QCoreApplication>
 #include <QtCore/QThread>
-#include <QtCore/QFileInfo>
-#include <QtCore/QDir>
-#include <QtCore/QStandardPaths>
-
-#include <QtCore/QFile>
-#include <QtCore/QFileInfo>
-#include <QtCore/QTemporaryFile>
+#include <QtCore/QBuffer>
 #include <QtCore/QDataStream>
-#include <QtCore/QTextStream>
+#include <QtCore/QFile>
 
-#include <QtCore/QJsonObject>
+#include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
 
-#include <BuildInfo.h>
-
 #include "Gzip.h"
 #include "PortableHighResolutionClock.h"
 #include "SharedLogging.h"
 #include "shared/FileUtils.h"
-#include "shared/GlobalAppProperties.h"
 
 using namespace tracing;
 
+static const uint32_t TRACE_DUMP_MAGIC = 0x52544648; // "HFTR"
+static const uint32_t TRACE_DUMP_VERSION = 1;
+static const uint16_t MAX_TRACE_CATEGORIES = std::numeric_limits<uint16_t>::max();
+
+static std::atomic<bool> tracingEnabled { false };
+// events go to the thread's ring while recording, and to the thread's log between startTracing() and stopTracing()
+static std::atomic<bool> recordingEnabled { false };
+static std::atomic<bool> traceLogEnabled { false };
+static std::atomic<uint32_t> traceLogGeneration { 0 };
+static std::atomic<size_t> eventsPerThread { Tracer::DEFAULT_EVENTS_PER_THREAD };
+
 bool tracing::enabled() {
-    return DependencyManager::get<Tracer>()->isEnabled();
+    return tracingEnabled.load(std::memory_order_relaxed);
+}
+
+namespace {
+
+struct StringViewHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view string) const { return std::hash<std::string_view>()(string); }
+};
+
+// The process wide tables are never destroyed, as threads may still record events while the process exits
+class NameTable {
+public:
+    static NameTable& instance() {
+        static auto table = new NameTable();
+        return *table;
+    }
+
+    NameID intern(const QString& name) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto itr = _ids.find(name);
+        if (itr != _ids.end()) {
+            return itr.value();
+        }
+        if (_names.size() >= MAX_TRACE_NAMES) {
+            return TRACE_NAME_OVERFLOW;
+        }
+        NameID id = (NameID)_names.size();
+        _names.push_back(name);
+        _ids.insert(name, id);
+        return id;
+    }
+
+    std::vector<QString> getNames() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _names;
+    }
+
+private:
+    NameTable() : _names({ QString(), QStringLiteral("<overflow>") }) {}
+
+    std::mutex _mutex;
+    std::vector<QString> _names;
+    QHash<QString, NameID> _ids;
+};
+
+class CategoryTable {
+public:
+    static CategoryTable& instance() {
+        static auto table = new CategoryTable();
+        return *table;
+    }
+
+    uint16_t getIndex(const QLoggingCategory& category) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (size_t i = 0; i < _categories.size(); ++i) {
+            if (_categories[i] == &category) {
+                return (uint16_t)i;
+            }
+        }
+        if (_categories.size() >= MAX_TRACE_CATEGORIES) {
+            return 0;
+        }
+        _categories.push_back(&category);
+        return (uint16_t)(_categories.size() - 1);
+    }
+
+    std::vector<QByteArray> getNames() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::vector<QByteArray> result;
+        for (const auto& category : _categories) {
+            result.push_back(category->categoryName());
+        }
+        return result;
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<const QLoggingCategory*> _categories;
+};
+
+// The string argument values of a dump, each one once
+class DumpStrings {
+public:
+    uint32_t add(const QString& string) {
+        auto itr = _ids.find(string);
+        if (itr != _ids.end()) {
+            return itr.value();
+        }
+        uint32_t id = (uint32_t)_strings.size();
+        _strings.push_back(string);
+        _ids.insert(string, id);
+        return id;
+    }
+
+    const std::vector<QString>& getStrings() const { return _strings; }
+
+private:
+    std::vector<QString> _strings;
+    QHash<QString, uint32_t> _ids;
+};
+
+// Appends the records from begin to end that are between since and until to result.  String values kept with the
+// events are looked up with getString and added to strings, records whose string is gone get an empty one.
+template <typename Iterator, typename GetString>
+void appendRecords(Iterator begin, Iterator end, int64_t since, int64_t until, std::vector<TraceRecord>& result,
+                   DumpStrings& strings, GetString getString) {
+    bool keep = false;
+    for (auto itr = begin; itr != end; ++itr) {
+        // arguments go along with their event, and are dropped with it or when it was overwritten
+        if (!(itr->flags & TraceRecord::ArgumentContinuation)) {
+            keep = itr->timestamp >= since && itr->timestamp <= until;
+        }
+        if (!keep) {
+            continue;
+        }
+        result.push_back(*itr);
+        auto& record = result.back();
+        if (record.flags & TraceRecord::LocalStringValue) {
+            QString string;
+            if (getString((uint64_t)record.value, string)) {
+                record.value = (double)strings.add(string);
+            } else {
+                record.value = TRACE_NAME_NONE;
+                record.flags = (uint8_t)((record.flags & ~TraceRecord::LocalStringValue) | TraceRecord::StringValue);
+            }
+        }
+    }
+}
+
+// A record kept as words written and read with relaxed atomics, so that a copy racing the owning thread gets a torn
+// record for the claims to drop rather than a data race
+struct TraceSlot {
+    static const size_t WORD_COUNT = sizeof(TraceRecord) / sizeof(uint64_t);
+    std::atomic<uint64_t> words[WORD_COUNT];
+
+    void store(const TraceRecord& record) {
+        uint64_t values[WORD_COUNT];
+        memcpy(values, &record, sizeof(TraceRecord));
+        for (size_t i = 0; i < WORD_COUNT; ++i) {
+            words[i].store(values[i], std::memory_order_relaxed);
+        }
+    }
+
+    TraceRecord load() const {
+        uint64_t values[WORD_COUNT];
+        for (size_t i = 0; i < WORD_COUNT; ++i) {
+            values[i] = words[i].load(std::memory_order_relaxed);
+        }
+        TraceRecord record;
+        memcpy(&record, values, sizeof(TraceRecord));
+        return record;
+    }
+};
+static_assert(sizeof(TraceRecord) % sizeof(uint64_t) == 0, "TraceSlot holds whole records");
+
+// A ring of the latest events of one thread.  Only the owning thread writes.  It claims a slot before writing it and
+// advances the head after, so readers copy the records behind the head and then drop whatever the claims show may
+// have been overwritten meanwhile.  String argument values are kept in a smaller ring of their own.
+class TraceRing {
+public:
+    TraceRing(int64_t threadID, size_t capacity) :
+        threadID(threadID), _capacity(capacity), _records(new TraceSlot[capacity]()),
+        _stringsCapacity(std::max<size_t>(capacity / 4, 1)), _strings(new QString[_stringsCapacity]) {}
+
+    void push(const TraceRecord* records, size_t count, const std::vector<QString>& strings) {
+        uint64_t firstString = 0;
+        if (!strings.empty()) {
+            std::lock_guard<std::mutex> lock(_stringsMutex);
+            firstString = _stringsHead;
+            for (const auto& string : strings) {
+                _strings[_stringsHead++ % _stringsCapacity] = string;
+            }
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            auto head = _head.load(std::memory_order_relaxed);
+            _claimed.store(head + 1, std::memory_order_relaxed);
+            // the claim is visible before any of the slot's new contents
+            std::atomic_thread_fence(std::memory_order_release);
+            auto record = records[i];
+            if (record.flags & TraceRecord::LocalStringValue) {
+                record.value += (double)firstString;
+            }
+            _records[head % _capacity].store(record);
+            _head.store(head + 1, std::memory_order_release);
+        }
+    }
+
+    void copy(int64_t since, int64_t until, std::vector<TraceRecord>& result, DumpStrings& strings) const {
+        auto head = _head.load(std::memory_order_acquire);
+        auto first = head > _capacity ? head - _capacity : 0;
+        std::vector<TraceRecord> records;
+        records.reserve(head - first);
+        for (auto i = first; i < head; ++i) {
+            records.push_back(_records[i % _capacity].load());
+        }
+
+        // any record whose slot has since been claimed again may be torn
+        std::atomic_thread_fence(std::memory_order_acquire);
+        auto claimed = _claimed.load(std::memory_order_relaxed);
+        auto firstValid = claimed > _capacity ? claimed - _capacity : 0;
+        auto skipped = firstValid > first ? std::min<uint64_t>(firstValid - first, records.size()) : 0;
+
+        std::lock_guard<std::mutex> lock(_stringsMutex);
+        appendRecords(records.begin() + skipped, records.end(), since, until, result, strings,
+            [&](uint64_t index, QString& string) {
+                if (index >= _stringsHead || index + _stringsCapacity < _stringsHead) {
+                    return false;
+                }
+                string = _strings[index % _stringsCapacity];
+                return true;
+            });
+    }
+
+    const int64_t threadID;
+
+private:
+    const uint64_t _capacity;
+    std::unique_ptr<TraceSlot[]> _records;
+    std::atomic<uint64_t> _head { 0 };
+    std::atomic<uint64_t> _claimed { 0 };
+
+    const uint64_t _stringsCapacity;
+    std::unique_ptr<QString[]> _strings;
+    uint64_t _stringsHead { 0 };
+    mutable std::mutex _stringsMutex;
+};
+using TraceRingPointer = std::shared_ptr<TraceRing>;
+
+// Every event of one thread from startTracing() on, so that a trace bracketed by startTracing() and stopTracing() is
+// complete however long it runs.  The lock is only contended while the trace is serialized.
+class TraceLog {
+public:
+    TraceLog(int64_t threadID) : threadID(threadID) {}
+
+    void push(const TraceRecord* records, size_t count, const std::vector<QString>& strings) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto firstString = _strings.size();
+        _strings.insert(_strings.end(), strings.begin(), strings.end());
+        for (size_t i = 0; i < count; ++i) {
+            _records.push_back(records[i]);
+            if (records[i].flags & TraceRecord::LocalStringValue) {
+                _records.back().value += (double)firstString;
+            }
+        }
+    }
+
+    void copy(int64_t since, int64_t until, std::vector<TraceRecord>& result, DumpStrings& strings) const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        appendRecords(_records.begin(), _records.end(), since, until, result, strings,
+            [&](uint64_t index, QString& string) {
+                string = _strings[index];
+                return true;
+            });
+    }
+
+    const int64_t threadID;
+
+private:
+    mutable std::mutex _mutex;
+    std::vector<TraceRecord> _records;
+    std::vector<QString> _strings;
+};
+using TraceLogPointer = std::shared_ptr<TraceLog>;
+
+class TraceRings {
+public:
+    static TraceRings& instance() {
+        static auto rings = new TraceRings();
+        return *rings;
+    }
+
+    TraceRingPointer add(int64_t threadID) {
+        auto ring = std::make_shared<TraceRing>(threadID, eventsPerThread.load());
+        std::lock_guard<std::mutex> lock(_mutex);
+        _rings.push_back(ring);
+        return ring;
+    }
+
+    // The latest events of threads that exited are kept, but only for the last few of them as thread pools come and go
+    void retire(const TraceRingPointer& ring) {
+        static const size_t MAX_RETIRED_RINGS = 16;
+        std::lock_guard<std::mutex> lock(_mutex);
+        _rings.erase(std::remove(_rings.begin(), _rings.end(), ring), _rings.end());
+        _retiredRings.push_back(ring);
+        if (_retiredRings.size() > MAX_RETIRED_RINGS) {
+            _retiredRings.pop_front();
+        }
+    }
+
+    std::vector<TraceRingPointer> getRings() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto result = _rings;
+        result.insert(result.end(), _retiredRings.begin(), _retiredRings.end());
+        return result;
+    }
+
+    // Logs outlive their threads, and are dropped when the next trace starts
+    TraceLogPointer addLog(int64_t threadID) {
+        auto log = std::make_shared<TraceLog>(threadID);
+        std::lock_guard<std::mutex> lock(_mutex);
+        _logs.push_back(log);
+        return log;
+    }
+
+    void clearLogs() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _logs.clear();
+    }
+
+    std::vector<TraceLogPointer> getLogs() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _logs;
+    }
+
+    // Metadata describes threads and processes, so it's kept apart from the rings for every trace to include
+    void addMetadata(int64_t threadID, const std::vector<TraceRecord>& records) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto& threadMetadata = _metadata[threadID];
+        threadMetadata.insert(threadMetadata.end(), records.begin(), records.end());
+    }
+
+    std::unordered_map<int64_t, std::vector<TraceRecord>> getMetadata() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _metadata;
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<TraceRingPointer> _rings;
+    std::deque<TraceRingPointer> _retiredRings;
+    std::vector<TraceLogPointer> _logs;
+    std::unordered_map<int64_t, std::vector<TraceRecord>> _metadata;
+};
+
+class ThreadState {
+public:
+    ~ThreadState() {
+        if (_ring) {
+            TraceRings::instance().retire(_ring);
+        }
+    }
+
+    int64_t getThreadID() {
+        if (_threadID == 0) {
+            _threadID = int64_t(QThread::currentThreadId());
+        }
+        return _threadID;
+    }
+
+    TraceRing& getRing() {
+        if (!_ring) {
+            _ring = TraceRings::instance().add(getThreadID());
+        }
+        return *_ring;
+    }
+
+    TraceLog& getLog() {
+        auto generation = traceLogGeneration.load(std::memory_order_relaxed);
+        if (!_log || _logGeneration != generation) {
+            _log = TraceRings::instance().addLog(getThreadID());
+            _logGeneration = generation;
+        }
+        return *_log;
+    }
+
+    void record(const TraceRecord* records, size_t count, const std::vector<QString>& strings = {}) {
+        if (recordingEnabled.load(std::memory_order_relaxed)) {
+            getRing().push(records, count, strings);
+        }
+        if (traceLogEnabled.load(std::memory_order_relaxed)) {
+            getLog().push(records, count, strings);
+        }
+    }
+
+    // Overflowed names aren't cached, so that the cache can't grow past the name table
+    NameID internName(const QString& name) {
+        auto itr = _qstringNames.find(name);
+        if (itr != _qstringNames.end()) {
+            return itr.value();
+        }
+        auto id = NameTable::instance().intern(name);
+        if (id != TRACE_NAME_OVERFLOW) {
+            _qstringNames.insert(name, id);
+        }
+        return id;
+    }
+
+    NameID internName(const char* name) {
+        std::string_view nameView(name);
+        auto itr = _cstringNames.find(nameView);
+        if (itr != _cstringNames.end()) {
+            return itr->second;
+        }
+        auto id = NameTable::instance().intern(QString::fromUtf8(name, (int)nameView.size()));
+        if (id != TRACE_NAME_OVERFLOW) {
+            _cstringNames.emplace(std::string(nameView), id);
+        }
+        return id;
+    }
+
+    uint16_t getCategoryIndex(const QLoggingCategory& category) {
+        auto itr = _categories.find(&category);
+        if (itr != _categories.end()) {
+            return itr->second;
+        }
+        auto index = CategoryTable::instance().getIndex(category);
+        _categories.emplace(&category, index);
+        return index;
+    }
+
+private:
+    int64_t _threadID { 0 };
+    TraceRingPointer _ring;
+    TraceLogPointer _log;
+    uint32_t _logGeneration { 0 };
+    QHash<QString, NameID> _qstringNames;
+    std::unordered_map<std::string, NameID, StringViewHash, std::equal_to<>> _cstringNames;
+    std::unordered_map<const QLoggingCategory*, uint16_t> _categories;
+};
+thread_local ThreadState threadState;
+
+size_t roundUpToPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+// String values are mostly unique, urls and the like, so they're kept with the event in strings rather than interned.
+// Metadata is kept for good, and has no strings to go with it, so its values are interned.
+void setArgument(TraceRecord& record, const QString& key, const QVariant& value, std::vector<QString>* strings) {
+    record.argument = threadState.internName(key);
+    switch (value.userType()) {
+        case QMetaType::Bool:
+        case QMetaType::Int:
+        case QMetaType::UInt:
+        case QMetaType::Long:
+        case QMetaType::ULong:
+        case QMetaType::LongLong:
+        case QMetaType::ULongLong:
+        case QMetaType::Short:
+        case QMetaType::UShort:
+        case QMetaType::Float:
+        case QMetaType::Double:
+            record.value = value.toDouble();
+            break;
+        default:
+            if (strings) {
+                strings->push_back(value.toString());
+                record.value = (double)(strings->size() - 1);
+                record.flags |= TraceRecord::LocalStringValue;
+            } else {
+                record.value = threadState.internName(value.toString());
+                record.flags |= TraceRecord::StringValue;
+            }
+            break;
+    }
+}
+
+using ThreadRecords = std::unordered_map<int64_t, std::vector<TraceRecord>>;
+
+// Writes the binary trace format.  The strings are appended to the names, and the records' values referring to them
+// become name IDs.
+QByteArray writeDump(ThreadRecords& threadRecords, const DumpStrings& dumpStrings) {
+    const auto& strings = dumpStrings.getStrings();
+    // names interned after the records were copied are harmless, the records can't refer to them
+    auto names = NameTable::instance().getNames();
+    const double firstString = (double)names.size();
+    for (auto& thread : threadRecords) {
+        for (auto& record : thread.second) {
+            if (record.flags & TraceRecord::LocalStringValue) {
+                record.value += firstString;
+                record.flags = (uint8_t)((record.flags & ~TraceRecord::LocalStringValue) | TraceRecord::StringValue);
+            }
+        }
+    }
+
+    QByteArray result;
+    QBuffer buffer(&result);
+    buffer.open(QIODevice::WriteOnly);
+    QDataStream out(&buffer);
+    out.setByteOrder(QDataStream::LittleEndian);
+
+    out << TRACE_DUMP_MAGIC << TRACE_DUMP_VERSION << (qint64)QCoreApplication::applicationPid();
+
+    out << (quint32)(names.size() + strings.size());
+    for (const auto& name : names) {
+        out << name.toUtf8();
+    }
+    for (const auto& string : strings) {
+        out << string.toUtf8();
+    }
+
+    auto categories = CategoryTable::instance().getNames();
+    out << (quint32)categories.size();
+    for (const auto& category : categories) {
+        out << category;
+    }
+
+    out << (quint32)threadRecords.size();
+    for (const auto& thread : threadRecords) {
+        out << (qint64)thread.first << (quint32)thread.second.size();
+        out.writeRawData(reinterpret_cast<const char*>(thread.second.data()), (int)(thread.second.size() * sizeof(TraceRecord)));
+    }
+    return result;
+}
+
+// QJsonDocument is too slow for whole traces, but is used once per name to get the escaping right
+QByteArray toJsonString(const QString& string) {
+    auto array = QJsonDocument(QJsonArray { string }).toJson(QJsonDocument::Compact);
+    return array.mid(1, array.size() - 2);
+}
+
+QByteArray toJsonNumber(double value) {
+    static const double MAX_EXACT_INTEGER = 9007199254740992.0;
+    if (!std::isfinite(value)) {
+        return "0";
+    }
+    if (value == std::floor(value) && std::abs(value) < MAX_EXACT_INTEGER) {
+        return QByteArray::number((qint64)value);
+    }
+    return QByteArray::number(value, 'g', 17);
+}
+
+}
+
+int64_t Tracer::now() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(p_high_resolution_clock::now().time_since_epoch()).count();
+}
+
+NameID tracing::internName(const QString& name) {
+    return threadState.internName(name);
+}
+
+NameID tracing::internName(const char* name) {
+    return threadState.internName(name);
+}
+
+void Tracer::updateEnabled() {
+    recordingEnabled.store(_recording);
+    traceLogEnabled.store(_enabled);
+    tracingEnabled.store(_enabled || _recording);
 }
 
 void Tracer::startTracing() {
-    std::lock_guard<std::mutex> guard(_eventsMutex);
+    std::lock_guard<std::mutex> guard(_mutex);
     if (_enabled) {
         qWarning() << "Tried to enable tracer, but already enabled";
         return;
     }
 
-    _events.clear();
+    // the previous trace's events are dropped, threads start new logs as they record their next event
+    TraceRings::instance().clearLogs();
+    ++traceLogGeneration;
+    _traceStart = now();
+    _traceEnd = std::numeric_limits<int64_t>::max();
     _enabled = true;
+    updateEnabled();
 }
 
 void Tracer::stopTracing() {
-    std::lock_guard<std::mutex> guard(_eventsMutex);
+    std::lock_guard<std::mutex> guard(_mutex);
     if (!_enabled) {
         qWarning() << "Cannot stop tracing, already disabled";
         return;
     }
+    _traceEnd = now();
     _enabled = false;
+    updateEnabled();
 }
 
-void TraceEvent::writeJson(QTextStream& out) const {
-#if 0
-    // FIXME QJsonObject serialization is very slow, so we should be using manual JSON serialization
-    out << "{";
-    out << "\"name\":\"" << name << "\",";
-    out << "\"cat\":\"" << category.categoryName() << "\",";
-    out << "\"ph\":\"" << QString(type) << "\",";
-    out << "\"ts\":\"" << timestamp << "\",";
-    out << "\"pid\":\"" << processID << "\",";
-    out << "\"tid\":\"" << threadID << "\"";
-    //if (!extra.empty()) {
-    //    auto it = extra.begin();
-    //    for (; it != extra.end(); it++) {
-    //        ev[it.key()] = QJsonValue::fromVariant(it.value());
-    //    }
-    //}
-    //if (!args.empty()) {
-    //    out << ",\"args\":'
-    //}
-    out << '}';
-#else
-    QJsonObject ev {
-        { "name", QJsonValue(name) },
-        { "cat", category.categoryName() },
-        { "ph", QString(type) },
-        { "ts", timestamp },
-        { "pid", processID },
-        { "tid", threadID }
-    };
-    if (!id.isEmpty()) {
-        ev["id"] = id;
-    }
-    if (!args.empty()) {
-        ev["args"] = QJsonObject::fromVariantMap(args);
-    }
-    if (!extra.empty()) {
-        auto it = extra.begin();
-        for (; it != extra.end(); it++) {
-            ev[it.key()] = QJsonValue::fromVariant(it.value());
-        }
-    }
-    out << QJsonDocument(ev).toJson(QJsonDocument::Compact);
-#endif
+void Tracer::startRecording() {
+    std::lock_guard<std::mutex> guard(_mutex);
+    _recording = true;
+    updateEnabled();
+}
+
+void Tracer::stopRecording() {
+    std::lock_guard<std::mutex> guard(_mutex);
+    _recording = false;
+    updateEnabled();
+}
+
+void Tracer::setEventsPerThread(size_t eventsPerThread) {
+    ::eventsPerThread = roundUpToPowerOfTwo(std::max<size_t>(eventsPerThread, 1));
 }
 
 void Tracer::serialize(const QString& filename) {
@@ -112,31 +646,21 @@ void Tracer::serialize(const QString& filename) {
         return;
     }
 
-    std::list<TraceEvent> currentEvents;
+    int64_t traceStart;
+    int64_t traceEnd;
     {
-        std::lock_guard<std::mutex> guard(_eventsMutex);
-        currentEvents.swap(_events);
-        for (auto& event : _metadataEvents) {
-            currentEvents.push_back(event);
-        }
+        std::lock_guard<std::mutex> guard(_mutex);
+        traceStart = _traceStart;
+        traceEnd = _traceEnd;
     }
 
-    // If we can't open a temp file for writing, fail early
-    QByteArray data;
-    {
-        QTextStream out(&data);
-        out << "[\n";
-        bool first = true;
-        for (const auto& event : currentEvents) {
-            if (first) {
-                first = false;
-            } else {
-                out << ",\n";
-            }
-            event.writeJson(out);
-        }
-        out << "\n]";
+    auto& rings = TraceRings::instance();
+    ThreadRecords threadRecords = rings.getMetadata();
+    DumpStrings strings;
+    for (const auto& log : rings.getLogs()) {
+        log->copy(traceStart, traceEnd, threadRecords[log->threadID], strings);
     }
+    QByteArray data = toChromeTrace(writeDump(threadRecords, strings));
 
     if (fullPath.endsWith(".gz")) {
         QByteArray compressed;
@@ -153,94 +677,213 @@ void Tracer::serialize(const QString& filename) {
         file.write(data);
         file.close();
     }
+}
 
-#if 0
-    QByteArray data;
-    {
+QByteArray Tracer::dump(int64_t since, int64_t until) const {
+    auto& rings = TraceRings::instance();
+    ThreadRecords threadRecords = rings.getMetadata();
+    DumpStrings strings;
+    for (const auto& ring : rings.getRings()) {
+        ring->copy(since, until, threadRecords[ring->threadID], strings);
+    }
+    return writeDump(threadRecords, strings);
+}
+
+QByteArray Tracer::toChromeTrace(const QByteArray& dump) {
+    QDataStream in(dump);
+    in.setByteOrder(QDataStream::LittleEndian);
+
+    quint32 magic;
+    quint32 version;
+    qint64 processID;
+    in >> magic >> version >> processID;
+    if (in.status() != QDataStream::Ok || magic != TRACE_DUMP_MAGIC || version != TRACE_DUMP_VERSION) {
+        return QByteArray();
+    }
+
+    // every name is escaped once up front
+    // the names are followed by the string values of the dump, so there can be more than MAX_TRACE_NAMES, but every
+    // one takes at least its length
+    quint32 nameCount;
+    in >> nameCount;
+    if ((qint64)nameCount * (qint64)sizeof(quint32) > in.device()->bytesAvailable()) {
+        return QByteArray();
+    }
+    std::vector<QByteArray> names;
+    names.reserve(nameCount);
+    for (quint32 i = 0; i < nameCount && in.status() == QDataStream::Ok; ++i) {
+        QByteArray name;
+        in >> name;
+        names.push_back(toJsonString(QString::fromUtf8(name)));
+    }
+
+    quint32 categoryCount;
+    in >> categoryCount;
+    if (categoryCount > MAX_TRACE_CATEGORIES) {
+        return QByteArray();
+    }
+    std::vector<QByteArray> categories;
+    categories.reserve(categoryCount);
+    for (quint32 i = 0; i < categoryCount && in.status() == QDataStream::Ok; ++i) {
+        QByteArray category;
+        in >> category;
+        categories.push_back(toJsonString(QString::fromUtf8(category)));
+    }
+
+    quint32 threadCount;
+    in >> threadCount;
+    if (in.status() != QDataStream::Ok) {
+        return QByteArray();
+    }
 
-        // "traceEvents":[
-        // {"args":{"nv_payload":0},"cat":"hifi.render","name":"render::Scene::processTransactionQueue","ph":"B","pid":14796,"tid":21636,"ts":68795933487}
+    static const QByteArray EMPTY_STRING = "\"\"";
+    auto getName = [&](NameID id) -> const QByteArray& {
+        return id < names.size() ? names[id] : EMPTY_STRING;
+    };
+    auto getArgumentValue = [&](const TraceRecord& record) -> QByteArray {
+        return (record.flags & TraceRecord::StringValue) ? getName((NameID)record.value) : toJsonNumber(record.value);
+    };
 
-        QJsonArray traceEvents;
+    const QByteArray pid = QByteArray::number(processID);
+    QByteArray result = "[\n";
+    bool first = true;
+    for (quint32 thread = 0; thread < threadCount; ++thread) {
+        qint64 threadID;
+        quint32 recordCount;
+        in >> threadID >> recordCount;
+        if (in.status() != QDataStream::Ok || (qint64)recordCount * (qint64)sizeof(TraceRecord) > in.device()->bytesAvailable()) {
+            return QByteArray();
+        }
+        std::vector<TraceRecord> records(recordCount);
+        in.readRawData(reinterpret_cast<char*>(records.data()), (int)(recordCount * sizeof(TraceRecord)));
+        const QByteArray tid = QByteArray::number(threadID);
 
-        QJsonDocument document {
-            QJsonObject {
-                { "traceEvents", traceEvents },
-                { "otherData", QJsonObject {
-                    { "version", QString { "High Fidelity Interface v1.0" } +BuildInfo::VERSION }
-                } }
+        // an event is written once all of the arguments that follow it have been seen
+        QByteArray event;
+        QByteArray args;
+        auto finishEvent = [&] {
+            if (event.isEmpty()) {
+                return;
             }
+            if (!args.isEmpty()) {
+                event += ",\"args\":{" + args + "}";
+            }
+            event += "}";
+            if (!first) {
+                result += ",\n";
+            }
+            first = false;
+            result += event;
+            event.clear();
+            args.clear();
         };
-        data = document.toJson(QJsonDocument::Compact);
+        auto addArgument = [&](const TraceRecord& record) {
+            if (record.argument == TRACE_NAME_NONE) {
+                return;
+            }
+            auto member = getName(record.argument) + ":" + getArgumentValue(record);
+            if (record.flags & TraceRecord::ExtraArgument) {
+                event += "," + member;
+            } else {
+                args += (args.isEmpty() ? "" : ",") + member;
+            }
+        };
+
+        for (const auto& record : records) {
+            if (record.flags & TraceRecord::ArgumentContinuation) {
+                // leftovers of an event that was overwritten are dropped
+                if (!event.isEmpty()) {
+                    addArgument(record);
+                }
+                continue;
+            }
+
+            finishEvent();
+            event = "{\"name\":" + getName(record.name);
+            event += ",\"cat\":" + (record.category < categories.size() ? categories[record.category] : EMPTY_STRING);
+            event += ",\"ph\":\"" + QByteArray(1, record.type) + "\"";
+            event += ",\"ts\":" + QByteArray::number(record.timestamp);
+            event += ",\"pid\":" + pid + ",\"tid\":" + tid;
+            if (record.flags & TraceRecord::HasID) {
+                event += ",\"id\":\"0x" + QByteArray::number(record.id, 16) + "\"";
+            }
+            if (record.type == Complete) {
+                event += ",\"dur\":" + toJsonNumber(record.value);
+            } else {
+                addArgument(record);
+            }
+        }
+        finishEvent();
     }
-#endif
+    result += "\n]";
+    return result;
 }
 
-int64_t Tracer::now() {
-    return std::chrono::duration_cast<std::chrono::microseconds>(p_high_resolution_clock::now().time_since_epoch()).count();
+void Tracer::traceEvent(const QLoggingCategory& category, NameID name, EventType type, int64_t timestamp,
+                        NameID argument, double value) {
+    if (!tracing::enabled() && type != Metadata) {
+        return;
+    }
+
+    TraceRecord record { timestamp, value, name, argument, 0, threadState.getCategoryIndex(category), type, 0 };
+    if (type == Metadata) {
+        TraceRings::instance().addMetadata(threadState.getThreadID(), { record });
+    } else {
+        threadState.record(&record, 1);
+    }
 }
 
 void Tracer::traceEvent(const QLoggingCategory& category,
-    const QString& name, EventType type,
-    qint64 timestamp, qint64 processID, qint64 threadID,
-    const QString& id,
+    const QString& name, EventType type, const QString& id,
     const QVariantMap& args, const QVariantMap& extra) {
-    std::lock_guard<std::mutex> guard(_eventsMutex);
+    if (!isEnabled() && type != Metadata) {
+        return;
+    }
+
+    traceEvent(category, name, type, now(), id, args, extra);
+}
 
+void Tracer::traceEvent(const QLoggingCategory& category,
+    const QString& name, EventType type, int64_t timestamp, const QString& id,
+    const QVariantMap& args, const QVariantMap& extra) {
     // We always want to store metadata events even if tracing is not enabled so that when
     // tracing is enabled we will be able to associate that metadata with that trace.
     // Metadata events should be used sparingly - as of 12/30/16 the Chrome Tracing
     // spec only supports thread+process metadata, so we should only expect to see metadata
     // events created when a new thread or process is created.
-    if (!_enabled && type != Metadata) {
+    if (!isEnabled() && type != Metadata) {
         return;
     }
 
-    if (type == Metadata) {
-        _metadataEvents.push_back({
-            id,
-            name,
-            type,
-            timestamp,
-            processID,
-            threadID,
-            category,
-            args,
-            extra
-        });
-    } else {
-        _events.push_back({
-            id,
-            name,
-            type,
-            timestamp,
-            processID,
-            threadID,
-            category,
-            args,
-            extra
-        });
-    }
-}
-
-void Tracer::traceEvent(const QLoggingCategory& category, 
-    const QString& name, EventType type, const QString& id, 
-    const QVariantMap& args, const QVariantMap& extra) {
-    if (!_enabled && type != Metadata) {
-        return;
+    TraceRecord record { timestamp, 0.0, threadState.internName(name), TRACE_NAME_NONE, 0,
+                         threadState.getCategoryIndex(category), type, 0 };
+    if (!id.isEmpty()) {
+        record.id = qHash(id);
+        record.flags |= TraceRecord::HasID;
     }
 
-    traceEvent(category, name, type, now(), id, args, extra);
-}
+    // the first argument goes in the event itself unless its value holds a duration, any others follow it
+    std::vector<TraceRecord> records { record };
+    std::vector<QString> strings;
+    auto eventStrings = type == Metadata ? nullptr : &strings;
+    auto addArguments = [&](const QVariantMap& arguments, uint8_t flags) {
+        for (auto itr = arguments.begin(); itr != arguments.end(); ++itr) {
+            if (type != Complete && flags == 0 && records.size() == 1 && records[0].argument == TRACE_NAME_NONE) {
+                setArgument(records[0], itr.key(), itr.value(), eventStrings);
+                continue;
+            }
+            records.push_back({ timestamp, 0.0, record.name, TRACE_NAME_NONE, 0, record.category, type,
+                                (uint8_t)(TraceRecord::ArgumentContinuation | flags) });
+            setArgument(records.back(), itr.key(), itr.value(), eventStrings);
+        }
+    };
+    addArguments(args, 0);
+    addArguments(extra, TraceRecord::ExtraArgument);
 
-void Tracer::traceEvent(const QLoggingCategory& category, 
-    const QString& name, EventType type, int64_t timestamp, const QString& id, 
-    const QVariantMap& args, const QVariantMap& extra) {
-    if (!_enabled && type != Metadata) {
+    if (type == Metadata) {
+        TraceRings::instance().addMetadata(threadState.getThreadID(), records);
         return;
     }
 
-    auto processID = QCoreApplication::applicationPid();
-    auto threadID = int64_t(QThread::currentThreadId());
-    traceEvent(category, name, type, timestamp, processID, threadID, id, args, extra);
+    threadState.record(records.data(), records.size(), strings);
 }
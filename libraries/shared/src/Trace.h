@@ -10,7 +10,9 @@
 #ifndef hifi_Trace_h
 #define hifi_Trace_h
 
+#include <atomic>
 #include <cstdint>
+#include <limits>
 #include <mutex>
 
 #include <QtCore/QString>
@@ -62,50 +64,96 @@ enum EventType : char {
     ContextLeave = ')'
 };
 
-struct TraceEvent {
-    QString id;
-    QString name;
+// Event and argument names are interned once per process, so events only carry their id.  Names are never released,
+// so once MAX_TRACE_NAMES names exist any new one is recorded as TRACE_NAME_OVERFLOW.  String argument values are
+// mostly unique and are kept with the events instead.
+using NameID = uint32_t;
+const NameID TRACE_NAME_NONE = 0;
+const NameID TRACE_NAME_OVERFLOW = 1;
+const size_t MAX_TRACE_NAMES = 1 << 16;
+
+NameID internName(const QString& name);
+NameID internName(const char* name);
+
+// A fixed size event, as stored in the per thread rings and in binary dumps.  Events with more than one argument are
+// followed by ArgumentContinuation records holding the others.
+struct TraceRecord {
+    enum Flags : uint8_t {
+        ArgumentContinuation = 1 << 0, // only holds another argument of the previous event
+        StringValue = 1 << 1,          // value is the NameID of a string rather than a number
+        ExtraArgument = 1 << 2,        // the argument is a top level member of the event rather than one of its args
+        HasID = 1 << 3,
+        LocalStringValue = 1 << 4,     // value indexes the strings kept with the thread's events, never in dumps
+    };
+
+    int64_t timestamp;
+    // the argument value, or the duration of Complete events
+    double value;
+    NameID name;
+    NameID argument;
+    uint32_t id;
+    uint16_t category;
     EventType type;
-    qint64 timestamp;
-    qint64 processID;
-    qint64 threadID;
-    const QLoggingCategory& category;
-    QVariantMap args;
-    QVariantMap extra;
-
-    void writeJson(QTextStream& out) const;
+    uint8_t flags;
 };
+static_assert(sizeof(TraceRecord) == 32, "TraceRecord is written to dumps as is");
 
+// Records trace events into a lock free ring buffer per thread, so that recording an event costs a timestamp and a
+// 32 byte copy, and tracing can be left on permanently as a flight recorder.
+//
+// startTracing() and stopTracing() bracket a trace to serialize() as Chrome trace JSON, as before.  Every event in
+// between is kept, along with those of threads that exited meanwhile, until the next startTracing().
+// startRecording() keeps recording into the rings without an end, and dump() takes the last seconds of it in the
+// binary trace format, which toChromeTrace() converts to Chrome trace JSON later or elsewhere.  A dump only holds the
+// events still in the rings, the oldest events of a busy thread are overwritten once its ring is full, and only the
+// rings of the last few threads to exit are kept.
 class Tracer : public Dependency {
 public:
+    static const size_t DEFAULT_EVENTS_PER_THREAD = 16 * 1024;
+
     static int64_t now();
-    void traceEvent(const QLoggingCategory& category, 
+
+    void traceEvent(const QLoggingCategory& category,
         const QString& name, EventType type,
-        const QString& id = "", 
+        const QString& id = "",
         const QVariantMap& args = QVariantMap(), const QVariantMap& extra = QVariantMap());
 
-    void traceEvent(const QLoggingCategory& category, 
+    void traceEvent(const QLoggingCategory& category,
         const QString& name, EventType type,
         int64_t timestamp,
-        const QString& id = "", 
+        const QString& id = "",
         const QVariantMap& args = QVariantMap(), const QVariantMap& extra = QVariantMap());
 
+    // Records an event with at most one numeric argument, without any allocation once the thread and names are known
+    static void traceEvent(const QLoggingCategory& category, NameID name, EventType type, int64_t timestamp,
+        NameID argument = TRACE_NAME_NONE, double value = 0.0);
+
     void startTracing();
     void stopTracing();
     void serialize(const QString& file);
-    bool isEnabled() const { return _enabled; }
+
+    void startRecording();
+    void stopRecording();
+    bool isRecording() const { return _recording; }
+
+    // Rings are sized when a thread records its first event, so this only affects threads that haven't yet
+    void setEventsPerThread(size_t eventsPerThread);
+
+    bool isEnabled() const { return _enabled || _recording; }
+
+    /// \return the events recorded since the given timestamp in the binary trace format
+    QByteArray dump(int64_t since, int64_t until = std::numeric_limits<int64_t>::max()) const;
+    /// \return the binary trace converted to Chrome trace JSON, or an empty array if it isn't a valid binary trace
+    static QByteArray toChromeTrace(const QByteArray& dump);
 
 private:
-    void traceEvent(const QLoggingCategory& category, 
-        const QString& name, EventType type,
-        qint64 timestamp, qint64 processID, qint64 threadID,
-        const QString& id = "",
-        const QVariantMap& args = QVariantMap(), const QVariantMap& extra = QVariantMap());
+    void updateEnabled();
 
-    bool _enabled { false };
-    std::list<TraceEvent> _events;
-    std::list<TraceEvent> _metadataEvents;
-    std::mutex _eventsMutex;
+    std::atomic<bool> _enabled { false };
+    std::atomic<bool> _recording { false };
+    int64_t _traceStart { 0 };
+    int64_t _traceEnd { 0 };
+    std::mutex _mutex;
 };
 
 inline void traceEvent(const QLoggingCategory& category, int64_t timestamp, const QString& name, EventType type, const QString& id = "", const QVariantMap& args = {}, const QVariantMap& extra = {}) {
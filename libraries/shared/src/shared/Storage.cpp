@@ -8,10 +8,17 @@
 
 #include "Storage.h"
 
+#include <algorithm>
+
 #include <QtCore/QFileInfo>
 #include <QtCore/QDebug>
 #include "StorageLogging.h"
 
+#if defined(Q_OS_UNIX)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 Q_LOGGING_CATEGORY(storagelogging, "hifi.core.storage")
 
 using namespace storage;
@@ -103,3 +110,46 @@ FileStorage::~FileStorage() {
         _file.close();
     }
 }
+
+#if defined(Q_OS_UNIX)
+static uintptr_t getPageSize() {
+    static const uintptr_t pageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+    return pageSize;
+}
+#endif
+
+void FileStorage::adviseRandomAccess() const {
+#if defined(Q_OS_UNIX)
+    if (_mapped && _fallback.isEmpty() && _size > 0) {
+        madvise(_mapped, _size, MADV_RANDOM);
+    }
+#endif
+}
+
+void FileStorage::pageIn(size_t offset, size_t size) const {
+    if (!_mapped || offset >= _size) {
+        return;
+    }
+    size = std::min(size, _size - offset);
+    if (size == 0 || !_fallback.isEmpty()) {
+        return;
+    }
+
+    const uint8_t* begin = _mapped + offset;
+    const uint8_t* end = begin + size;
+    uintptr_t pageSize = 4096;
+#if defined(Q_OS_UNIX)
+    pageSize = getPageSize();
+    // The kernel reads the whole range in one go, rather than a page per fault below
+    uintptr_t alignedBegin = (uintptr_t)begin & ~(pageSize - 1);
+    madvise((void*)alignedBegin, (uintptr_t)end - alignedBegin, MADV_WILLNEED);
+#endif
+
+    // Touch every page so that the range is resident by the time we return
+    volatile uint8_t sink = 0;
+    for (const uint8_t* page = begin; page < end; page += pageSize) {
+        sink += *page;
+    }
+    sink += *(end - 1);
+    (void)sink;
+}
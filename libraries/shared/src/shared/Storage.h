@@ -16,6 +16,7 @@
 #include <functional>
 #include <stdexcept>
 
+#include <QtCore/QByteArray>
 #include <QtCore/QFile>
 #include <QtCore/QString>
 
@@ -71,6 +72,12 @@ namespace storage {
         uint8_t* mutableData() override { return _hasWriteAccess ? _mapped : nullptr; }
         size_t size() const override { return _size; }
         operator bool() const override { return _valid; }
+
+        // Paging hints for the mapping.  A mapped file is only read from disk as its pages are touched, so callers
+        // that read a few parts of a large file can turn off read-ahead and then page in just the parts they use.
+        void adviseRandomAccess() const;
+        // Brings the given range into memory, so that later reads of it don't block on the disk
+        void pageIn(size_t offset, size_t size) const;
     private:
         // For compressed QRC files we can't map the file object, so we need to read it into memory
         QByteArray _fallback;
@@ -81,6 +88,17 @@ namespace storage {
         uint8_t* _mapped { nullptr };
     };
 
+    // Shares the data of a QByteArray (e.g. a network reply) instead of copying it
+    class ByteArrayStorage : public Storage {
+    public:
+        ByteArrayStorage(const QByteArray& data) : _data(data) {}
+        const uint8_t* data() const override { return reinterpret_cast<const uint8_t*>(_data.constData()); }
+        uint8_t* mutableData() override { throw std::runtime_error("Cannot modify ByteArrayStorage"); }
+        size_t size() const override { return (size_t)_data.size(); }
+    private:
+        const QByteArray _data;
+    };
+
     class ViewStorage : public Storage {
     public:
         ViewStorage(const storage::StoragePointer& owner, size_t size, const uint8_t* data);
@@ -256,6 +256,19 @@ signals:
     void dirtyEnabled();
 };
 
+// The config of a Parallel job; turning parallel off runs its children one after the other on the calling thread,
+// which is handy to compare the timings or to rule out a threading issue
+class ParallelConfig : public JobConfig {
+    Q_OBJECT
+    Q_PROPERTY(bool parallel MEMBER parallel NOTIFY dirty)
+
+public:
+    bool parallel { true };
+
+signals:
+    void dirty();
+};
+
 using QConfigPointer = std::shared_ptr<JobConfig>;
 
 }
@@ -10,6 +10,8 @@
 //
 #include "Task.h"
 
+#include <TBBHelpers.h>
+
 using namespace task;
 
 JobContext::JobContext() {
@@ -29,3 +31,12 @@ void TaskFlow::abortTask() {
 bool TaskFlow::doAbortTask() const {
     return _doAbortTask;
 }
+
+void task::parallelFor(size_t count, const std::function<void(size_t)>& func) {
+    // One child per grain: the children of a Parallel are few and each of them is a sizeable piece of work
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, count, 1), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i != range.end(); ++i) {
+            func(i);
+        }
+    });
+}
@@ -17,6 +17,7 @@
 #include "Config.h"
 #include "Varying.h"
 
+#include <functional>
 #include <unordered_map>
 
 namespace task {
@@ -499,6 +500,125 @@ public:
     }
 };
 
+// Runs func(0) ... func(count - 1) concurrently on the worker threads and returns once they are all done
+void parallelFor(size_t count, const std::function<void(size_t)>& func);
+
+// A Parallel job runs its children concurrently, each on its own fork of the job context.
+// ParallelContext<JC> is the customization point describing how a context type is forked and joined back:
+// - fork() is called on the calling thread, in job order, before any child runs
+// - run() is called on the worker thread that runs the child
+// - join() is called on the calling thread, in job order, once all the children are done
+// By default a fork is a copy of the context and nothing is joined back.
+template <class JC>
+class ParallelContext {
+public:
+    using ContextPointer = std::shared_ptr<JC>;
+
+    static ContextPointer fork(const ContextPointer& jobContext) { return std::make_shared<JC>(*jobContext); }
+    template <class J> static void run(J& job, const ContextPointer& forkContext) { job.run(forkContext); }
+    static void join(const ContextPointer& jobContext, const ContextPointer& forkContext) {}
+};
+
+// A Parallel is a specialized task whose children are independent of each other and can run at the same time.
+// It can be created on any type T by aliasing the type JobModel in the class T
+// using JobModel = Parallel::Model<T>
+// The class T is expected to have a "build" method acting as a constructor, just like for a Task.
+// The children must not consume each other's outputs, and they must not abort the task flow;
+// an abort requested by any of them is forwarded to the parent task after the join.
+// Each child still runs through Job::run so its cpuRunTime is reported as usual.
+template <class JC, class TP>
+class Parallel : public Task<JC, TP> {
+public:
+    using Context = JC;
+    using TimeProfiler = TP;
+    using ContextPointer = std::shared_ptr<Context>;
+    using Config = ParallelConfig;
+    using TaskType = Task<JC, TP>;
+    using JobType = typename TaskType::JobType;
+    using None = typename TaskType::None;
+    using ConceptPointer = typename TaskType::ConceptPointer;
+    using TaskConcept = typename TaskType::TaskConcept;
+
+    Parallel(ConceptPointer conceptPtr) : TaskType(conceptPtr) {}
+
+    template <class T, class C = Config, class I = None, class O = None> class ParallelModel : public TaskConcept {
+    public:
+        using Data = T;
+        using Input = I;
+        using Output = O;
+
+        Data _data;
+
+        ParallelModel(const std::string& name, const Varying& input, QConfigPointer config) :
+            TaskConcept(name, input, config),
+            _data(Data()) {}
+
+        template <class... A>
+        static std::shared_ptr<ParallelModel> create(const std::string& name, const Varying& input, A&&... args) {
+            auto model = std::make_shared<ParallelModel>(name, input, std::make_shared<C>());
+
+            {
+                TimeProfiler probe("build::" + model->getName());
+                model->_data.build(*(model), model->_input, model->_output, std::forward<A>(args)...);
+            }
+
+            return model;
+        }
+
+        template <class... A>
+        static std::shared_ptr<ParallelModel> create(const std::string& name, A&&... args) {
+            const auto input = Varying(Input());
+            return create(name, input, std::forward<A>(args)...);
+        }
+
+        void applyConfiguration() override {
+            TimeProfiler probe("configure::" + JobConcept::getName());
+            jobConfigure(_data, *std::static_pointer_cast<C>(JobConcept::_config));
+            for (auto& job : TaskConcept::_jobs) {
+                job.applyConfiguration();
+            }
+        }
+
+        void run(const ContextPointer& jobContext) override {
+            auto config = std::static_pointer_cast<C>(JobConcept::_config);
+            if (!config->isEnabled()) {
+                return;
+            }
+            auto& jobs = TaskConcept::_jobs;
+            if (!config->parallel || jobs.size() < 2) {
+                for (auto& job : jobs) {
+                    job.run(jobContext);
+                }
+                return;
+            }
+
+            std::vector<ContextPointer> forkContexts;
+            forkContexts.reserve(jobs.size());
+            for (size_t i = 0; i < jobs.size(); ++i) {
+                forkContexts.push_back(ParallelContext<JC>::fork(jobContext));
+            }
+
+            parallelFor(jobs.size(), [&](size_t i) {
+                ParallelContext<JC>::run(jobs[i], forkContexts[i]);
+            });
+
+            // Join in job order so whatever the children produced lands in the same order as a sequential run
+            bool doAbortTask = false;
+            for (size_t i = 0; i < jobs.size(); ++i) {
+                ParallelContext<JC>::join(jobContext, forkContexts[i]);
+                doAbortTask = doAbortTask || forkContexts[i]->taskFlow.doAbortTask();
+            }
+            if (doAbortTask) {
+                jobContext->taskFlow.abortTask();
+            }
+        }
+    };
+    template <class T, class C = Config> using Model = ParallelModel<T, C, None, None>;
+    template <class T, class I, class C = Config> using ModelI = ParallelModel<T, C, I, None>;
+    template <class T, class O, class C = Config> using ModelO = ParallelModel<T, C, None, O>;
+    template <class T, class I, class O, class C = Config> using ModelIO = ParallelModel<T, C, I, O>;
+};
+
 template <class JC, class TP>
 class Engine : public Task<JC, TP> {
 public:
@@ -535,9 +655,11 @@ protected:
     using JobConfig = task::JobConfig; \
     using TaskConfig = task::JobConfig; \
     using SwitchConfig = task::JobConfig; \
+    using ParallelConfig = task::ParallelConfig; \
     template <class T> using PersistentConfig = task::PersistentConfig<T>; \
     using Job = task::Job<ContextType, TimeProfiler>; \
     using Switch = task::Switch<ContextType, TimeProfiler>; \
+    using Parallel = task::Parallel<ContextType, TimeProfiler>; \
     using Task = task::Task<ContextType, TimeProfiler>; \
     using Engine = task::Engine<ContextType, TimeProfiler>; \
     using Varying = task::Varying; \
@@ -0,0 +1,23 @@
+//
+//  AllocationCounter.h
+//  libraries/test-utils/src/test-utils
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_test_utils_AllocationCounter_h
+#define hifi_test_utils_AllocationCounter_h
+
+#include <cstdint>
+
+// Implemented by the allocation-counter object library, which also replaces the global operator new and delete with
+// versions that count every allocation.  Only executables that link allocation-counter get the replacements, linking
+// test-utils alone doesn't.  On Windows only the allocations made by the executable's own code are counted, elsewhere
+// it covers the whole process.
+uint64_t getAllocationCount();
+
+#endif // hifi_test_utils_AllocationCounter_h
@@ -15,11 +15,18 @@
 #include "Space.h"
 #include <cstring>
 #include <algorithm>
+#include <bit>
 
 #include <glm/gtx/quaternion.hpp>
 
+#include <TBBHelpers.h>
+
 using namespace workload;
 
+const uint32_t BITS_PER_WORD = 64;
+const uint32_t CATEGORIZE_GRAIN_WORDS = 64; // 4096 proxies per task
+const uint32_t CATEGORIZE_BATCH_SIZE = 256; // proxies classified at once from the stack
+
 Space::Space() : Collection() {
 }
 
@@ -28,9 +35,8 @@ void Space::processTransactionFrame(const Transaction& transaction) {
     // Here we should be able to check the value of last ProxyID allocated
     // and allocate new proxies accordingly
     ProxyID maxID = _IDAllocator.getNumAllocatedIndices();
-    if (maxID > (Index) _proxies.size()) {
-        _proxies.resize(maxID + 100); // allocate the maxId and more
-        _owners.resize(maxID + 100);
+    if (maxID > (Index)_regions.size()) {
+        resizeProxies(maxID + 100); // allocate the maxId and more
     }
     // Now we know for sure that we have enough items in the array to
     // capture anything coming from the transaction
@@ -49,11 +55,9 @@ void Space::processResets(const Transaction::Resets& transactions) {
         if (!_IDAllocator.checkIndex(proxyID)) {
             continue;
         }
-        auto& item = _proxies[proxyID];
-
         // Reset the item with a new payload
-        item.sphere = (std::get<1>(reset));
-        item.prevRegion = item.region = Region::UNKNOWN;
+        setSphere(proxyID, std::get<1>(reset));
+        _prevRegions[proxyID] = _regions[proxyID] = Region::UNKNOWN;
 
         _owners[proxyID] = (std::get<2>(reset));
     }
@@ -66,11 +70,8 @@ void Space::processRemoves(const Transaction::Removes& transactions) {
         }
         _IDAllocator.freeIndex(removedID);
 
-        // Access the true item
-        auto& item = _proxies[removedID];
-
         // Kill it
-        item.prevRegion = item.region = Region::INVALID;
+        _prevRegions[removedID] = _regions[removedID] = Region::INVALID;
         _owners[removedID] = Owner();
     }
 }
@@ -82,39 +83,98 @@ void Space::processUpdates(const Transaction::Updates& transactions) {
             continue;
         }
 
-        // Access the true item
-        auto& item = _proxies[updateID];
-
         // Update the item
-        item.sphere = (std::get<1>(update));
+        setSphere(updateID, std::get<1>(update));
     }
 }
 
+void Space::resizeProxies(uint32_t numProxies) {
+    _centersX.resize(numProxies, 0.0f);
+    _centersY.resize(numProxies, 0.0f);
+    _centersZ.resize(numProxies, 0.0f);
+    _radii.resize(numProxies, 0.0f);
+    _regions.resize(numProxies, Region::INVALID);
+    _prevRegions.resize(numProxies, Region::INVALID);
+    _owners.resize(numProxies);
+}
+
+void Space::setSphere(ProxyID id, const Sphere& sphere) {
+    _centersX[id] = sphere.x;
+    _centersY[id] = sphere.y;
+    _centersZ[id] = sphere.z;
+    _radii[id] = sphere.w;
+}
+
+Proxy Space::getProxy(ProxyID id) const {
+    Proxy proxy(Sphere(_centersX[id], _centersY[id], _centersZ[id], _radii[id]));
+    proxy.region = _regions[id];
+    proxy.prevRegion = _prevRegions[id];
+    return proxy;
+}
+
 void Space::categorizeAndGetChanges(std::vector<Space::Change>& changes) {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    uint32_t numProxies = (uint32_t)_proxies.size();
-    uint32_t numViews = (uint32_t)_views.size();
-    for (uint32_t i = 0; i < numProxies; ++i) {
-        Proxy& proxy = _proxies[i];
-        if (proxy.region < Region::INVALID) {
-            glm::vec3 proxyCenter = glm::vec3(proxy.sphere);
-            float proxyRadius = proxy.sphere.w;
-            uint8_t region = Region::R4;
-            for (uint32_t j = 0; j < numViews; ++j) {
-                auto& view = _views[j];
-                // for each 'view' we need only increment 'k' below the current value of 'region'
-                for (uint8_t k = 0; k < region; ++k) {
-                    float touchDistance = proxyRadius + view.regions[k].w;
-                    if (distance2(proxyCenter, glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
-                        region = k;
-                        break;
-                    }
-                }
+    uint32_t numProxies = (uint32_t)_regions.size();
+    uint32_t numWords = (numProxies + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    _changedBits.assign(numWords, 0);
+
+    // a proxy's region is the innermost one it touches in any view, so the views can be flattened into one list
+    std::vector<Sphere> regionSpheres;
+    regionSpheres.reserve(_views.size() * Region::NUM_TRACKED_REGIONS);
+    for (const auto& view : _views) {
+        regionSpheres.insert(regionSpheres.end(), view.regions, view.regions + Region::NUM_TRACKED_REGIONS);
+    }
+
+    // each task covers whole words of _changedBits so no two tasks ever write the same word
+    tbb::parallel_for(tbb::blocked_range<uint32_t>(0, numWords, CATEGORIZE_GRAIN_WORDS),
+        [&](const tbb::blocked_range<uint32_t>& range) {
+            categorizeRange(range.begin() * BITS_PER_WORD, std::min(range.end() * BITS_PER_WORD, numProxies), regionSpheres);
+        });
+
+    for (uint32_t w = 0; w < numWords; ++w) {
+        uint64_t bits = _changedBits[w];
+        while (bits) {
+            uint32_t i = w * BITS_PER_WORD + (uint32_t)std::countr_zero(bits);
+            changes.emplace_back(Space::Change((int32_t)i, _regions[i], _prevRegions[i]));
+            bits &= bits - 1;
+        }
+    }
+}
+
+void Space::categorizeRange(uint32_t begin, uint32_t end, const std::vector<Sphere>& regionSpheres) {
+    uint32_t numRegionSpheres = (uint32_t)regionSpheres.size();
+    uint8_t newRegions[CATEGORIZE_BATCH_SIZE];
+    for (uint32_t batchBegin = begin; batchBegin < end; batchBegin += CATEGORIZE_BATCH_SIZE) {
+        uint32_t batchSize = std::min(CATEGORIZE_BATCH_SIZE, end - batchBegin);
+        const float* centersX = _centersX.data() + batchBegin;
+        const float* centersY = _centersY.data() + batchBegin;
+        const float* centersZ = _centersZ.data() + batchBegin;
+        const float* radii = _radii.data() + batchBegin;
+
+        std::fill(newRegions, newRegions + batchSize, (uint8_t)Region::R4);
+        for (uint32_t j = 0; j < numRegionSpheres; ++j) {
+            const Sphere& regionSphere = regionSpheres[j];
+            uint8_t region = (uint8_t)(j % Region::NUM_TRACKED_REGIONS);
+            // NOTE: keep this loop free of branches so that the compiler vectorizes it
+            for (uint32_t i = 0; i < batchSize; ++i) {
+                float dx = centersX[i] - regionSphere.x;
+                float dy = centersY[i] - regionSphere.y;
+                float dz = centersZ[i] - regionSphere.z;
+                float touchDistance = radii[i] + regionSphere.w;
+                bool touches = (dx * dx + dy * dy + dz * dz) < touchDistance * touchDistance;
+                newRegions[i] = (touches && region < newRegions[i]) ? region : newRegions[i];
             }
-            proxy.prevRegion = proxy.region;
-            proxy.region = region;
-            if (proxy.region != proxy.prevRegion) {
-                changes.emplace_back(Space::Change((int32_t)i, proxy.region, proxy.prevRegion));
+        }
+
+        for (uint32_t i = 0; i < batchSize; ++i) {
+            uint32_t index = batchBegin + i;
+            uint8_t prevRegion = _regions[index];
+            if (prevRegion < Region::INVALID) {
+                _prevRegions[index] = prevRegion;
+                _regions[index] = newRegions[i];
+                if (newRegions[i] != prevRegion) {
+                    _changedBits[index / BITS_PER_WORD] |= (uint64_t)1 << (index % BITS_PER_WORD);
+                }
             }
         }
     }
@@ -122,9 +182,9 @@ void Space::categorizeAndGetChanges(std::vector<Space::Change>& changes) {
 
 uint32_t Space::copyProxyValues(Proxy* proxies, uint32_t numDestProxies) const {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    auto numCopied = std::min(numDestProxies, (uint32_t)_proxies.size());
-    for(unsigned int i=0;i<numCopied;i++) {
-        proxies[i] = _proxies[i];
+    auto numCopied = std::min(numDestProxies, (uint32_t)_regions.size());
+    for (uint32_t i = 0; i < numCopied; ++i) {
+        proxies[i] = getProxy(i);
     }
     return numCopied;
 }
@@ -133,8 +193,8 @@ uint32_t Space::copySelectedProxyValues(Proxy::Vector& proxies, const workload::
     std::unique_lock<std::mutex> lock(_proxiesMutex);
     uint32_t numCopied = 0;
     for (auto index : indices) {
-        if (isAllocatedID(index) && (index < (Index)_proxies.size())) {
-            proxies.push_back(_proxies[index]);
+        if (isAllocatedID(index) && (index < (Index)_regions.size())) {
+            proxies.push_back(getProxy(index));
             ++numCopied;
         }
     }
@@ -143,7 +203,7 @@ uint32_t Space::copySelectedProxyValues(Proxy::Vector& proxies, const workload::
 
 const Owner Space::getOwner(int32_t proxyID) const {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    if (isAllocatedID(proxyID) && (proxyID < (Index)_proxies.size())) {
+    if (isAllocatedID(proxyID) && (proxyID < (Index)_owners.size())) {
         return _owners[proxyID];
     }
     return Owner();
@@ -151,8 +211,8 @@ const Owner Space::getOwner(int32_t proxyID) const {
 
 uint8_t Space::getRegion(int32_t proxyID) const {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    if (isAllocatedID(proxyID) && (proxyID < (Index)_proxies.size())) {
-        return _proxies[proxyID].region;
+    if (isAllocatedID(proxyID) && (proxyID < (Index)_regions.size())) {
+        return _regions[proxyID];
     }
     return (uint8_t)Region::INVALID;
 }
@@ -161,8 +221,8 @@ void Space::clear() {
     Collection::clear();
     std::unique_lock<std::mutex> lock(_proxiesMutex);
     _IDAllocator.clear();
-    _proxies.clear();
-    _owners.clear();
+    resizeProxies(0);
+    _changedBits.clear();
     _views.clear();
 }
 
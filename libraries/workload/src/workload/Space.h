@@ -45,6 +45,8 @@ public:
     uint32_t getNumObjects() const { return _IDAllocator.getNumLiveIndices(); }
     uint32_t getNumAllocatedProxies() const { return (uint32_t)(_IDAllocator.getNumAllocatedIndices()); }
 
+    // Classifies every proxy against the views, in parallel, and appends the proxies whose region changed
+    // to changes in ascending proxyId order.
     void categorizeAndGetChanges(std::vector<Change>& changes);
     uint32_t copyProxyValues(Proxy* proxies, uint32_t numDestProxies) const;
     uint32_t copySelectedProxyValues(Proxy::Vector& proxies, const workload::indexed_container::Indices& indices) const;
@@ -60,11 +62,25 @@ private:
     void processRemoves(const Transaction::Removes& transactions);
     void processUpdates(const Transaction::Updates& transactions);
 
-    // The database of proxies is protected for editing by a mutex
+    void resizeProxies(uint32_t numProxies);
+    void setSphere(ProxyID id, const Sphere& sphere);
+    Proxy getProxy(ProxyID id) const;
+    void categorizeRange(uint32_t begin, uint32_t end, const std::vector<Sphere>& regionSpheres);
+
+    // The database of proxies is protected for editing by a mutex.
+    // Proxies are stored as parallel arrays so that categorization streams through only the data it needs.
     mutable std::mutex _proxiesMutex;
-    Proxy::Vector _proxies;
+    std::vector<float> _centersX;
+    std::vector<float> _centersY;
+    std::vector<float> _centersZ;
+    std::vector<float> _radii;
+    std::vector<uint8_t> _regions;
+    std::vector<uint8_t> _prevRegions;
     std::vector<Owner> _owners;
 
+    // one bit per proxy, set when categorizeAndGetChanges() changes its region
+    std::vector<uint64_t> _changedBits;
+
     Views _views;
 };
 
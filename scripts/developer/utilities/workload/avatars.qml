@@ -71,6 +71,25 @@ Item {
                 }
             ]
         }
+        PlotPerf {
+            title: "Animation LOD"
+            height: parent.evalEvenHeight()
+            object: Stats
+            valueScale: 1
+            valueUnit: "num"
+            plots: [
+                {
+                    prop: "mediumAnimationLODAvatarCount",
+                    label: "medium",
+                    color: "#FFFF00"
+                },
+                {
+                    prop: "lowAnimationLODAvatarCount",
+                    label: "low",
+                    color: "#FF6600"
+                }
+            ]
+        }
         Separator {
             id: bottomLine
         }
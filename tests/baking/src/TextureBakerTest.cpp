@@ -0,0 +1,142 @@
+//
+//  TextureBakerTest.cpp
+//  tests/baking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "TextureBakerTest.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <QtCore/QFileInfo>
+#include <QtCore/QTemporaryDir>
+#include <QtGui/QImage>
+
+#include <TextureBaker.h>
+#include <TextureMeta.h>
+
+QTEST_GUILESS_MAIN(TextureBakerTest)
+
+static QByteArray readFile(const QString& path) {
+    QFile file(path);
+    return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+}
+
+static bool saveSourceImage(const QString& path) {
+    QImage image(64, 64, QImage::Format_RGB32);
+    for (int y = 0; y < image.height(); y++) {
+        for (int x = 0; x < image.width(); x++) {
+            image.setPixel(x, y, qRgb(x * 4, y * 4, 128));
+        }
+    }
+    return image.save(path);
+}
+
+void TextureBakerTest::testBakeCache() {
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    QString sourcePath = tempDir.filePath("source.png");
+    QVERIFY(saveSourceImage(sourcePath));
+
+    QDir firstOutput(tempDir.filePath("first"));
+    QDir secondOutput(tempDir.filePath("second"));
+    QVERIFY(firstOutput.mkpath("."));
+    QVERIFY(secondOutput.mkpath("."));
+
+    // The second bake of the same texture is written out from the first one's results, under its own name
+    TextureBaker::setBakeCacheSize(64 * 1024 * 1024);
+    TextureBaker first(QUrl::fromLocalFile(sourcePath), image::TextureUsage::ALBEDO_TEXTURE, firstOutput, "first");
+    first.bake();
+    TextureBaker second(QUrl::fromLocalFile(sourcePath), image::TextureUsage::ALBEDO_TEXTURE, secondOutput, "second");
+    second.bake();
+    TextureBaker::setBakeCacheSize(0);
+
+    QVERIFY(first.isFinished() && !first.hasErrors());
+    QVERIFY(second.isFinished() && !second.hasErrors());
+    QCOMPARE(second.getOutputFiles().size(), first.getOutputFiles().size());
+
+    TextureMeta firstMeta;
+    TextureMeta secondMeta;
+    QVERIFY(TextureMeta::deserialize(readFile(first.getMetaTextureFileName()), &firstMeta));
+    QVERIFY(TextureMeta::deserialize(readFile(second.getMetaTextureFileName()), &secondMeta));
+    QCOMPARE(secondMeta.availableTextureTypes.size(), firstMeta.availableTextureTypes.size());
+    for (const auto& firstTexture : firstMeta.availableTextureTypes) {
+        auto it = secondMeta.availableTextureTypes.find(firstTexture.first);
+        QVERIFY(it != secondMeta.availableTextureTypes.end());
+        QVERIFY(it->second.toString().startsWith("second"));
+        QCOMPARE(readFile(secondOutput.absoluteFilePath(it->second.toString())),
+                 readFile(firstOutput.absoluteFilePath(firstTexture.second.toString())));
+    }
+}
+
+void TextureBakerTest::testConcurrentBakeCache_data() {
+    QTest::addColumn<int>("cacheSize");
+
+    QTest::newRow("kept") << 64 * 1024 * 1024;
+    // every bake is evicted as soon as it's finished, while the other bakers may still be waiting on it
+    QTest::newRow("evicted") << 1;
+}
+
+void TextureBakerTest::testConcurrentBakeCache() {
+    QFETCH(int, cacheSize);
+
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+    QString sourcePath = tempDir.filePath("source.png");
+    QVERIFY(saveSourceImage(sourcePath));
+
+    // Several assets sharing a texture are baked at once, then once more after the first round is over
+    const int NUM_BAKERS = 4;
+    const int NUM_ROUNDS = 2;
+    for (int i = 0; i < NUM_BAKERS * NUM_ROUNDS; i++) {
+        QVERIFY(QDir(tempDir.filePath(QString("baker%1").arg(i))).mkpath("."));
+    }
+
+    TextureBaker::setBakeCacheSize(cacheSize);
+    std::vector<std::unique_ptr<TextureBaker>> bakers(NUM_BAKERS * NUM_ROUNDS);
+    QThread* testThread = QThread::currentThread();
+    for (int round = 0; round < NUM_ROUNDS; round++) {
+        std::vector<std::thread> threads;
+        for (int i = round * NUM_BAKERS; i < (round + 1) * NUM_BAKERS; i++) {
+            QString name = QString("baker%1").arg(i);
+            QDir output(tempDir.filePath(name));
+            // The baker is created on the thread that bakes it, so its signals are delivered directly
+            auto& baker = bakers[i];
+            threads.emplace_back([&baker, sourcePath, output, name, testThread] {
+                baker = std::make_unique<TextureBaker>(QUrl::fromLocalFile(sourcePath), image::TextureUsage::ALBEDO_TEXTURE,
+                                                       output, name);
+                baker->bake();
+                baker->moveToThread(testThread);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    TextureBaker::setBakeCacheSize(0);
+
+    const TextureBaker& reference = *bakers.front();
+    QVERIFY(reference.isFinished() && !reference.hasErrors());
+    TextureMeta referenceMeta;
+    QVERIFY(TextureMeta::deserialize(readFile(reference.getMetaTextureFileName()), &referenceMeta));
+    for (const auto& baker : bakers) {
+        QVERIFY(baker->isFinished() && !baker->hasErrors());
+        TextureMeta meta;
+        QVERIFY(TextureMeta::deserialize(readFile(baker->getMetaTextureFileName()), &meta));
+        QCOMPARE(meta.availableTextureTypes.size(), referenceMeta.availableTextureTypes.size());
+        for (const auto& referenceTexture : referenceMeta.availableTextureTypes) {
+            auto it = meta.availableTextureTypes.find(referenceTexture.first);
+            QVERIFY(it != meta.availableTextureTypes.end());
+            QCOMPARE(readFile(QFileInfo(baker->getMetaTextureFileName()).dir().absoluteFilePath(it->second.toString())),
+                     readFile(QFileInfo(reference.getMetaTextureFileName()).dir().absoluteFilePath(referenceTexture.second.toString())));
+        }
+    }
+}
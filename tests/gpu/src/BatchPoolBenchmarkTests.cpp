@@ -0,0 +1,139 @@
+//
+//  BatchPoolBenchmarkTests.cpp
+//  tests/gpu/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "BatchPoolBenchmarkTests.h"
+
+#include <array>
+#include <vector>
+
+#include <QElapsedTimer>
+
+#include <gpu/Batch.h>
+#include <gpu/Context.h>
+#include <test-utils/AllocationCounter.h>
+
+QTEST_MAIN(BatchPoolBenchmarkTests)
+
+// A batch mix shaped like a RenderDeferredTask frame: a few large item batches (opaques, shadows, transparents)
+// and a tail of small full screen passes
+const int NUM_FRAMES = 30;
+const int NUM_ITEM_BATCHES = 6;
+const int NUM_ITEMS_PER_BATCH = 2000;
+const int NUM_PASS_BATCHES = 40;
+const int NUM_TEXTURES_PER_ITEM = 3;
+
+class BatchMix {
+public:
+    BatchMix() {
+        _format = std::make_shared<gpu::Stream::Format>();
+        for (auto& buffer : _buffers) {
+            buffer = std::make_shared<gpu::Buffer>();
+        }
+    }
+
+    void recordItems(gpu::Batch& batch) {
+        batch.setViewportTransform(glm::ivec4(0, 0, 1920, 1080));
+        batch.setProjectionTransform(glm::mat4());
+        batch.setViewTransform(Transform());
+        batch.setPipeline(_pipeline);
+        for (int i = 0; i < NUM_ITEMS_PER_BATCH; ++i) {
+            const auto& buffer = _buffers[i % _buffers.size()];
+            batch.setModelTransform(Transform(glm::quat(), glm::vec3(1.0f), glm::vec3((float)i)));
+            batch.setInputFormat(_format);
+            batch.setInputBuffer(0, buffer, 0, 12);
+            batch.setIndexBuffer(gpu::UINT32, buffer, 0);
+            batch.setUniformBuffer(0, buffer, 0, 64);
+            for (int t = 0; t < NUM_TEXTURES_PER_ITEM; ++t) {
+                batch.setResourceTexture(t, _texture);
+            }
+            batch.drawIndexed(gpu::TRIANGLES, 300, 0);
+        }
+    }
+
+    void recordPass(gpu::Batch& batch) {
+        batch.enableStereo(false);
+        batch.setViewportTransform(glm::ivec4(0, 0, 1920, 1080));
+        batch.setPipeline(_pipeline);
+        batch.setUniformBuffer(0, _buffers[0], 0, 64);
+        batch.setResourceTexture(0, _texture);
+        batch.draw(gpu::TRIANGLE_STRIP, 4);
+    }
+
+    // Records one frame of batches into the given vector, then drops them all
+    template <typename F>
+    void recordFrame(std::vector<gpu::BatchPointer>& batches, F acquire) {
+        for (int i = 0; i < NUM_ITEM_BATCHES; ++i) {
+            batches.push_back(acquire("RenderDeferredTask::drawItems"));
+            recordItems(*batches.back());
+        }
+        for (int i = 0; i < NUM_PASS_BATCHES; ++i) {
+            batches.push_back(acquire("RenderDeferredTask::pass"));
+            recordPass(*batches.back());
+        }
+        batches.clear();
+    }
+
+private:
+    gpu::Stream::FormatPointer _format;
+    std::array<gpu::BufferPointer, 16> _buffers;
+    gpu::PipelinePointer _pipeline;
+    gpu::TexturePointer _texture;
+};
+
+static gpu::BatchPointer acquirePooled(const char* name) {
+    return gpu::Context::acquireBatch(name);
+}
+
+static gpu::BatchPointer acquireFresh(const char* name) {
+    return std::make_shared<gpu::Batch>(name);
+}
+
+void BatchPoolBenchmarkTests::testPooledRecordingDoesNotAllocate() {
+    BatchMix mix;
+    std::vector<gpu::BatchPointer> batches;
+    batches.reserve(NUM_ITEM_BATCHES + NUM_PASS_BATCHES);
+
+    // the first frames fill the pool and grow the batches to the mix's high water marks
+    mix.recordFrame(batches, acquirePooled);
+    mix.recordFrame(batches, acquirePooled);
+
+    uint64_t allocationsBefore = getAllocationCount();
+    mix.recordFrame(batches, acquirePooled);
+    QCOMPARE(getAllocationCount() - allocationsBefore, (uint64_t)0);
+}
+
+void BatchPoolBenchmarkTests::benchmarkRecording_data() {
+    QTest::addColumn<bool>("pooled");
+    QTest::newRow("new batches") << false;
+    QTest::newRow("pooled batches") << true;
+}
+
+void BatchPoolBenchmarkTests::benchmarkRecording() {
+    QFETCH(bool, pooled);
+    BatchMix mix;
+    std::vector<gpu::BatchPointer> batches;
+    batches.reserve(NUM_ITEM_BATCHES + NUM_PASS_BATCHES);
+    auto acquire = pooled ? acquirePooled : acquireFresh;
+    mix.recordFrame(batches, acquire);
+
+    QElapsedTimer timer;
+    uint64_t allocationsBefore = 0;
+    QBENCHMARK_ONCE {
+        allocationsBefore = getAllocationCount();
+        timer.start();
+        for (int i = 0; i < NUM_FRAMES; ++i) {
+            mix.recordFrame(batches, acquire);
+        }
+    }
+    double msecPerFrame = (double)timer.nsecsElapsed() / (1.0e6 * NUM_FRAMES);
+    double allocationsPerFrame = (double)(getAllocationCount() - allocationsBefore) / NUM_FRAMES;
+    qInfo() << (pooled ? "pooled:" : "new:") << msecPerFrame << "msec/frame," << allocationsPerFrame << "allocations/frame";
+}
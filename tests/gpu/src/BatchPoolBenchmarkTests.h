@@ -0,0 +1,26 @@
+//
+//  BatchPoolBenchmarkTests.h
+//  tests/gpu/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_BatchPoolBenchmarkTests_h
+#define hifi_BatchPoolBenchmarkTests_h
+
+#include <QtTest/QtTest>
+
+class BatchPoolBenchmarkTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testPooledRecordingDoesNotAllocate();
+    void benchmarkRecording_data();
+    void benchmarkRecording();
+};
+
+#endif // hifi_BatchPoolBenchmarkTests_h
@@ -14,9 +14,12 @@
 
 #include <ktx/KTX.h>
 #include <gpu/Texture.h>
+#include <image/CubeMap.h>
 #include <image/Image.h>
 #include <image/TextureProcessing.h>
+#include <NumericalConstants.h>
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QImageReader>
 #include <QTextStream>
 
@@ -156,6 +159,101 @@ void KtxBenchmarks::benchmarkCreateTexture() {
     }
 }
 
+void KtxBenchmarks::benchmarkProcessTexture_data() {
+    QTest::addColumn<int>("usage");
+    QTest::addColumn<bool>("compress");
+
+    QTest::newRow("albedo") << (int)image::TextureUsage::ALBEDO_TEXTURE << true;
+    QTest::newRow("albedo uncompressed") << (int)image::TextureUsage::ALBEDO_TEXTURE << false;
+    QTest::newRow("normal") << (int)image::TextureUsage::NORMAL_TEXTURE << true;
+    QTest::newRow("bump") << (int)image::TextureUsage::BUMP_TEXTURE << true;
+    QTest::newRow("roughness") << (int)image::TextureUsage::ROUGHNESS_TEXTURE << true;
+    QTest::newRow("metallic") << (int)image::TextureUsage::METALLIC_TEXTURE << true;
+    QTest::newRow("occlusion") << (int)image::TextureUsage::OCCLUSION_TEXTURE << true;
+    QTest::newRow("emissive") << (int)image::TextureUsage::EMISSIVE_TEXTURE << true;
+}
+
+// Reports the throughput of each texture usage's processing, so changes to the kernels can be compared per type
+void KtxBenchmarks::benchmarkProcessTexture() {
+    QFETCH(int, usage);
+    QFETCH(bool, compress);
+
+    const QString TEST_IMAGE = getRootPath() + test_texture;
+    QImage sourceImage(TEST_IMAGE);
+    if (sourceImage.isNull()) {
+        QFAIL("Failed to load test image");
+    }
+    auto loader = image::TextureUsage::getTextureLoaderForType((image::TextureUsage::Type)usage);
+    std::atomic<bool> abortSignal { false };
+
+    QElapsedTimer timer;
+    int iterations = 0;
+    timer.start();
+    QBENCHMARK {
+        gpu::TexturePointer testTexture = loader(image::Image(sourceImage), TEST_IMAGE.toStdString(), compress,
+                                                 gpu::BackendTarget::GL45, abortSignal);
+        QVERIFY(testTexture);
+        ++iterations;
+    }
+    const double seconds = (double)timer.nsecsElapsed() / NSECS_PER_SECOND;
+    const double megapixels = (double)sourceImage.width() * sourceImage.height() * iterations / 1.0e6;
+    qInfo() << QTest::currentDataTag() << "throughput:" << megapixels / seconds << "MPixels/s";
+}
+
+// A sky gradient with a small, very bright sun, so the convolution sees the dynamic range of a real HDR skybox
+static std::vector<image::Image> createHDRSkyboxFaces(int size) {
+    const glm::vec3 SUN_DIRECTION = glm::normalize(glm::vec3(0.3f, 0.6f, -0.7f));
+    const glm::vec3 FACE_AXES[6][3] = {
+        // normal, u, v
+        { { 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, -1.0f }, { 0.0f, -1.0f, 0.0f } },
+        { { -1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, -1.0f, 0.0f } },
+        { { 0.0f, 1.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } },
+        { { 0.0f, -1.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, -1.0f } },
+        { { 0.0f, 0.0f, 1.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, -1.0f, 0.0f } },
+        { { 0.0f, 0.0f, -1.0f }, { -1.0f, 0.0f, 0.0f }, { 0.0f, -1.0f, 0.0f } },
+    };
+
+    std::vector<image::Image> faces;
+    for (int face = 0; face < 6; face++) {
+        image::Image faceImage(size, size, image::Image::Format_RGBAF);
+        for (int y = 0; y < size; y++) {
+            glm::vec4* pixels = reinterpret_cast<glm::vec4*>(faceImage.editScanLine(y));
+            for (int x = 0; x < size; x++) {
+                const float u = 2.0f * (x + 0.5f) / size - 1.0f;
+                const float v = 2.0f * (y + 0.5f) / size - 1.0f;
+                const glm::vec3 dir = glm::normalize(FACE_AXES[face][0] + FACE_AXES[face][1] * u + FACE_AXES[face][2] * v);
+                const glm::vec3 sky = glm::mix(glm::vec3(0.4f, 0.5f, 0.6f), glm::vec3(0.1f, 0.3f, 0.9f), std::max(dir.y, 0.0f));
+                const float sun = std::pow(std::max(glm::dot(dir, SUN_DIRECTION), 0.0f), 2000.0f) * 5000.0f;
+                pixels[x] = glm::vec4(sky + glm::vec3(sun), 1.0f);
+            }
+        }
+        faces.push_back(faceImage);
+    }
+    return faces;
+}
+
+void KtxBenchmarks::benchmarkConvolveCubeMap_data() {
+    QTest::addColumn<int>("size");
+
+    QTest::newRow("64") << 64;
+    QTest::newRow("128") << 128;
+    QTest::newRow("256") << 256;
+}
+
+// The ambient cubemap convolution of a skybox, which is what dominates loading skyboxes; the result is per cubemap
+void KtxBenchmarks::benchmarkConvolveCubeMap() {
+    QFETCH(int, size);
+
+    const int mipCount = (int)std::log2(size) + 1;
+    std::atomic<bool> abortSignal { false };
+    image::CubeMap source(createHDRSkyboxFaces(size), mipCount, abortSignal);
+
+    QBENCHMARK {
+        image::CubeMap output(size, size, mipCount);
+        source.convolveForGGX(output, abortSignal);
+    }
+}
+
 void KtxBenchmarks::benchmarkSerializeTexture() {
     const QString TEST_IMAGE = getRootPath() +  test_texture;
     gpu::TexturePointer testTexture = loadTexture(TEST_IMAGE);
@@ -209,3 +307,39 @@ void KtxBenchmarks::benchmarkWriteKTX() {
     }
 }
 
+// Reads every mip of a corpus of cached KTX files the way the texture residency manager does, lowest mip first
+void KtxBenchmarks::benchmarkReadKTXMips() {
+    QTemporaryDir cacheDir;
+    QVERIFY(cacheDir.isValid());
+
+    std::vector<std::string> ktxFiles;
+    for (const QString& filename : png_images) {
+        gpu::TexturePointer texture = loadTexture(getRootPath() + filename);
+        if (!texture) {
+            continue;
+        }
+        auto ktxMemory = gpu::Texture::serialize(*texture, glm::ivec2(texture->getWidth(), texture->getHeight()));
+        QVERIFY(ktxMemory.get());
+        std::string ktxFile = cacheDir.filePath(QString("%1.ktx").arg(ktxFiles.size())).toStdString();
+        ktxMemory->getStorage()->toFileStorage(ktxFile.c_str());
+        ktxFiles.push_back(ktxFile);
+    }
+    QVERIFY(!ktxFiles.empty());
+
+    QBENCHMARK {
+        size_t bytesRead = 0;
+        for (const auto& ktxFile : ktxFiles) {
+            auto texture = gpu::Texture::unserialize(ktxFile).first;
+            QVERIFY(texture);
+            for (int level = texture->getNumMips() - 1; level >= 0; --level) {
+                for (uint8_t face = 0; face < texture->getNumFaces(); ++face) {
+                    auto mip = texture->accessStoredMipFace((gpu::uint16)level, face);
+                    QVERIFY(mip);
+                    bytesRead += mip->size();
+                }
+            }
+        }
+        QVERIFY(bytesRead > 0);
+        gpu::Texture::KtxStorage::releaseOpenKtxFiles();
+    }
+}
@@ -19,8 +19,13 @@ private slots:
     void benchmarkJPG();
 
     void benchmarkCreateTexture();
+    void benchmarkProcessTexture_data();
+    void benchmarkProcessTexture();
+    void benchmarkConvolveCubeMap_data();
+    void benchmarkConvolveCubeMap();
     void benchmarkSerializeTexture();
     void benchmarkWriteKTX();
+    void benchmarkReadKTXMips();
 };
 
 
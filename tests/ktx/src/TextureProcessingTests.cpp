@@ -0,0 +1,215 @@
+//
+//  TextureProcessingTests.cpp
+//  tests/ktx/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "TextureProcessingTests.h"
+
+#include <algorithm>
+#include <random>
+
+#include <QtGui/QRgb>
+#include <QtTest/QtTest>
+
+#include <tbb/task_arena.h>
+
+#include <image/Image.h>
+#include <image/TextureProcessing.h>
+
+QTEST_GUILESS_MAIN(TextureProcessingTests)
+
+static image::Image makeNoiseImage(int width, int height, image::Image::Format format) {
+    std::mt19937 generator(width * 31 + height);
+    std::uniform_int_distribution<int> byte(0, 255);
+    image::Image result(width, height, format);
+    for (int y = 0; y < height; y++) {
+        glm::uint8* line = result.editScanLine(y);
+        for (size_t x = 0; x < result.getBytesPerLineCount(); x++) {
+            line[x] = (glm::uint8)byte(generator);
+        }
+    }
+    return result;
+}
+
+// Compares the pixels of two ARGB32 images, leaving out the padding at the end of the lines
+static bool isSameImage(const image::Image& a, const image::Image& b) {
+    if (a.getWidth() != b.getWidth() || a.getHeight() != b.getHeight() || a.getFormat() != b.getFormat()) {
+        return false;
+    }
+    const size_t lineSize = a.getWidth() * sizeof(QRgb);
+    for (int y = 0; y < a.getHeight(); y++) {
+        if (memcmp(a.getScanLine(y), b.getScanLine(y), lineSize) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Runs a kernel with TBB limited to the calling thread
+template <typename F>
+static void runSerially(F&& kernel) {
+    tbb::task_arena serialArena(1);
+    serialArena.execute(kernel);
+}
+
+// The kernels as they were before they were parallelized, one pixel at a time through getPackedPixel()
+static image::Image mapToRedChannelPerPixel(const image::Image& source, image::ColorChannel sourceChannel) {
+    image::Image result(source.getWidth(), source.getHeight(), image::Image::Format_ARGB32);
+    for (int y = 0; y < source.getHeight(); y++) {
+        for (int x = 0; x < source.getWidth(); x++) {
+            QRgb pixel = source.getPackedPixel(x, y);
+            int colorValue;
+            switch (sourceChannel) {
+            case image::ColorChannel::GREEN:
+                colorValue = qGreen(pixel);
+                break;
+            case image::ColorChannel::BLUE:
+                colorValue = qBlue(pixel);
+                break;
+            case image::ColorChannel::ALPHA:
+                colorValue = qAlpha(pixel);
+                break;
+            case image::ColorChannel::RED:
+            default:
+                colorValue = qRed(pixel);
+                break;
+            }
+            result.setPackedPixel(x, y, qRgba(colorValue, 0, 0, 255));
+        }
+    }
+    return result;
+}
+
+static image::Image processBumpMapPerPixel(const image::Image& source) {
+    const double pStrength = 2.0;
+    const int RGBA_MAX = 255;
+    auto clamp = [](int coordinate, int maxCoordinate) { return std::min(std::max(coordinate, 0), maxCoordinate); };
+    auto mapComponent = [&](double sobelValue) { return (sobelValue + 1.0) * (RGBA_MAX / 2.0); };
+
+    const int width = source.getWidth();
+    const int height = source.getHeight();
+    image::Image result(width, height, image::Image::Format_ARGB32);
+    for (int i = 0; i < width; i++) {
+        const int iNextClamped = clamp(i + 1, width - 1);
+        const int iPrevClamped = clamp(i - 1, width - 1);
+        for (int j = 0; j < height; j++) {
+            const int jNextClamped = clamp(j + 1, height - 1);
+            const int jPrevClamped = clamp(j - 1, height - 1);
+
+            const double tl = qRed(source.getPackedPixel(iPrevClamped, jPrevClamped));
+            const double t = qRed(source.getPackedPixel(iPrevClamped, j));
+            const double tr = qRed(source.getPackedPixel(iPrevClamped, jNextClamped));
+            const double r = qRed(source.getPackedPixel(i, jNextClamped));
+            const double br = qRed(source.getPackedPixel(iNextClamped, jNextClamped));
+            const double b = qRed(source.getPackedPixel(iNextClamped, j));
+            const double bl = qRed(source.getPackedPixel(iNextClamped, jPrevClamped));
+            const double l = qRed(source.getPackedPixel(i, jPrevClamped));
+
+            const double dX = (tr + pStrength * r + br) - (tl + pStrength * l + bl);
+            const double dY = (bl + pStrength * b + br) - (tl + pStrength * t + tr);
+            const double dZ = RGBA_MAX / pStrength;
+
+            glm::vec3 v(dX, dY, dZ);
+            glm::normalize(v);
+
+            result.setPackedPixel(i, j, qRgba(mapComponent(v.z), mapComponent(v.y), mapComponent(v.x), 1.0));
+        }
+    }
+    return result;
+}
+
+static void addImageSizes() {
+    // Heights that don't divide into the bands of rows, and widths that leave padding at the end of the lines
+    QTest::newRow("1x1") << 1 << 1;
+    QTest::newRow("333x17") << 333 << 17;
+    QTest::newRow("512x512") << 512 << 512;
+    QTest::newRow("1021x779") << 1021 << 779;
+}
+
+void TextureProcessingTests::testMapToRedChannel_data() {
+    QTest::addColumn<int>("width");
+    QTest::addColumn<int>("height");
+    addImageSizes();
+}
+
+void TextureProcessingTests::testMapToRedChannel() {
+    QFETCH(int, width);
+    QFETCH(int, height);
+
+    const image::Image source = makeNoiseImage(width, height, image::Image::Format_ARGB32);
+    for (auto channel : { image::ColorChannel::RED, image::ColorChannel::GREEN, image::ColorChannel::BLUE, image::ColorChannel::ALPHA }) {
+        image::Image serial = source;
+        runSerially([&] { image::mapToRedChannel(serial, channel); });
+        image::Image parallel = source;
+        image::mapToRedChannel(parallel, channel);
+        QVERIFY(isSameImage(serial, parallel));
+    }
+}
+
+void TextureProcessingTests::testMapToRedChannelDetaches() {
+    const image::Image source = makeNoiseImage(256, 256, image::Image::Format_ARGB32);
+    const image::Image original = makeNoiseImage(256, 256, image::Image::Format_ARGB32);
+
+    // The copy shares its pixels with the source until it's written to
+    image::Image copy = source;
+    image::mapToRedChannel(copy, image::ColorChannel::GREEN);
+
+    QVERIFY(isSameImage(source, original));
+    QVERIFY(!isSameImage(copy, original));
+}
+
+void TextureProcessingTests::testMapToRedChannelMatchesPixelLoop_data() {
+    QTest::addColumn<int>("width");
+    QTest::addColumn<int>("height");
+    addImageSizes();
+}
+
+void TextureProcessingTests::testMapToRedChannelMatchesPixelLoop() {
+    QFETCH(int, width);
+    QFETCH(int, height);
+
+    const image::Image source = makeNoiseImage(width, height, image::Image::Format_ARGB32);
+    for (auto channel : { image::ColorChannel::RED, image::ColorChannel::GREEN, image::ColorChannel::BLUE, image::ColorChannel::ALPHA }) {
+        image::Image mapped = source;
+        image::mapToRedChannel(mapped, channel);
+        QVERIFY(isSameImage(mapped, mapToRedChannelPerPixel(source, channel)));
+    }
+}
+
+void TextureProcessingTests::testProcessBumpMap_data() {
+    QTest::addColumn<int>("width");
+    QTest::addColumn<int>("height");
+    addImageSizes();
+}
+
+void TextureProcessingTests::testProcessBumpMap() {
+    QFETCH(int, width);
+    QFETCH(int, height);
+
+    const image::Image source = makeNoiseImage(width, height, image::Image::Format_Grayscale8);
+    image::Image serial;
+    runSerially([&] { serial = image::processBumpMap(image::Image(source)); });
+    image::Image parallel = image::processBumpMap(image::Image(source));
+    QVERIFY(isSameImage(serial, parallel));
+}
+
+void TextureProcessingTests::testProcessBumpMapMatchesPixelLoop_data() {
+    QTest::addColumn<int>("width");
+    QTest::addColumn<int>("height");
+    addImageSizes();
+}
+
+void TextureProcessingTests::testProcessBumpMapMatchesPixelLoop() {
+    QFETCH(int, width);
+    QFETCH(int, height);
+
+    const image::Image source = makeNoiseImage(width, height, image::Image::Format_Grayscale8);
+    image::Image filtered = image::processBumpMap(image::Image(source));
+    QVERIFY(isSameImage(filtered, processBumpMapPerPixel(source)));
+}
@@ -0,0 +1,31 @@
+//
+//  TextureProcessingTests.h
+//  tests/ktx/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_TextureProcessingTests_h
+#define hifi_TextureProcessingTests_h
+
+#include <QtCore/QObject>
+
+class TextureProcessingTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testMapToRedChannel_data();
+    void testMapToRedChannel();
+    void testMapToRedChannelDetaches();
+    void testMapToRedChannelMatchesPixelLoop_data();
+    void testMapToRedChannelMatchesPixelLoop();
+    void testProcessBumpMap_data();
+    void testProcessBumpMap();
+    void testProcessBumpMapMatchesPixelLoop_data();
+    void testProcessBumpMapMatchesPixelLoop();
+};
+
+#endif // hifi_TextureProcessingTests_h
@@ -0,0 +1,194 @@
+//
+//  MipRangeQueueTests.cpp
+//  tests/material-networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "MipRangeQueueTests.h"
+
+#include <atomic>
+#include <thread>
+
+#include <QtTest/QtTest>
+
+#include <material-networking/MipRangeQueue.h>
+
+QTEST_GUILESS_MAIN(MipRangeQueueTests)
+
+// A 1024x1024 RGBA8 texture, mip 0 is 4MB and mip 10 is 4 bytes
+static ktx::ImageDescriptors makeImages() {
+    ktx::Header header;
+    header.setUncompressed(ktx::GLType::UNSIGNED_BYTE, 1, ktx::GLFormat::RGBA, ktx::GLInternalFormat::RGBA8, ktx::GLBaseInternalFormat::RGBA);
+    header.set2D(1024, 1024);
+    header.numberOfMipmapLevels = 11;
+    return header.generateImageDescriptors();
+}
+
+static MipRangeData makeRange(uint16_t low, uint16_t high) {
+    static const ktx::ImageDescriptors images = makeImages();
+    return MipRangeData::fromRange(images, low, high, QByteArray());
+}
+
+void MipRangeQueueTests::testGetNextMipRange_data() {
+    QTest::addColumn<int>("lowestFetchedMip");
+    QTest::addColumn<int>("lowestRequestedMip");
+    QTest::addColumn<int>("low");
+    QTest::addColumn<int>("high");
+
+    // Mips 3 to 6 add up to about 85KB, adding mip 2 would go over the target size
+    QTest::newRow("coalesced") << 7 << 0 << 3 << 6;
+    QTest::newRow("stopsAtRequested") << 7 << 5 << 5 << 6;
+    // A mip larger than the target size is still requested, on its own
+    QTest::newRow("largeMip") << 3 << 0 << 2 << 2;
+    QTest::newRow("fullResolution") << 1 << 0 << 0 << 0;
+    QTest::newRow("smallestMip") << 11 << 0 << 3 << 10;
+}
+
+void MipRangeQueueTests::testGetNextMipRange() {
+    QFETCH(int, lowestFetchedMip);
+    QFETCH(int, lowestRequestedMip);
+    QFETCH(int, low);
+    QFETCH(int, high);
+
+    auto images = makeImages();
+    auto range = getNextMipRange(images, (uint16_t)lowestFetchedMip, (uint16_t)lowestRequestedMip);
+    QCOMPARE((int)range.first, low);
+    QCOMPARE((int)range.second, high);
+
+    size_t rangeSize = 0;
+    for (int level = range.first; level <= range.second; ++level) {
+        rangeSize += images[level]._imageSize + ktx::IMAGE_SIZE_WIDTH;
+    }
+    QVERIFY(range.first == range.second || rangeSize <= MIP_RANGE_TARGET_SIZE);
+}
+
+void MipRangeQueueTests::testMipRangeDataOffsets() {
+    auto images = makeImages();
+    auto range = MipRangeData::fromRange(images, 3, 6, QByteArray());
+
+    QCOMPARE((int)range.images.size(), 4);
+    QCOMPARE((int)range.highestLevel(), 6);
+    for (const auto& image : range.images) {
+        QCOMPARE(image.offset, images[image.level]._imageOffset - images[3]._imageOffset);
+        QCOMPARE(image.size, (size_t)images[image.level]._imageSize);
+    }
+    // The lowest mip comes first in the file
+    QCOMPARE(range.images.back().level, (uint16_t)3);
+    QCOMPARE(range.images.back().offset, (size_t)0);
+}
+
+void MipRangeQueueTests::testStoreOrder() {
+    MipRangeQueue queue;
+    queue.push(makeRange(2, 2));
+    queue.push(makeRange(7, 10));
+    queue.push(makeRange(3, 6));
+
+    MipRangeData range;
+    auto generation = queue.getGeneration();
+    QVERIFY(queue.pop(range, generation));
+    QCOMPARE((int)range.highestLevel(), 10);
+    QVERIFY(queue.pop(range, generation));
+    QCOMPARE((int)range.highestLevel(), 6);
+    QVERIFY(queue.pop(range, generation));
+    QCOMPARE((int)range.highestLevel(), 2);
+    QVERIFY(!queue.pop(range, generation));
+}
+
+void MipRangeQueueTests::testSingleWorker() {
+    MipRangeQueue queue;
+    QVERIFY(queue.push(makeRange(3, 6)));
+    // The worker started by the first push stores this one too
+    QVERIFY(!queue.push(makeRange(2, 2)));
+    QCOMPARE((int)queue.size(), 2);
+
+    MipRangeData range;
+    auto generation = queue.getGeneration();
+    QVERIFY(queue.pop(range, generation));
+    QVERIFY(queue.pop(range, generation));
+    QVERIFY(!queue.pop(range, generation));
+
+    // Once the worker is done the next push has to start another
+    QVERIFY(queue.push(makeRange(1, 1)));
+}
+
+void MipRangeQueueTests::testAbort() {
+    MipRangeQueue queue;
+    QVERIFY(queue.push(makeRange(3, 6)));
+    QVERIFY(!queue.push(makeRange(2, 2)));
+
+    auto generation = queue.getGeneration();
+    queue.abort(generation);
+    QCOMPARE((int)queue.size(), 0);
+    MipRangeData range;
+    QVERIFY(!queue.pop(range, generation));
+    QVERIFY(queue.push(makeRange(1, 1)));
+}
+
+void MipRangeQueueTests::testReset() {
+    MipRangeQueue queue;
+    auto oldGeneration = queue.getGeneration();
+    QVERIFY(queue.push(makeRange(3, 6)));
+    QVERIFY(!queue.push(makeRange(2, 2)));
+
+    // The texture is reloaded while the old worker is still storing
+    queue.reset();
+    QCOMPARE((int)queue.size(), 0);
+    QVERIFY(queue.push(makeRange(7, 10)));
+    auto newGeneration = queue.getGeneration();
+    QVERIFY(newGeneration != oldGeneration);
+
+    // The old worker neither takes the new ranges nor drops them, they are left to the new worker
+    MipRangeData range;
+    QVERIFY(!queue.pop(range, oldGeneration));
+    queue.abort(oldGeneration);
+    QCOMPARE((int)queue.size(), 1);
+    QVERIFY(!queue.push(makeRange(3, 6)));
+    QVERIFY(queue.pop(range, newGeneration));
+    QCOMPARE((int)range.highestLevel(), 10);
+}
+
+void MipRangeQueueTests::testConcurrentPushAndDrain() {
+    const int NUM_RANGES = 10000;
+    MipRangeQueue queue;
+    std::atomic<int> numWorkers { 0 };
+    std::atomic<int> maxWorkers { 0 };
+    std::atomic<int> numStored { 0 };
+    std::vector<std::thread> workers;
+    auto generation = queue.getGeneration();
+
+    auto drain = [&] {
+        int running = ++numWorkers;
+        int expected = maxWorkers;
+        while (running > expected && !maxWorkers.compare_exchange_weak(expected, running)) {
+        }
+        MipRangeData range;
+        // Leave the running count before the final pop, after which another worker may start
+        while (true) {
+            --numWorkers;
+            bool popped = queue.pop(range, generation);
+            if (!popped) {
+                return;
+            }
+            ++numWorkers;
+            ++numStored;
+        }
+    };
+
+    for (int i = 0; i < NUM_RANGES; ++i) {
+        if (queue.push(makeRange(1, 1))) {
+            workers.emplace_back(drain);
+        }
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    QCOMPARE(numStored.load(), NUM_RANGES);
+    QCOMPARE(maxWorkers.load(), 1);
+    QCOMPARE((int)queue.size(), 0);
+}
@@ -0,0 +1,30 @@
+//
+//  MipRangeQueueTests.h
+//  tests/material-networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_MipRangeQueueTests_h
+#define hifi_MipRangeQueueTests_h
+
+#include <QtCore/QObject>
+
+class MipRangeQueueTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testGetNextMipRange_data();
+    void testGetNextMipRange();
+    void testMipRangeDataOffsets();
+    void testStoreOrder();
+    void testSingleWorker();
+    void testAbort();
+    void testReset();
+    void testConcurrentPushAndDrain();
+};
+
+#endif // hifi_MipRangeQueueTests_h
@@ -25,6 +25,8 @@
 #include "Gzip.h"
 #include "model-networking/ModelLoader.h"
 #include <hfm/ModelFormatRegistry.h>
+#include <model-baker/Baker.h>
+#include <model-baker/ModelArtifact.h>
 #include "DependencyManager.h"
 #include "ResourceManager.h"
 #include "AssetClient.h"
@@ -38,6 +40,9 @@
 #include <QByteArray>
 #include <QDebug>
 #include <QDirIterator>
+#include <QThread>
+
+#include <tbb/global_control.h>
 
 QTEST_MAIN(ModelSerializersTests)
 
@@ -159,3 +164,126 @@ void ModelSerializersTests::loadGLTF() {
     QVERIFY(expectWarnings == (model->loadWarningCount>0));
     QVERIFY(expectErrors == (model->loadErrorCount>0));
 }
+
+void ModelSerializersTests::benchmarkLoadModel_data() {
+    QTest::addColumn<QString>("filename");
+    QTest::addColumn<int>("threads");
+
+    // The largest of the test avatars, loaded with the parallelism capped at 1..N worker threads
+    const QStringList filenames { "models/src/DragonAvatar1.glb.gz", "models/src/female-avatar-with-swords.glb.gz" };
+    const int maxThreads = std::max(QThread::idealThreadCount(), 1);
+    QList<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts << threads;
+    }
+    threadCounts << maxThreads;
+    for (const auto& filename : filenames) {
+        for (int threads : threadCounts) {
+            QString testname = QFileInfo(filename).fileName() + "-" + QString::number(threads) + "-threads";
+            QTest::newRow(testname.toUtf8().data()) << filename << threads;
+        }
+    }
+}
+
+void ModelSerializersTests::benchmarkLoadModel() {
+    QFETCH(QString, filename);
+    QFETCH(int, threads);
+
+    QFile file(filename);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QByteArray uncompressedData;
+    QVERIFY(gunzip(file.readAll(), uncompressedData));
+
+    QUrl url("https://example.com");
+    url.setPath("/" + filename.chopped(3));
+
+    QMultiHash<QString, QVariant> serializerMapping;
+    serializerMapping.insert("combineParts", true);
+    serializerMapping.insert("deduplicateIndices", true);
+
+    tbb::global_control parallelism(tbb::global_control::max_allowed_parallelism, (size_t)threads);
+    ModelLoader loader;
+    hfm::Model::Pointer model;
+    QBENCHMARK {
+        model = loader.load(uncompressedData, serializerMapping, url, std::string());
+    }
+    QVERIFY(model);
+    qInfo() << "Loaded" << model->meshes.count() << "meshes with at most" << threads << "threads";
+}
+
+void ModelSerializersTests::modelArtifactRoundTrip_data() {
+    QTest::addColumn<QString>("filename");
+
+    QTest::newRow("DragonAvatar1") << "models/src/DragonAvatar1.glb.gz";
+    QTest::newRow("female-avatar-with-swords") << "models/src/female-avatar-with-swords.glb.gz";
+    QTest::newRow("womanInTShirt") << "models/src/womanInTShirt.glb.gz";
+}
+
+void ModelSerializersTests::modelArtifactRoundTrip() {
+    QFETCH(QString, filename);
+
+    QFile file(filename);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QByteArray uncompressedData;
+    QVERIFY(gunzip(file.readAll(), uncompressedData));
+
+    QUrl url("https://example.com");
+    url.setPath("/" + filename.chopped(3));
+
+    QMultiHash<QString, QVariant> serializerMapping;
+    serializerMapping.insert("combineParts", true);
+    serializerMapping.insert("deduplicateIndices", true);
+
+    ModelLoader loader;
+    hfm::Model::Pointer loadedModel = loader.load(uncompressedData, serializerMapping, url, std::string());
+    QVERIFY(loadedModel);
+
+    // Artifacts hold the baked model, with the graphics meshes the baker builds
+    baker::Baker modelBaker(loadedModel, hifi::VariantHash(), url);
+    modelBaker.run();
+    hfm::Model::Pointer model = modelBaker.getHFMModel();
+    QVERIFY(model);
+    QVERIFY(baker::canWriteModelArtifact(*model));
+
+    QByteArray artifact = baker::writeModelArtifact(*model);
+    QVERIFY(!artifact.isEmpty());
+
+    hfm::Model::Pointer readModel = baker::readModelArtifact((const uint8_t*)artifact.constData(), artifact.size());
+    QVERIFY(readModel);
+    QCOMPARE(readModel->meshes.size(), model->meshes.size());
+    QCOMPARE(readModel->joints.size(), model->joints.size());
+    QCOMPARE(readModel->materials.keys(), model->materials.keys());
+    for (int i = 0; i < model->meshes.size(); i++) {
+        QVERIFY(readModel->meshes[i].vertices == model->meshes[i].vertices);
+        QCOMPARE(readModel->meshes[i].parts.size(), model->meshes[i].parts.size());
+
+        const auto& mesh = model->meshes[i]._mesh;
+        const auto& readMesh = readModel->meshes[i]._mesh;
+        QVERIFY(mesh);
+        QVERIFY(readMesh);
+        QCOMPARE(readMesh->getNumVertices(), mesh->getNumVertices());
+        QCOMPARE(readMesh->getNumIndices(), mesh->getNumIndices());
+        QCOMPARE(readMesh->getVertexStream().getNumBuffers(), mesh->getVertexStream().getNumBuffers());
+
+        // A mesh without vertex colors is colored through its own color buffer, which must be the one it draws with
+        auto color = readMesh->getVertexFormat()->getAttribute(gpu::Stream::COLOR);
+        if (color._frequency == gpu::Stream::PER_INSTANCE) {
+            QVERIFY(readMesh->getVertexStream().getBuffers()[color._channel] == readMesh->getColorBuffer());
+            QVERIFY(readMesh->getColorBuffer() != mesh->getColorBuffer());
+        }
+    }
+    for (const auto& materialID : model->materials.keys()) {
+        const auto& material = model->materials[materialID]._material;
+        const auto& readMaterial = readModel->materials[materialID]._material;
+        QCOMPARE((bool)readMaterial, (bool)material);
+        if (material) {
+            QVERIFY(readMaterial->getKey()._flags == material->getKey()._flags);
+        }
+    }
+
+    // Everything that was written is read back, so writing the read model again gives the same artifact
+    QCOMPARE(baker::writeModelArtifact(*readModel), artifact);
+
+    // Truncated artifacts are rejected rather than half read
+    QVERIFY(!baker::readModelArtifact((const uint8_t*)artifact.constData(), artifact.size() - 1));
+}
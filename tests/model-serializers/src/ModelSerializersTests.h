@@ -21,6 +21,10 @@ private slots:
     void initTestCase();
     void loadGLTF_data();
     void loadGLTF();
+    void benchmarkLoadModel_data();
+    void benchmarkLoadModel();
+    void modelArtifactRoundTrip_data();
+    void modelArtifactRoundTrip();
 
 };
 
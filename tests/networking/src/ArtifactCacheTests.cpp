@@ -0,0 +1,66 @@
+//
+//  ArtifactCacheTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ArtifactCacheTests.h"
+
+#include <ArtifactCache.h>
+
+QTEST_GUILESS_MAIN(ArtifactCacheTests)
+
+const uint32_t TEST_TYPE = 0x54534554; // "TEST"
+const uint32_t TEST_VERSION = 1;
+static const QByteArray TEST_SOURCE { "source data" };
+
+static std::shared_ptr<ArtifactCache> makeArtifactCache(const QString& location) {
+    auto result = std::make_shared<ArtifactCache>(location.toStdString());
+    // skip the version setting, the test directory starts out empty
+    result->cache::FileCache::initialize();
+    return result;
+}
+
+void ArtifactCacheTests::testKey() {
+    auto key = ArtifactCache::computeKey(TEST_TYPE, TEST_VERSION, TEST_SOURCE);
+    QCOMPARE(ArtifactCache::computeKey(TEST_TYPE, TEST_VERSION, TEST_SOURCE), key);
+    QVERIFY(ArtifactCache::computeKey(TEST_TYPE + 1, TEST_VERSION, TEST_SOURCE) != key);
+    QVERIFY(ArtifactCache::computeKey(TEST_TYPE, TEST_VERSION + 1, TEST_SOURCE) != key);
+    QVERIFY(ArtifactCache::computeKey(TEST_TYPE, TEST_VERSION, TEST_SOURCE, ".raw") != key);
+    QVERIFY(ArtifactCache::computeKey(TEST_TYPE, TEST_VERSION, TEST_SOURCE + "!") != key);
+}
+
+void ArtifactCacheTests::testRoundTrip() {
+    QByteArray payload(4096, Qt::Uninitialized);
+    for (int i = 0; i < payload.size(); ++i) {
+        payload[i] = (char)(i * 7);
+    }
+    auto key = ArtifactCache::computeKey(TEST_TYPE, TEST_VERSION, TEST_SOURCE);
+    {
+        auto cache = makeArtifactCache(_testDir.path());
+        QVERIFY(!cache->loadArtifact(key, TEST_TYPE, TEST_VERSION));
+        cache->saveArtifact(key, TEST_TYPE, TEST_VERSION, payload);
+    }
+
+    // a new cache over the same directory stands in for the next session
+    auto cache = makeArtifactCache(_testDir.path());
+    auto artifact = cache->loadArtifact(key, TEST_TYPE, TEST_VERSION);
+    QVERIFY(artifact);
+    QCOMPARE(artifact->size(), (size_t)payload.size());
+    QCOMPARE((size_t)artifact->data() % 16, (size_t)0);
+    QVERIFY(memcmp(artifact->data(), payload.constData(), payload.size()) == 0);
+}
+
+void ArtifactCacheTests::testMismatchedEntry() {
+    auto cache = makeArtifactCache(_testDir.path());
+    auto key = ArtifactCache::computeKey(TEST_TYPE, TEST_VERSION, "mismatched");
+    cache->saveArtifact(key, TEST_TYPE, TEST_VERSION, TEST_SOURCE);
+    QVERIFY(cache->loadArtifact(key, TEST_TYPE, TEST_VERSION));
+    QVERIFY(!cache->loadArtifact(key, TEST_TYPE + 1, TEST_VERSION));
+    QVERIFY(!cache->loadArtifact(key, TEST_TYPE, TEST_VERSION + 1));
+}
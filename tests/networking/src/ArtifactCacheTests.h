@@ -0,0 +1,30 @@
+//
+//  ArtifactCacheTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_ArtifactCacheTests_h
+#define hifi_ArtifactCacheTests_h
+
+#include <QtTest/QtTest>
+#include <QtCore/QTemporaryDir>
+
+class ArtifactCacheTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testKey();
+    void testRoundTrip();
+    void testMismatchedEntry();
+
+private:
+    QTemporaryDir _testDir;
+};
+
+#endif // hifi_ArtifactCacheTests_h
@@ -0,0 +1,139 @@
+//
+//  ResourceSchedulerTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ResourceSchedulerTests.h"
+
+#include <DependencyManager.h>
+#include <ResourceCache.h>
+#include <ResourceManager.h>
+#include <ResourceRequestObserver.h>
+#include <StatTracker.h>
+
+QTEST_GUILESS_MAIN(ResourceSchedulerTests)
+
+static QSharedPointer<Resource> makeResource(QObject* owner, const QString& url, float priority) {
+    auto resource = QSharedPointer<Resource>::create(QUrl(url));
+    resource->setSelf(resource);
+    resource->setLoadPriorityOperator(owner, [priority]() { return priority; });
+    return resource;
+}
+
+void ResourceSchedulerTests::initTestCase() {
+    DependencyManager::set<ResourceCacheSharedItems>();
+    // for the tests that make real requests, which never get to run as the event loop isn't
+    DependencyManager::set<StatTracker>();
+    DependencyManager::set<ResourceManager>(false);
+    DependencyManager::set<ResourceRequestObserver>();
+}
+
+void ResourceSchedulerTests::init() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    sharedItems->clear();
+    sharedItems->setRequestLimit(1);
+}
+
+void ResourceSchedulerTests::testPriorityOrder() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    auto loading = makeResource(this, "http://localhost/loading.fbx", 0.0f);
+    auto low = makeResource(this, "http://localhost/low.fbx", 0.0f);
+    auto high = makeResource(this, "http://localhost/high.fbx", 1.0f);
+    QVERIFY(sharedItems->appendRequest(loading, 0.0f));
+    QVERIFY(!sharedItems->appendRequest(low, 0.0f));
+    QVERIFY(!sharedItems->appendRequest(high, 1.0f));
+
+    // nothing can start while the protocol is at its limit
+    QVERIFY(!sharedItems->getHighestPendingRequest().first);
+
+    sharedItems->removeRequest(loading);
+    QCOMPARE(sharedItems->getHighestPendingRequest().first, high);
+    QCOMPARE(sharedItems->getHighestPendingRequest().first, low);
+    QCOMPARE(sharedItems->getPendingRequestsCount(), (uint32_t)0);
+}
+
+void ResourceSchedulerTests::testWaitingPriority() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    auto loading = makeResource(this, "http://localhost/loading.fbx", 0.0f);
+    auto older = makeResource(this, "http://localhost/older.fbx", 0.0f);
+    auto newer = makeResource(this, "http://localhost/newer.fbx", 0.0f);
+    QVERIFY(sharedItems->appendRequest(loading, 0.0f));
+    QVERIFY(!sharedItems->appendRequest(older, 0.0f));
+    QThread::msleep(20);
+    QVERIFY(!sharedItems->appendRequest(newer, 0.0f));
+
+    // of two equally important requests the one that has waited longer goes first
+    sharedItems->removeRequest(loading);
+    QCOMPARE(sharedItems->getHighestPendingRequest().first, older);
+}
+
+void ResourceSchedulerTests::testFilesFirst() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    auto loading = makeResource(this, "http://localhost/loading.fbx", 0.0f);
+    auto remote = makeResource(this, "atp:/remote.fbx", 1.0f);
+    auto local = makeResource(this, "file:///local.fbx", -1.0f);
+    QVERIFY(sharedItems->appendRequest(loading, 0.0f));
+    QVERIFY(!sharedItems->appendRequest(remote, 1.0f));
+    QVERIFY(!sharedItems->appendRequest(local, -1.0f));
+
+    sharedItems->removeRequest(loading);
+    QCOMPARE(sharedItems->getHighestPendingRequest().first, local);
+}
+
+void ResourceSchedulerTests::testPreemption() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    sharedItems->setRequestLimit(2);
+    auto distant = makeResource(this, "http://localhost/distant.fbx", -1.0f);
+    auto local = makeResource(this, "file:///local.fbx", -2.0f);
+    QVERIFY(sharedItems->appendRequest(distant, -1.0f));
+    QVERIFY(sharedItems->appendRequest(local, -2.0f));
+
+    // a request that barely matters more doesn't take a slot, and local files are never preempted
+    QVERIFY(!sharedItems->getPreemptableRequest(-0.9f));
+    QCOMPARE(sharedItems->getPreemptableRequest(1.0f), distant);
+
+    // a request is only preempted once
+    QVERIFY(!sharedItems->getPreemptableRequest(1.0f));
+}
+
+void ResourceSchedulerTests::testPreemptionAfterRequeue() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    auto distant = makeResource(this, "http://localhost/distant.fbx", -1.0f);
+    QVERIFY(sharedItems->appendRequest(distant, -1.0f));
+    QCOMPARE(sharedItems->getPreemptableRequest(1.0f), distant);
+
+    // what Resource::preempt() does: give up the slot and queue up again, then get picked by priority later on
+    sharedItems->removeRequest(distant);
+    QVERIFY(sharedItems->appendRequest(distant, NAN));
+    QCOMPARE(sharedItems->getLoadingRequestsCount(), (uint32_t)1);
+
+    // the new loading request still remembers that it was preempted once
+    QVERIFY(!sharedItems->getPreemptableRequest(1.0f));
+
+    // but another resource can be preempted
+    auto other = makeResource(this, "http://localhost/other.fbx", -1.0f);
+    sharedItems->removeRequest(distant);
+    QVERIFY(sharedItems->appendRequest(other, -1.0f));
+    QCOMPARE(sharedItems->getPreemptableRequest(1.0f), other);
+}
+
+void ResourceSchedulerTests::testPreemptResource() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    auto distant = makeResource(this, "http://localhost/distant.fbx", -1.0f);
+    distant->ensureLoading();
+    QCOMPARE(sharedItems->getLoadingRequestsCount(), (uint32_t)1);
+
+    // the distant resource's request is cancelled, the close one gets its slot and the distant one queues up again
+    auto close = makeResource(this, "http://localhost/close.fbx", 1.0f);
+    close->ensureLoading();
+    auto loading = sharedItems->getLoadingRequests();
+    QCOMPARE(loading.size(), 1);
+    QCOMPARE(loading.front().first, close);
+    QCOMPARE(sharedItems->getPendingRequests(), QList<QSharedPointer<Resource>>({ distant }));
+}
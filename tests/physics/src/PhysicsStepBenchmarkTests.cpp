@@ -0,0 +1,177 @@
+//
+//  PhysicsStepBenchmarkTests.cpp
+//  tests/physics/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "PhysicsStepBenchmarkTests.h"
+
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <QElapsedTimer>
+#include <QThread>
+
+#include <LinearMath/btThreads.h>
+
+#include <GLMHelpers.h>
+#include <PhysicsEngine.h>
+#include <ThreadSafeDynamicsWorld.h>
+
+QTEST_MAIN(PhysicsStepBenchmarkTests)
+
+const int NUM_BODIES_PER_SIDE = 25;
+const int NUM_BODIES_PER_STACK = 8; // 25 * 25 * 8 = 5000 dynamic bodies
+const float BOX_HALF_EXTENT = 0.25f;
+const float STACK_SPACING = 0.6f;
+const float STEP = 1.0f / 90.0f;
+const int NUM_WARMUP_STEPS = 30;
+const int NUM_MEASURED_STEPS = 60;
+
+// A scripted scene of stacked boxes that topple into each other: lots of contacts and a mix of small and large islands.
+class BoxStackScene {
+public:
+    BoxStackScene(int numThreads) : _engine(Vectors::ZERO), _boxShape(btVector3(BOX_HALF_EXTENT, BOX_HALF_EXTENT, BOX_HALF_EXTENT)),
+        _groundShape(btVector3(100.0f, 0.5f, 100.0f)) {
+        _engine.init();
+        _numThreads = _engine.setNumSimulationThreads(numThreads);
+        _world = static_cast<ThreadSafeDynamicsWorld*>(_engine.getDynamicsWorld());
+        _world->setGravity(btVector3(0.0f, -9.8f, 0.0f));
+
+        btTransform transform;
+        transform.setIdentity();
+        transform.setOrigin(btVector3(0.0f, -0.5f, 0.0f));
+        addBody(&_groundShape, 0.0f, transform);
+
+        btVector3 inertia;
+        const float MASS = 1.0f;
+        _boxShape.calculateLocalInertia(MASS, inertia);
+        float offset = 0.5f * (float)(NUM_BODIES_PER_SIDE - 1) * STACK_SPACING;
+        for (int i = 0; i < NUM_BODIES_PER_SIDE; ++i) {
+            for (int k = 0; k < NUM_BODIES_PER_SIDE; ++k) {
+                for (int j = 0; j < NUM_BODIES_PER_STACK; ++j) {
+                    // lean each stack a little, in a repeatable pattern, so that it falls over
+                    float lean = 0.03f * (float)j * (float)(((i * 7 + k * 3) % 5) - 2);
+                    transform.setOrigin(btVector3((float)i * STACK_SPACING - offset + lean,
+                                                  BOX_HALF_EXTENT + (float)j * (2.0f * BOX_HALF_EXTENT + 0.01f),
+                                                  (float)k * STACK_SPACING - offset));
+                    addBody(&_boxShape, MASS, transform, inertia);
+                }
+            }
+        }
+    }
+
+    ~BoxStackScene() {
+        for (btRigidBody* body : _bodies) {
+            _world->removeRigidBody(body);
+            delete body;
+        }
+    }
+
+    int getNumThreads() const { return _numThreads; }
+    const std::vector<btRigidBody*>& getBodies() const { return _bodies; }
+
+    void step(int numSteps) {
+        for (int i = 0; i < numSteps; ++i) {
+            _world->stepSimulationWithSubstepCallback(STEP, 1, STEP);
+        }
+    }
+
+private:
+    void addBody(btCollisionShape* shape, float mass, const btTransform& transform, const btVector3& inertia = btVector3(0.0f, 0.0f, 0.0f)) {
+        btRigidBody* body = new btRigidBody(mass, nullptr, shape, inertia);
+        body->setWorldTransform(transform);
+        _world->addRigidBody(body);
+        _bodies.push_back(body);
+    }
+
+    PhysicsEngine _engine;
+    btBoxShape _boxShape;
+    btBoxShape _groundShape;
+    ThreadSafeDynamicsWorld* _world { nullptr };
+    std::vector<btRigidBody*> _bodies;
+    int _numThreads { 1 };
+};
+
+void PhysicsStepBenchmarkTests::benchmarkStep_data() {
+    QTest::addColumn<int>("numThreads");
+    int maxThreads = std::min(QThread::idealThreadCount(), MAX_PHYSICS_SIMULATION_THREADS);
+    for (int numThreads = 1; numThreads <= maxThreads; ++numThreads) {
+        QTest::newRow(QString("%1 threads").arg(numThreads).toLatin1().constData()) << numThreads;
+    }
+}
+
+void PhysicsStepBenchmarkTests::benchmarkStep() {
+    QFETCH(int, numThreads);
+    BoxStackScene scene(numThreads);
+    scene.step(NUM_WARMUP_STEPS);
+
+    QElapsedTimer timer;
+    QBENCHMARK_ONCE {
+        timer.start();
+        scene.step(NUM_MEASURED_STEPS);
+    }
+    float msecPerStep = (float)timer.nsecsElapsed() / (1.0e6f * (float)NUM_MEASURED_STEPS);
+    qInfo() << scene.getBodies().size() - 1 << "dynamic bodies," << numThreads << "threads requested,"
+        << scene.getNumThreads() << "in use:" << msecPerStep << "msec/step";
+}
+
+void PhysicsStepBenchmarkTests::testDeterministicStep() {
+    // two runs of the same scene on several threads must agree bit for bit
+    int numThreads = std::min(QThread::idealThreadCount(), MAX_PHYSICS_SIMULATION_THREADS);
+    std::vector<btTransform> firstTransforms;
+    {
+        BoxStackScene scene(numThreads);
+        scene.step(NUM_WARMUP_STEPS);
+        for (btRigidBody* body : scene.getBodies()) {
+            firstTransforms.push_back(body->getWorldTransform());
+        }
+    }
+    BoxStackScene scene(numThreads);
+    scene.step(NUM_WARMUP_STEPS);
+    const std::vector<btRigidBody*>& bodies = scene.getBodies();
+    QCOMPARE(bodies.size(), firstTransforms.size());
+    for (size_t i = 0; i < bodies.size(); ++i) {
+        QVERIFY(bodies[i]->getWorldTransform() == firstTransforms[i]);
+    }
+}
+
+// records which threads ran the loop, slowly enough that the workers get a chance to pick up part of it
+class ThreadRecordingBody : public btIParallelForBody {
+public:
+    virtual void forLoop(int iBegin, int iEnd) const override {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _threads.insert(std::this_thread::get_id());
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(iEnd - iBegin));
+    }
+
+    size_t getNumThreads() const { return _threads.size(); }
+
+private:
+    mutable std::mutex _mutex;
+    mutable std::set<std::thread::id> _threads;
+};
+
+void PhysicsStepBenchmarkTests::testSimulationThreadsUsed() {
+    if (QThread::idealThreadCount() < 2) {
+        QSKIP("needs more than one core");
+    }
+    BoxStackScene scene(2);
+    // fails when Bullet was built without BT_THREADSAFE: the engine falls back to the main thread
+    QVERIFY(scene.getNumThreads() > 1);
+
+    // the step goes through the same btParallelFor() calls, so this checks that work really leaves the calling thread
+    ThreadRecordingBody body;
+    btParallelFor(0, 64, 1, body);
+    QVERIFY(body.getNumThreads() > 1);
+}
@@ -0,0 +1,27 @@
+//
+//  PhysicsStepBenchmarkTests.h
+//  tests/physics/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_PhysicsStepBenchmarkTests_h
+#define hifi_PhysicsStepBenchmarkTests_h
+
+#include <QtTest/QtTest>
+
+class PhysicsStepBenchmarkTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void benchmarkStep_data();
+    void benchmarkStep();
+    void testDeterministicStep();
+    void testSimulationThreadsUsed();
+};
+
+#endif // hifi_PhysicsStepBenchmarkTests_h
@@ -13,6 +13,7 @@
 
 #include <iostream>
 
+#include <ShapeCache.h>
 #include <ShapeManager.h>
 #include <StreamUtils.h>
 #include <Extents.h>
@@ -244,3 +245,54 @@ void ShapeManagerTests::addCompoundShape() {
     QCOMPARE(shapeManager.getNumShapes(), 0);
     QCOMPARE(shapeManager.getNumReferences(info), 0);
 }
+
+void ShapeManagerTests::staticMeshBvhRoundTrip() {
+    // build a bumpy grid big enough to be worth caching
+    const int GRID_SIZE = 40;
+    ShapeInfo::PointList points;
+    for (int i = 0; i < GRID_SIZE; ++i) {
+        for (int j = 0; j < GRID_SIZE; ++j) {
+            points.push_back(glm::vec3((float)i, 0.1f * (float)((i * 7 + j * 3) % 5), (float)j));
+        }
+    }
+    ShapeInfo info;
+    info.setParams(SHAPE_TYPE_STATIC_MESH, 0.5f * glm::vec3((float)GRID_SIZE, 1.0f, (float)GRID_SIZE));
+    info.setPointCollection(ShapeInfo::PointCollection({ points }));
+    ShapeInfo::TriangleIndices& indices = info.getTriangleIndices();
+    for (int i = 0; i < GRID_SIZE - 1; ++i) {
+        for (int j = 0; j < GRID_SIZE - 1; ++j) {
+            int32_t k = i * GRID_SIZE + j;
+            indices << k << k + 1 << k + GRID_SIZE;
+            indices << k + 1 << k + GRID_SIZE + 1 << k + GRID_SIZE;
+        }
+    }
+    QVERIFY(ShapeCache::isCacheable(info));
+
+    const btCollisionShape* shape = ShapeFactory::createShapeFromInfo(info);
+    QVERIFY(shape != nullptr);
+    QByteArray bvhData = ShapeFactory::serializeStaticMeshBvh(shape);
+    QVERIFY(!bvhData.isEmpty());
+
+    // a shape rebuilt from the serialized bvh should match the original
+    const btCollisionShape* loadedShape = ShapeFactory::createStaticMeshShapeFromBvh(info, bvhData);
+    QVERIFY(loadedShape != nullptr);
+    QCOMPARE(loadedShape->getShapeType(), shape->getShapeType());
+    btTransform identity;
+    identity.setIdentity();
+    btVector3 minCorner, maxCorner, loadedMinCorner, loadedMaxCorner;
+    shape->getAabb(identity, minCorner, maxCorner);
+    loadedShape->getAabb(identity, loadedMinCorner, loadedMaxCorner);
+    QVERIFY(minCorner == loadedMinCorner);
+    QVERIFY(maxCorner == loadedMaxCorner);
+    QCOMPARE(ShapeFactory::serializeStaticMeshBvh(loadedShape), bvhData);
+
+    // the cache key must change with the mesh content even though ShapeInfo::getHash() doesn't
+    std::string key = ShapeCache::computeKey(info);
+    uint64_t hash = info.getHash();
+    info.getPointCollection()[0][0].y += 1.0f;
+    QCOMPARE(info.getHash(), hash);
+    QVERIFY(ShapeCache::computeKey(info) != key);
+
+    ShapeFactory::deleteShape(shape);
+    ShapeFactory::deleteShape(loadedShape);
+}
@@ -15,6 +15,7 @@
 
 static const QString HEADER_NAME = "com.highfidelity.recording.Header";
 static const QString TEST_NAME = "com.highfidelity.recording.Test";
+static const QString TEST_STREAM_NAME = "com.highfidelity.recording.TestStream";
 
 #endif // hifi_FrameTests_h
 
@@ -16,6 +16,7 @@
 
 #include <QtGlobal>
 #include <QtTest/QtTest>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QTemporaryFile>
 #include <QtCore/QString>
 
@@ -27,15 +28,20 @@
 #include <Windows.h>
 #endif
 
+#include <random>
+
 #include <recording/Clip.h>
 #include <recording/Frame.h>
+#include <recording/impl/PointerClip.h>
 
+#include <NumericalConstants.h>
 #include <SharedUtil.h>
 
 #include "Constants.h"
 
 using namespace recording;
 FrameType TEST_FRAME_TYPE { Frame::TYPE_INVALID };
+FrameType TEST_STREAM_FRAME_TYPE { Frame::TYPE_INVALID };
 
 void testFrameTypeRegistration() {
     TEST_FRAME_TYPE = Frame::registerFrameType(TEST_NAME);
@@ -119,10 +125,150 @@ void testClipOrdering() {
     Q_UNUSED(lastFrameTimeOffset); // FIXME - Unix build not yet upgraded to Qt 5.5.1 we can remove this once it is
 }
 
+static const int AVATAR_FRAME_HZ = 90;
+static const int AVATAR_FRAME_SIZE = 512;
+static const int STREAM_FRAME_HZ = 100;
+static const int STREAM_FRAME_SIZE = 480;
+
+// A clip interleaving avatar like frames with a denser audio like stream, every payload filled with its frame number
+Clip::Pointer makeTestClip(int seconds) {
+    auto clip = Clip::newClip();
+    auto addFrames = [&](FrameType type, int hz, int size) {
+        for (int i = 0; i < seconds * hz; ++i) {
+            auto frame = std::make_shared<Frame>(type, 0.0f, QByteArray(size, (char)i));
+            frame->timeOffset = (Frame::Time)((quint64)i * MSECS_PER_SECOND / hz);
+            clip->addFrame(frame);
+        }
+    };
+    addFrames(TEST_FRAME_TYPE, AVATAR_FRAME_HZ, AVATAR_FRAME_SIZE);
+    addFrames(TEST_STREAM_FRAME_TYPE, STREAM_FRAME_HZ, STREAM_FRAME_SIZE);
+    return clip;
+}
+
+void testIndexedClip() {
+    TEST_STREAM_FRAME_TYPE = Frame::registerFrameType(TEST_STREAM_NAME);
+
+    QTemporaryFile file;
+    QString fileName;
+    if (file.open()) {
+        fileName = file.fileName();
+        file.close();
+    }
+
+    static const int CLIP_SECONDS = 10;
+    auto writeClip = makeTestClip(CLIP_SECONDS);
+    Clip::toFile(fileName, writeClip);
+
+    auto readClip = std::dynamic_pointer_cast<PointerClip>(Clip::fromFile(fileName));
+    QVERIFY(readClip);
+    QVERIFY(readClip->isIndexed());
+    QVERIFY(readClip->frameCount() == writeClip->frameCount());
+    QVERIFY(readClip->frameCountOfType(TEST_FRAME_TYPE) == (size_t)(CLIP_SECONDS * AVATAR_FRAME_HZ));
+    QVERIFY(readClip->frameCountOfType(TEST_STREAM_FRAME_TYPE) == (size_t)(CLIP_SECONDS * STREAM_FRAME_HZ));
+
+    readClip->seek(0);
+    writeClip->seek(0);
+    for (auto readFrame = readClip->nextFrame(), writeFrame = writeClip->nextFrame(); readFrame && writeFrame;
+        readFrame = readClip->nextFrame(), writeFrame = writeClip->nextFrame()) {
+        QVERIFY(readFrame->type == writeFrame->type);
+        QVERIFY(readFrame->timeOffset == writeFrame->timeOffset);
+        QVERIFY(readFrame->data == writeFrame->data);
+        // frames are views of the mapped file
+        QVERIFY(readFrame->dataOwner);
+    }
+
+    // seeking lands on the first frame at or after the time
+    readClip->seekFrameTime(5005);
+    QVERIFY(readClip->positionFrameTime() == 5010);
+
+    // the avatar frame in effect 5.005s in is number 450, at 5s
+    auto frame = readClip->lastFrameOfType(TEST_FRAME_TYPE, 5005);
+    QVERIFY(frame && frame->type == TEST_FRAME_TYPE && frame->timeOffset == 5000);
+    QVERIFY(frame->data[0] == (char)450);
+    QVERIFY(!readClip->lastFrameOfType(TEST_STREAM_FRAME_TYPE + 1, 5005));
+
+    // frames outlive their clip
+    readClip.reset();
+    QVERIFY(frame->data[0] == (char)450);
+    frame.reset();
+
+    // without the index the frames are still found by walking the file, skipping the index frames
+    static const qint64 FOOTER_FRAME_SIZE = PointerClip::MINIMUM_FRAME_SIZE + PointerClip::INDEX_FOOTER_SIZE;
+    QFile truncatedFile(fileName);
+    QVERIFY(truncatedFile.resize(truncatedFile.size() - FOOTER_FRAME_SIZE));
+    readClip = std::dynamic_pointer_cast<PointerClip>(Clip::fromFile(fileName));
+    QVERIFY(readClip);
+    QVERIFY(!readClip->isIndexed());
+    QVERIFY(readClip->frameCount() == writeClip->frameCount());
+}
+
+// Plays a minute long clip on 100 decks at once the way Deck::processFrames does, along with random seeks
+void benchmarkConcurrentPlayback() {
+    static const int CLIP_SECONDS = 60;
+    static const int PLAYBACK_COUNT = 100;
+    static const Frame::Time PLAYBACK_STEP = 10;
+    static const int SEEK_COUNT = 1000;
+
+    QTemporaryFile file;
+    QString fileName;
+    if (file.open()) {
+        fileName = file.fileName();
+        file.close();
+    }
+    auto writeClip = makeTestClip(CLIP_SECONDS);
+    Clip::toFile(fileName, writeClip);
+    auto frameCount = writeClip->frameCount();
+    writeClip.reset();
+
+    QElapsedTimer timer;
+    timer.start();
+    std::vector<Clip::Pointer> clips;
+    for (int i = 0; i < PLAYBACK_COUNT; ++i) {
+        clips.push_back(Clip::fromFile(fileName));
+        QVERIFY(clips.back() && clips.back()->frameCount() == frameCount);
+    }
+    auto openMsecs = timer.restart();
+
+    size_t framesPlayed = 0;
+    int checksum = 0;
+    for (auto& clip : clips) {
+        clip->seek(0);
+    }
+    for (Frame::Time position = 0; position <= (Frame::Time)(CLIP_SECONDS * MSECS_PER_SECOND); position += PLAYBACK_STEP) {
+        for (auto& clip : clips) {
+            while (clip->positionFrameTime() <= position) {
+                auto frame = clip->nextFrame();
+                checksum += frame->data[0];
+                ++framesPlayed;
+            }
+        }
+    }
+    auto playMsecs = timer.restart();
+    QVERIFY(framesPlayed == frameCount * PLAYBACK_COUNT);
+
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<Frame::Time> seekTimes(0, CLIP_SECONDS * MSECS_PER_SECOND);
+    for (auto& clip : clips) {
+        for (int i = 0; i < SEEK_COUNT; ++i) {
+            clip->seekFrameTime(seekTimes(generator));
+            if (auto frame = clip->nextFrame()) {
+                checksum += frame->data[0];
+            }
+        }
+    }
+    auto seekMsecs = timer.elapsed();
+
+    qDebug() << "Opened" << PLAYBACK_COUNT << "clips of" << frameCount << "frames in" << openMsecs << "ms";
+    qDebug() << "Played them back concurrently in" << playMsecs << "ms," << framesPlayed << "frames";
+    qDebug() << "Seeked each of them" << SEEK_COUNT << "times in" << seekMsecs << "ms, checksum" << checksum;
+}
+
 int main(int, const char**) {
     setupHifiApplication("Recording Test");
 
     testFrameTypeRegistration();
     testFilePersist();
     testClipOrdering();
+    testIndexedClip();
+    benchmarkConcurrentPlayback();
 }
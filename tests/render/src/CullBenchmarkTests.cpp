@@ -0,0 +1,167 @@
+//
+//  CullBenchmarkTests.cpp
+//  tests/render/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "CullBenchmarkTests.h"
+
+#include <random>
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <ViewFrustum.h>
+#include <render/CullTask.h>
+#include <render/Scene.h>
+
+QTEST_MAIN(CullBenchmarkTests)
+
+const float SCENE_SIZE = 1000.0f;
+const float MIN_ITEM_SIZE = 0.1f;
+const float MAX_ITEM_SIZE = 20.0f;
+const float MIN_SOLID_ANGLE = 0.01f;
+const int NUM_FRAMES = 30;
+
+class CullTestItem {
+public:
+    AABox bound;
+};
+using CullTestItemPayload = render::Payload<CullTestItem>;
+
+namespace render {
+    template <> const ItemKey payloadGetKey(const std::shared_ptr<CullTestItem>& item) {
+        return ItemKey::Builder::opaqueShape();
+    }
+    template <> const Item::Bound payloadGetBound(const std::shared_ptr<CullTestItem>& item, RenderArgs* args) {
+        return item->bound;
+    }
+}
+
+// A scene of randomly placed boxes of many sizes, so that the octree selection has items in all four of its lists
+class CullScene {
+public:
+    CullScene(int numItems) :
+        _scene(std::make_shared<render::Scene>(glm::vec3(-0.5f * SCENE_SIZE), SCENE_SIZE)),
+        _args(nullptr) {
+        std::mt19937 random(numItems);
+        std::uniform_real_distribution<float> position(-0.5f * SCENE_SIZE, 0.5f * SCENE_SIZE - MAX_ITEM_SIZE);
+        std::uniform_real_distribution<float> size(0.0f, 1.0f);
+        render::Transaction transaction;
+        for (int i = 0; i < numItems; ++i) {
+            auto item = std::make_shared<CullTestItem>();
+            // mostly small items, like the entities of a real scene
+            float scale = size(random);
+            item->bound = AABox(glm::vec3(position(random), position(random), position(random)),
+                                MIN_ITEM_SIZE + scale * scale * scale * (MAX_ITEM_SIZE - MIN_ITEM_SIZE));
+            transaction.resetItem(_scene->allocateID(), std::make_shared<CullTestItemPayload>(item));
+        }
+        _scene->enqueueTransaction(transaction);
+        _scene->enqueueFrame();
+        _scene->processTransactionQueue();
+
+        _renderContext = std::make_shared<render::RenderContext>();
+        _renderContext->args = &_args;
+        _renderContext->_scene = _scene;
+        _fetchConfig = std::make_shared<render::FetchSpatialTreeConfig>();
+        _cullConfig = std::make_shared<render::CullSpatialSelectionConfig>();
+    }
+
+    void setView(int frame) {
+        ViewFrustum viewFrustum;
+        viewFrustum.setProjection(glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, SCENE_SIZE));
+        viewFrustum.setPosition(glm::vec3(0.0f, 10.0f, 0.0f));
+        viewFrustum.setOrientation(glm::angleAxis(0.1f * (float)frame, glm::vec3(0.0f, 1.0f, 0.0f)));
+        viewFrustum.calculate();
+        _args.setViewFrustum(viewFrustum);
+    }
+
+    const ViewFrustum& getViewFrustum() const { return _args.getViewFrustum(); }
+
+    render::ItemBounds cull(bool parallel) {
+        render::ItemFilter filter = render::ItemFilter::Builder::opaqueShape().build();
+        render::ItemSpatialTree::ItemSelection selection;
+        _renderContext->jobConfig = _fetchConfig;
+        _fetch.run(_renderContext, render::FetchSpatialTree::Inputs(filter, glm::ivec2(1920, 1080)), selection);
+
+        auto cullFunctor = [](const RenderArgs* args, const AABox& bound) {
+            glm::vec3 eyeToBound = bound.calcCenter() - args->getViewFrustum().getPosition();
+            return bound.getLargestDimension() * bound.getLargestDimension() >
+                MIN_SOLID_ANGLE * MIN_SOLID_ANGLE * glm::dot(eyeToBound, eyeToBound);
+        };
+        render::CullSpatialSelection cullJob(cullFunctor, false, render::RenderDetails::ITEM);
+        _cullConfig->parallel = parallel;
+        cullJob.configure(*_cullConfig);
+        _renderContext->jobConfig = _cullConfig;
+        render::ItemBounds culled;
+        cullJob.run(_renderContext, render::CullSpatialSelection::Inputs(selection, filter), culled);
+        return culled;
+    }
+
+private:
+    render::ScenePointer _scene;
+    RenderArgs _args;
+    render::RenderContextPointer _renderContext;
+    render::FetchSpatialTree _fetch;
+    std::shared_ptr<render::FetchSpatialTreeConfig> _fetchConfig;
+    std::shared_ptr<render::CullSpatialSelectionConfig> _cullConfig;
+};
+
+void CullBenchmarkTests::testParallelCull_data() {
+    QTest::addColumn<int>("numItems");
+    for (int numItems : { 100, 10000, 100000 }) {
+        QTest::newRow(QString("%1 items").arg(numItems).toLatin1().constData()) << numItems;
+    }
+}
+
+void CullBenchmarkTests::testParallelCull() {
+    QFETCH(int, numItems);
+    CullScene scene(numItems);
+    for (int frame = 0; frame < 4; ++frame) {
+        scene.setView(16 * frame);
+        render::ItemBounds serial = scene.cull(false);
+        render::ItemBounds parallel = scene.cull(true);
+        QVERIFY(!serial.empty());
+
+        // the same items, in the same order
+        QCOMPARE(parallel.size(), serial.size());
+        for (size_t i = 0; i < serial.size(); ++i) {
+            QCOMPARE(parallel[i].id, serial[i].id);
+            QVERIFY(parallel[i].bound == serial[i].bound);
+        }
+
+        for (const auto& itemBound : serial) {
+            QVERIFY(scene.getViewFrustum().boxIntersectsFrustum(itemBound.bound));
+        }
+    }
+}
+
+void CullBenchmarkTests::benchmarkCull_data() {
+    QTest::addColumn<int>("numItems");
+    QTest::addColumn<bool>("parallel");
+    for (int numItems : { 10000, 100000 }) {
+        for (bool parallel : { false, true }) {
+            QTest::newRow(QString("%1 items %2").arg(numItems).arg(parallel ? "parallel" : "serial").toLatin1().constData())
+                << numItems << parallel;
+        }
+    }
+}
+
+void CullBenchmarkTests::benchmarkCull() {
+    QFETCH(int, numItems);
+    QFETCH(bool, parallel);
+    CullScene scene(numItems);
+    size_t numCulled = 0;
+    QBENCHMARK {
+        for (int frame = 0; frame < NUM_FRAMES; ++frame) {
+            scene.setView(frame);
+            numCulled = scene.cull(parallel).size();
+        }
+    }
+    qInfo() << numItems << "items," << (parallel ? "parallel:" : "serial:") << numCulled << "in view";
+}
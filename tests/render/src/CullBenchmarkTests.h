@@ -0,0 +1,27 @@
+//
+//  CullBenchmarkTests.h
+//  tests/render/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_CullBenchmarkTests_h
+#define hifi_CullBenchmarkTests_h
+
+#include <QtTest/QtTest>
+
+class CullBenchmarkTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testParallelCull_data();
+    void testParallelCull();
+    void benchmarkCull_data();
+    void benchmarkCull();
+};
+
+#endif // hifi_CullBenchmarkTests_h
@@ -0,0 +1,151 @@
+//
+//  DepthSortBenchmarkTests.cpp
+//  tests/render/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "DepthSortBenchmarkTests.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <ViewFrustum.h>
+#include <render/SortTask.h>
+
+QTEST_MAIN(DepthSortBenchmarkTests)
+
+const float SCENE_SIZE = 1000.0f;
+const float ITEM_SIZE = 1.0f;
+const int NUM_FRAMES = 30;
+
+static render::ItemBounds makeItems(int numItems, std::mt19937& random) {
+    std::uniform_real_distribution<float> position(-0.5f * SCENE_SIZE, 0.5f * SCENE_SIZE);
+    render::ItemBounds items;
+    items.reserve(numItems);
+    for (int i = 0; i < numItems; ++i) {
+        glm::vec3 corner(position(random), position(random), position(random));
+        // ItemID 0 is the invalid item
+        items.emplace_back(render::ItemBound((render::ItemID)(i + 1), AABox(corner, ITEM_SIZE)));
+    }
+    // The culling doesn't output the items in any particular order
+    std::shuffle(items.begin(), items.end(), random);
+    return items;
+}
+
+static void moveCamera(ViewFrustum& viewFrustum, int frame) {
+    viewFrustum.setPosition(glm::vec3(0.5f * (float)frame, 0.0f, 0.25f * (float)frame));
+}
+
+static bool isDepthSorted(const ViewFrustum& viewFrustum, bool frontToBack, const render::ItemBounds& items) {
+    for (size_t i = 1; i < items.size(); ++i) {
+        float previous = viewFrustum.distanceToCameraSquared(items[i - 1].bound.calcCenter());
+        float current = viewFrustum.distanceToCameraSquared(items[i].bound.calcCenter());
+        if (frontToBack ? (current < previous) : (current > previous)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DepthSortBenchmarkTests::testSortOrder_data() {
+    QTest::addColumn<int>("numItems");
+    QTest::addColumn<bool>("frontToBack");
+    QTest::addColumn<bool>("parallel");
+    for (int numItems : { 100, 5000, 50000 }) {
+        for (bool frontToBack : { true, false }) {
+            for (bool parallel : { false, true }) {
+                QTest::newRow(QString("%1 items %2 %3").arg(numItems).arg(frontToBack ? "front to back" : "back to front")
+                    .arg(parallel ? "parallel" : "serial").toLatin1().constData()) << numItems << frontToBack << parallel;
+            }
+        }
+    }
+}
+
+void DepthSortBenchmarkTests::testSortOrder() {
+    QFETCH(int, numItems);
+    QFETCH(bool, frontToBack);
+    QFETCH(bool, parallel);
+
+    std::mt19937 random(numItems);
+    auto items = makeItems(numItems, random);
+    ViewFrustum viewFrustum;
+    render::DepthSorter sorter;
+    size_t previousSize = 0;
+    render::ItemBounds sorted;
+    for (int frame = 0; frame < 3; ++frame) {
+        moveCamera(viewFrustum, frame);
+        sorter.beginFrame();
+        sorter.sort(viewFrustum, frontToBack, true, parallel, items, sorted, previousSize);
+        QCOMPARE(sorted.size(), items.size());
+        QVERIFY(isDepthSorted(viewFrustum, frontToBack, sorted));
+    }
+}
+
+void DepthSortBenchmarkTests::testCoherentSort() {
+    std::mt19937 random(1);
+    auto items = makeItems(20000, random);
+    ViewFrustum viewFrustum;
+    render::DepthSorter sorter;
+    size_t previousSize = 0;
+    render::ItemBounds sorted;
+
+    moveCamera(viewFrustum, 0);
+    sorter.beginFrame();
+    QVERIFY(!sorter.sort(viewFrustum, true, true, true, items, sorted, previousSize).isCoherent);
+
+    // The camera only moves a little, a few items leave and a few others show up
+    render::ItemBounds nextItems(items.begin() + 100, items.end());
+    nextItems.emplace_back(render::ItemBound((render::ItemID)(items.size() + 1), AABox(glm::vec3(10.0f), ITEM_SIZE)));
+    std::shuffle(nextItems.begin(), nextItems.end(), random);
+    moveCamera(viewFrustum, 1);
+    sorter.beginFrame();
+    auto stats = sorter.sort(viewFrustum, true, true, true, nextItems, sorted, previousSize);
+    QVERIFY(stats.isCoherent);
+    QCOMPARE(sorted.size(), nextItems.size());
+    QVERIFY(isDepthSorted(viewFrustum, true, sorted));
+}
+
+void DepthSortBenchmarkTests::benchmarkSort_data() {
+    QTest::addColumn<int>("numItems");
+    QTest::addColumn<int>("mode");
+    for (int numItems : { 1000, 10000, 50000 }) {
+        QTest::newRow(QString("%1 items std::sort").arg(numItems).toLatin1().constData()) << numItems << 0;
+        QTest::newRow(QString("%1 items radix").arg(numItems).toLatin1().constData()) << numItems << 1;
+        QTest::newRow(QString("%1 items coherent").arg(numItems).toLatin1().constData()) << numItems << 2;
+    }
+}
+
+void DepthSortBenchmarkTests::benchmarkSort() {
+    QFETCH(int, numItems);
+    QFETCH(int, mode);
+
+    std::mt19937 random(numItems);
+    auto items = makeItems(numItems, random);
+    ViewFrustum viewFrustum;
+    render::DepthSorter sorter;
+    render::ItemBounds sorted;
+
+    QBENCHMARK {
+        size_t previousSize = 0;
+        for (int frame = 0; frame < NUM_FRAMES; ++frame) {
+            moveCamera(viewFrustum, frame);
+            if (mode == 0) {
+                // What the sort jobs used to do every frame
+                sorted = items;
+                std::sort(sorted.begin(), sorted.end(), [&](const render::ItemBound& left, const render::ItemBound& right) {
+                    return viewFrustum.distanceToCameraSquared(left.bound.calcCenter()) <
+                        viewFrustum.distanceToCameraSquared(right.bound.calcCenter());
+                });
+            } else {
+                sorter.beginFrame();
+                sorter.sort(viewFrustum, true, mode == 2, true, items, sorted, previousSize);
+            }
+        }
+    }
+}
@@ -0,0 +1,28 @@
+//
+//  DepthSortBenchmarkTests.h
+//  tests/render/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_DepthSortBenchmarkTests_h
+#define hifi_DepthSortBenchmarkTests_h
+
+#include <QtTest/QtTest>
+
+class DepthSortBenchmarkTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testSortOrder_data();
+    void testSortOrder();
+    void testCoherentSort();
+    void benchmarkSort_data();
+    void benchmarkSort();
+};
+
+#endif // hifi_DepthSortBenchmarkTests_h
@@ -0,0 +1,133 @@
+//
+//  SceneTransactionBenchmarkTests.cpp
+//  tests/render/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "SceneTransactionBenchmarkTests.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <QElapsedTimer>
+
+#include <render/Scene.h>
+
+QTEST_MAIN(SceneTransactionBenchmarkTests)
+
+const int NUM_ITEMS = 100000;
+const int NUM_PRODUCERS = 8;
+const float SCENE_SIZE = 1000.0f;
+
+class TestItem {
+public:
+    int value { 0 };
+};
+using TestItemPayload = render::Payload<TestItem>;
+
+// Each producer resets its share of the items and then updates every one of them, a few items per transaction
+// like the entity renderers do
+static void produce(render::Scene& scene, const render::ItemIDs& ids, size_t begin, size_t end, int itemsPerTransaction) {
+    render::Transaction transaction;
+    int numPending = 0;
+    auto flush = [&] {
+        scene.enqueueTransaction(std::move(transaction));
+        transaction = render::Transaction();
+        numPending = 0;
+    };
+    for (size_t i = begin; i < end; ++i) {
+        transaction.resetItem(ids[i], std::make_shared<TestItemPayload>(std::make_shared<TestItem>()));
+        if (++numPending == itemsPerTransaction) {
+            flush();
+        }
+    }
+    flush();
+    for (size_t i = begin; i < end; ++i) {
+        int value = (int)i;
+        transaction.updateItem<TestItem>(ids[i], [value](TestItem& item) { item.value = value; });
+        if (++numPending == itemsPerTransaction) {
+            flush();
+        }
+    }
+    flush();
+}
+
+static render::ItemIDs allocateItems(render::Scene& scene, int numItems) {
+    render::ItemIDs ids;
+    ids.reserve(numItems);
+    for (int i = 0; i < numItems; ++i) {
+        ids.push_back(scene.allocateID());
+    }
+    return ids;
+}
+
+void SceneTransactionBenchmarkTests::testTransactionOrder() {
+    // transactions from one thread must be applied in the order they were enqueued, even within one frame
+    render::Scene scene(glm::vec3(0.0f), SCENE_SIZE);
+    render::ItemIDs ids = allocateItems(scene, 1);
+    auto data = std::make_shared<TestItem>();
+    {
+        render::Transaction transaction;
+        transaction.resetItem(ids[0], std::make_shared<TestItemPayload>(data));
+        scene.enqueueTransaction(transaction);
+    }
+    const int NUM_UPDATES = 100;
+    for (int i = 1; i <= NUM_UPDATES; ++i) {
+        render::Transaction transaction;
+        transaction.updateItem<TestItem>(ids[0], [i](TestItem& item) { item.value = i; });
+        scene.enqueueTransaction(std::move(transaction));
+    }
+    scene.enqueueFrame();
+    scene.processTransactionQueue();
+    QVERIFY(scene.getItem(ids[0]).exist());
+    QCOMPARE(data->value, NUM_UPDATES);
+}
+
+void SceneTransactionBenchmarkTests::benchmarkEnqueue_data() {
+    QTest::addColumn<int>("itemsPerTransaction");
+    QTest::newRow("1 item per transaction") << 1;
+    QTest::newRow("16 items per transaction") << 16;
+    QTest::newRow("256 items per transaction") << 256;
+}
+
+void SceneTransactionBenchmarkTests::benchmarkEnqueue() {
+    QFETCH(int, itemsPerTransaction);
+    render::Scene scene(glm::vec3(0.0f), SCENE_SIZE);
+    render::ItemIDs ids = allocateItems(scene, NUM_ITEMS);
+
+    QElapsedTimer timer;
+    qint64 enqueueNsecs = 0;
+    qint64 processNsecs = 0;
+    QBENCHMARK_ONCE {
+        timer.start();
+        std::vector<std::thread> producers;
+        size_t numPerProducer = (ids.size() + NUM_PRODUCERS - 1) / NUM_PRODUCERS;
+        for (int p = 0; p < NUM_PRODUCERS; ++p) {
+            size_t begin = std::min(ids.size(), (size_t)p * numPerProducer);
+            size_t end = std::min(ids.size(), begin + numPerProducer);
+            producers.emplace_back(produce, std::ref(scene), std::cref(ids), begin, end, itemsPerTransaction);
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+        enqueueNsecs = timer.nsecsElapsed();
+
+        timer.start();
+        scene.enqueueFrame();
+        scene.processTransactionQueue();
+        processNsecs = timer.nsecsElapsed();
+    }
+    qInfo() << NUM_ITEMS << "items," << NUM_PRODUCERS << "producers," << itemsPerTransaction << "items/transaction: enqueue"
+        << (float)enqueueNsecs / 1.0e6f << "msec, frame" << (float)processNsecs / 1.0e6f << "msec";
+
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const render::Item& item = scene.getItem(ids[i]);
+        QVERIFY(item.exist());
+    }
+}
@@ -0,0 +1,26 @@
+//
+//  SceneTransactionBenchmarkTests.h
+//  tests/render/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_SceneTransactionBenchmarkTests_h
+#define hifi_SceneTransactionBenchmarkTests_h
+
+#include <QtTest/QtTest>
+
+class SceneTransactionBenchmarkTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testTransactionOrder();
+    void benchmarkEnqueue_data();
+    void benchmarkEnqueue();
+};
+
+#endif // hifi_SceneTransactionBenchmarkTests_h
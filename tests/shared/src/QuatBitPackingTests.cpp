@@ -0,0 +1,158 @@
+//
+//  QuatBitPackingTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "QuatBitPackingTests.h"
+
+#include <vector>
+
+#include <test-utils/QTestExtensions.h>
+
+#include <BitStream.h>
+#include <GLMHelpers.h>
+#include <NumericalConstants.h>
+#include <glm/gtc/random.hpp>
+
+QTEST_MAIN(QuatBitPackingTests)
+
+// angle between two orientations, in degrees
+static float angleBetween(const glm::quat& a, const glm::quat& b) {
+    float dot = glm::min(fabsf(glm::dot(a, b)), 1.0f);
+    return 2.0f * acosf(dot) * DEGREES_PER_RADIAN;
+}
+
+static glm::quat randomOrientation() {
+    return glm::normalize(glm::quat(glm::linearRand(-1.0f, 1.0f), glm::linearRand(-1.0f, 1.0f),
+                                    glm::linearRand(-1.0f, 1.0f), glm::linearRand(-1.0f, 1.0f)));
+}
+
+void QuatBitPackingTests::testBitStream() {
+    uint8_t buffer[8];
+    BitWriter writer(buffer, sizeof(buffer));
+    writer.write(0x3, 2);
+    writer.write(0x1234, 15);
+    writer.write(0x0, 1);
+    writer.write(0xabcdef, 24);
+    QCOMPARE(writer.getNumBits(), 42);
+    QCOMPARE(writer.getNumBytes(), 6);
+    QVERIFY(!writer.hasOverflowed());
+
+    writer.write(0xffffff, 23);
+    QVERIFY(writer.hasOverflowed());
+    QCOMPARE(writer.getNumBits(), 42);
+
+    BitReader reader(buffer, writer.getNumBytes());
+    QCOMPARE(reader.read(2), (uint32_t)0x3);
+    QCOMPARE(reader.read(15), (uint32_t)0x1234);
+    reader.skip(1);
+    QCOMPARE(reader.read(24), (uint32_t)0xabcdef);
+    QVERIFY(!reader.hasOverflowed());
+    QCOMPARE(reader.read(7), (uint32_t)0);
+    QVERIFY(reader.hasOverflowed());
+}
+
+void QuatBitPackingTests::testOrientationBits() {
+    const int NUM_SAMPLES = 1000;
+    const int BITS_PER_COMPONENT[] = { 15, 12, 9 };
+    // smallest three components are in -1/sqrt(2)..1/sqrt(2), so the angular error roughly doubles per bit dropped
+    const float MAX_ERROR_DEGREES[] = { 0.01f, 0.06f, 0.5f };
+
+    for (int level = 0; level < 3; level++) {
+        int bits = BITS_PER_COMPONENT[level];
+        for (int i = 0; i < NUM_SAMPLES; i++) {
+            glm::quat q = randomOrientation();
+            uint8_t buffer[8];
+            BitWriter writer(buffer, sizeof(buffer));
+            packOrientationQuatToBits(writer, q, bits);
+            QCOMPARE(writer.getNumBits(), 2 + 3 * bits);
+
+            glm::quat result;
+            BitReader reader(buffer, writer.getNumBytes());
+            unpackOrientationQuatFromBits(reader, result, bits);
+            QVERIFY(angleBetween(q, result) < MAX_ERROR_DEGREES[level]);
+        }
+    }
+}
+
+void QuatBitPackingTests::testOrientationDeltaBits() {
+    const int NUM_SAMPLES = 1000;
+    const int BITS = 10;
+    const float MAX_COMPONENT = 0.125f;
+    const float MAX_ERROR_DEGREES = 0.05f;
+
+    for (int i = 0; i < NUM_SAMPLES; i++) {
+        glm::quat reference = randomOrientation();
+        glm::quat delta = glm::angleAxis(glm::linearRand(0.0f, 12.0f) * RADIANS_PER_DEGREE, glm::sphericalRand(1.0f));
+        glm::quat q = reference * delta;
+        if (i % 2) {
+            q = -q; // same orientation, other hemisphere
+        }
+        QVERIFY(isOrientationQuatDeltaInRange(reference, q, MAX_COMPONENT));
+
+        uint8_t buffer[8];
+        BitWriter writer(buffer, sizeof(buffer));
+        packOrientationQuatDeltaToBits(writer, reference, q, BITS, MAX_COMPONENT);
+        QCOMPARE(writer.getNumBits(), 3 * BITS);
+
+        glm::quat result;
+        BitReader reader(buffer, writer.getNumBytes());
+        unpackOrientationQuatDeltaFromBits(reader, reference, result, BITS, MAX_COMPONENT);
+        QVERIFY(angleBetween(q, result) < MAX_ERROR_DEGREES);
+    }
+
+    glm::quat farAway = glm::angleAxis(PI / 2.0f, glm::vec3(0.0f, 1.0f, 0.0f));
+    QVERIFY(!isOrientationQuatDeltaInRange(Quaternions::IDENTITY, farAway, MAX_COMPONENT));
+}
+
+// compares the size of a stream of slowly changing joint rotations in the six byte encoding and in the compact
+// encoding used by the avatar mixer (a keyframe followed by deltas)
+void QuatBitPackingTests::jointStreamSize() {
+    const int NUM_JOINTS = 64;
+    const int NUM_FRAMES = 50;
+    const int MAX_FRAME_BYTES = NUM_JOINTS * 8;
+
+    std::vector<glm::quat> pose(NUM_JOINTS);
+    for (auto& rotation : pose) {
+        rotation = randomOrientation();
+    }
+    std::vector<glm::quat> keyframe = pose;
+
+    int sixByteSize = 0;
+    int compactSize = 0;
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        for (auto& rotation : pose) {
+            rotation = glm::normalize(rotation * glm::angleAxis(glm::linearRand(0.0f, 0.5f) * RADIANS_PER_DEGREE,
+                                                                glm::sphericalRand(1.0f)));
+        }
+
+        uint8_t buffer[MAX_FRAME_BYTES];
+        for (const auto& rotation : pose) {
+            sixByteSize += packOrientationQuatToSixBytes(buffer, rotation);
+        }
+
+        BitWriter writer(buffer, MAX_FRAME_BYTES);
+        for (int i = 0; i < NUM_JOINTS; i++) {
+            writer.write(0, 2);
+            if (frame == 0) {
+                packOrientationQuatToBits(writer, pose[i], 15);
+            } else {
+                QVERIFY(isOrientationQuatDeltaInRange(keyframe[i], pose[i], 0.125f));
+                packOrientationQuatDeltaToBits(writer, keyframe[i], pose[i], 10, 0.125f);
+            }
+        }
+        QVERIFY(!writer.hasOverflowed());
+        compactSize += writer.getNumBytes();
+    }
+
+    float sixByteBitsPerJoint = (float)(sixByteSize * BITS_IN_BYTE) / (NUM_FRAMES * NUM_JOINTS);
+    float compactBitsPerJoint = (float)(compactSize * BITS_IN_BYTE) / (NUM_FRAMES * NUM_JOINTS);
+    qDebug() << "bits per joint rotation: six bytes" << sixByteBitsPerJoint << "compact" << compactBitsPerJoint;
+    QVERIFY(compactBitsPerJoint < 0.75f * sixByteBitsPerJoint);
+}
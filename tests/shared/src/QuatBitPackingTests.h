@@ -0,0 +1,26 @@
+//
+//  QuatBitPackingTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_QuatBitPackingTests_h
+#define hifi_QuatBitPackingTests_h
+
+#include <QtTest/QtTest>
+
+class QuatBitPackingTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testBitStream();
+    void testOrientationBits();
+    void testOrientationDeltaBits();
+    void jointStreamSize();
+};
+
+#endif // hifi_QuatBitPackingTests_h
@@ -8,9 +8,14 @@
 
 #include "TraceTests.h"
 
+#include <atomic>
+#include <thread>
+
+#include <QtCore/QTemporaryDir>
 #include <QtTest/QtTest>
 #include <QtGui/QDesktopServices>
 
+#include <PerfStat.h>
 #include <Profile.h>
 
 #include <NumericalConstants.h>
@@ -45,3 +50,196 @@ void TraceTests::testTraceSerialization() {
     qDebug() << "Done";
 }
 
+
+static QJsonArray findEvents(const QByteArray& dump, const QString& name) {
+    QJsonArray result;
+    auto events = QJsonDocument::fromJson(tracing::Tracer::toChromeTrace(dump)).array();
+    for (const auto& event : events) {
+        if (event.toObject()["name"].toString() == name) {
+            result.append(event);
+        }
+    }
+    return result;
+}
+
+void TraceTests::testChromeTraceConversion() {
+    auto tracer = DependencyManager::set<tracing::Tracer>();
+    tracer->startRecording();
+    auto start = tracing::Tracer::now();
+    {
+        PROFILE_RANGE_EX(test, "ConvertedRange", 0xff0000ff, 42)
+        PerformanceTimer timer("ConvertedTimer");
+        PROFILE_COUNTER(test, "ConvertedCounter", { { "count", 3 }, { "label", "three \"quoted\"" } })
+        PROFILE_ASYNC_BEGIN(test, "ConvertedAsync", "someID")
+    }
+    tracer->stopRecording();
+    auto dump = tracer->dump(start);
+
+    auto range = findEvents(dump, "ConvertedRange");
+    QCOMPARE(range.size(), 2);
+    QCOMPARE(range[0].toObject()["ph"].toString(), QString("B"));
+    QCOMPARE(range[0].toObject()["cat"].toString(), QString("trace.test"));
+    QCOMPARE(range[0].toObject()["args"].toObject()["nv_payload"].toInt(), 42);
+    QCOMPARE(range[1].toObject()["ph"].toString(), QString("E"));
+    QVERIFY(range[1].toObject()["ts"].toDouble() >= range[0].toObject()["ts"].toDouble());
+
+    auto timer = findEvents(dump, "ConvertedTimer");
+    QCOMPARE(timer.size(), 1);
+    QCOMPARE(timer[0].toObject()["ph"].toString(), QString("X"));
+    QVERIFY(timer[0].toObject().contains("dur"));
+
+    auto counter = findEvents(dump, "ConvertedCounter");
+    QCOMPARE(counter.size(), 1);
+    auto args = counter[0].toObject()["args"].toObject();
+    QCOMPARE(args["count"].toInt(), 3);
+    QCOMPARE(args["label"].toString(), QString("three \"quoted\""));
+
+    auto async = findEvents(dump, "ConvertedAsync");
+    QCOMPARE(async.size(), 1);
+    QVERIFY(async[0].toObject()["id"].toString().startsWith("0x"));
+
+    // nothing recorded before the requested time makes it into the dump
+    QVERIFY(findEvents(tracer->dump(tracing::Tracer::now() + USECS_PER_SECOND), "ConvertedRange").isEmpty());
+    QVERIFY(tracing::Tracer::toChromeTrace("not a trace").isEmpty());
+}
+
+void TraceTests::testRingOverwrite() {
+    const size_t EVENTS_PER_THREAD = 64;
+    const int NUM_EVENTS = 1000;
+
+    auto tracer = DependencyManager::set<tracing::Tracer>();
+    tracer->setEventsPerThread(EVENTS_PER_THREAD);
+    tracer->startRecording();
+
+    auto start = tracing::Tracer::now();
+    std::thread thread([&] {
+        auto name = tracing::internName("RingEvent");
+        auto argument = tracing::internName("i");
+        for (int i = 0; i < NUM_EVENTS; ++i) {
+            tracing::Tracer::traceEvent(trace_test(), name, tracing::Instant, tracing::Tracer::now(), argument, i);
+        }
+    });
+    thread.join();
+    tracer->stopRecording();
+    tracer->setEventsPerThread(tracing::Tracer::DEFAULT_EVENTS_PER_THREAD);
+
+    // the ring of a thread that exited is still dumped, with only its latest events
+    auto events = findEvents(tracer->dump(start), "RingEvent");
+    QCOMPARE(events.size(), (int)EVENTS_PER_THREAD);
+    QCOMPARE(events.first().toObject()["args"].toObject()["i"].toInt(), NUM_EVENTS - (int)EVENTS_PER_THREAD);
+    QCOMPARE(events.last().toObject()["args"].toObject()["i"].toInt(), NUM_EVENTS - 1);
+}
+
+void TraceTests::testConcurrentDump() {
+    const size_t EVENTS_PER_THREAD = 256;
+    const int NUM_DUMPS = 200;
+
+    auto tracer = DependencyManager::set<tracing::Tracer>();
+    tracer->setEventsPerThread(EVENTS_PER_THREAD);
+    tracer->startRecording();
+
+    // every event's timestamp matches its argument, so a torn record shows as a mismatch
+    std::atomic<bool> done { false };
+    std::thread thread([&] {
+        auto name = tracing::internName("ConcurrentEvent");
+        auto argument = tracing::internName("i");
+        for (int64_t i = 1; !done; ++i) {
+            tracing::Tracer::traceEvent(trace_test(), name, tracing::Instant, i, argument, (double)i);
+        }
+    });
+
+    int numEvents = 0;
+    for (int dump = 0; dump < NUM_DUMPS; ++dump) {
+        auto events = findEvents(tracer->dump(0), "ConcurrentEvent");
+        QVERIFY(events.size() <= (int)EVENTS_PER_THREAD);
+        double previous = 0.0;
+        for (const auto& event : events) {
+            auto timestamp = event.toObject()["ts"].toDouble();
+            QCOMPARE(event.toObject()["args"].toObject()["i"].toDouble(), timestamp);
+            QVERIFY(timestamp > previous);
+            previous = timestamp;
+        }
+        numEvents += events.size();
+    }
+    done = true;
+    thread.join();
+    tracer->stopRecording();
+    tracer->setEventsPerThread(tracing::Tracer::DEFAULT_EVENTS_PER_THREAD);
+
+    QVERIFY(numEvents > 0);
+}
+
+void TraceTests::testTraceKeepsEveryEvent() {
+    const size_t EVENTS_PER_THREAD = 64;
+    const int NUM_EVENTS = 10000;
+
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    const QString traceFile = directory.filePath("trace.json");
+
+    auto tracer = DependencyManager::set<tracing::Tracer>();
+    tracer->setEventsPerThread(EVENTS_PER_THREAD);
+    tracer->startTracing();
+    std::thread thread([&] {
+        for (int i = 0; i < NUM_EVENTS; ++i) {
+            PROFILE_INSTANT(test, "TracedEvent", "t", { { "i", i } })
+        }
+    });
+    thread.join();
+    tracer->stopTracing();
+    tracer->serialize(traceFile);
+    tracer->setEventsPerThread(tracing::Tracer::DEFAULT_EVENTS_PER_THREAD);
+
+    // none of the events of the trace are overwritten, although the thread is gone and recorded more than a ring holds
+    QFile file(traceFile);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    auto events = QJsonDocument::fromJson(file.readAll()).array();
+    int i = 0;
+    for (const auto& event : events) {
+        if (event.toObject()["name"].toString() == "TracedEvent") {
+            QCOMPARE(event.toObject()["args"].toObject()["i"].toInt(), i);
+            ++i;
+        }
+    }
+    QCOMPARE(i, NUM_EVENTS);
+}
+
+void TraceTests::testStringValuesAreNotInterned() {
+    const int NUM_EVENTS = (int)tracing::MAX_TRACE_NAMES + 1000;
+
+    auto tracer = DependencyManager::set<tracing::Tracer>();
+    tracer->startRecording();
+    auto start = tracing::Tracer::now();
+    for (int i = 0; i < NUM_EVENTS; ++i) {
+        PROFILE_INSTANT(test, "StringEvent", "t", { { "url", QString("https://example.com/%1").arg(i) } })
+    }
+    tracer->stopRecording();
+
+    // unique values don't use up the names
+    QVERIFY(tracing::internName(QString("NameAfterStrings")) != tracing::TRACE_NAME_OVERFLOW);
+
+    auto events = findEvents(tracer->dump(start), "StringEvent");
+    QVERIFY(!events.isEmpty());
+    QCOMPARE(events.last().toObject()["args"].toObject()["url"].toString(),
+             QString("https://example.com/%1").arg(NUM_EVENTS - 1));
+}
+
+void TraceTests::benchmarkTraceEvent() {
+    const int NUM_RANGES = 1000000;
+
+    auto tracer = DependencyManager::set<tracing::Tracer>();
+    auto measure = [&] {
+        auto start = usecTimestampNow();
+        for (int i = 0; i < NUM_RANGES; ++i) {
+            PROFILE_RANGE(test, "BenchmarkRange")
+        }
+        return (double)(usecTimestampNow() - start) * NSECS_PER_USEC / (2 * NUM_RANGES);
+    };
+
+    auto disabledCost = measure();
+    tracer->startRecording();
+    auto recordingCost = measure();
+    tracer->stopRecording();
+
+    qDebug() << "Trace events cost" << recordingCost << "ns each while recording and" << disabledCost << "ns when not";
+}
@@ -15,6 +15,12 @@ class TraceTests : public QObject {
     Q_OBJECT
 private slots:
     void testTraceSerialization();
+    void testChromeTraceConversion();
+    void testRingOverwrite();
+    void testConcurrentDump();
+    void testTraceKeepsEveryEvent();
+    void testStringValuesAreNotInterned();
+    void benchmarkTraceEvent();
 };
 
 #endif // hifi_TraceTests_h
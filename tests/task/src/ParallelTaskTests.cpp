@@ -0,0 +1,137 @@
+//
+//  ParallelTaskTests.cpp
+//  tests/task/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ParallelTaskTests.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <task/Task.h>
+
+QTEST_MAIN(ParallelTaskTests)
+
+const int NUM_JOBS = 8;
+const int SLEEP_MSECS_PER_JOB = 2;
+
+// Each job records its index, the way render jobs record batches
+class TestContext : public task::JobContext {
+public:
+    std::vector<int> records;
+};
+using TestContextPointer = std::shared_ptr<TestContext>;
+
+namespace task {
+    template <>
+    class ParallelContext<TestContext> {
+    public:
+        using ContextPointer = TestContextPointer;
+
+        static ContextPointer fork(const ContextPointer& jobContext) { return std::make_shared<TestContext>(); }
+        template <class J> static void run(J& job, const ContextPointer& forkContext) { job.run(forkContext); }
+        static void join(const ContextPointer& jobContext, const ContextPointer& forkContext) {
+            jobContext->records.insert(jobContext->records.end(), forkContext->records.begin(), forkContext->records.end());
+        }
+    };
+}
+
+class TestTimeProfiler {
+public:
+    TestTimeProfiler(const std::string& label) {}
+};
+
+namespace test {
+    Task_DeclareTypeAliases(TestContext, TestTimeProfiler)
+}
+
+class RecordJob {
+public:
+    using JobModel = test::Job::Model<RecordJob>;
+
+    RecordJob(int index, int sleepMsecs, bool abort = false) : _index(index), _sleepMsecs(sleepMsecs), _abort(abort) {}
+
+    void run(const TestContextPointer& jobContext) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(_sleepMsecs));
+        jobContext->records.push_back(_index);
+        if (_abort) {
+            jobContext->taskFlow.abortTask();
+        }
+    }
+
+private:
+    int _index;
+    int _sleepMsecs;
+    bool _abort;
+};
+
+class RecordParallel {
+public:
+    using JobModel = test::Parallel::Model<RecordParallel>;
+
+    void build(JobModel& parallel, const test::Varying& inputs, test::Varying& outputs, int abortIndex) {
+        for (int i = 0; i < NUM_JOBS; ++i) {
+            // The first jobs take the longest so they would be the last ones done
+            parallel.addJob<RecordJob>("Record" + std::to_string(i), i, (NUM_JOBS - i) * SLEEP_MSECS_PER_JOB, i == abortIndex);
+        }
+    }
+};
+
+static std::vector<int> expectedRecords() {
+    std::vector<int> records;
+    for (int i = 0; i < NUM_JOBS; ++i) {
+        records.push_back(i);
+    }
+    return records;
+}
+
+void ParallelTaskTests::testJoinOrder() {
+    test::Job job(RecordParallel::JobModel::create("RecordParallel", -1));
+    for (int run = 0; run < 3; ++run) {
+        auto context = std::make_shared<TestContext>();
+        job.run(context);
+        QVERIFY(context->records == expectedRecords());
+        QVERIFY(!context->taskFlow.doAbortTask());
+    }
+}
+
+void ParallelTaskTests::testSequentialFallback() {
+    test::Job job(RecordParallel::JobModel::create("RecordParallel", -1));
+    auto config = std::static_pointer_cast<task::ParallelConfig>(job.getConfiguration());
+    config->parallel = false;
+
+    auto context = std::make_shared<TestContext>();
+    job.run(context);
+    QVERIFY(context->records == expectedRecords());
+}
+
+void ParallelTaskTests::testCPURunTimes() {
+    test::Job job(RecordParallel::JobModel::create("RecordParallel", -1));
+    auto context = std::make_shared<TestContext>();
+    job.run(context);
+
+    // Every child reports its own run time through its config, as it would in a sequential task
+    for (int i = 0; i < NUM_JOBS; ++i) {
+        auto childConfig = job.getConfiguration()->getJobConfig("Record" + std::to_string(i));
+        QVERIFY(childConfig);
+        QVERIFY(childConfig->getCPURunTime() >= (double)((NUM_JOBS - i) * SLEEP_MSECS_PER_JOB));
+    }
+    QVERIFY(job.getConfiguration()->getCPURunTime() >= (double)(NUM_JOBS * SLEEP_MSECS_PER_JOB));
+}
+
+void ParallelTaskTests::testAbortForwarded() {
+    test::Job job(RecordParallel::JobModel::create("RecordParallel", 3));
+    auto context = std::make_shared<TestContext>();
+    job.run(context);
+
+    // The other children still ran, the abort is left for the parent task to act on
+    QVERIFY(context->records == expectedRecords());
+    QVERIFY(context->taskFlow.doAbortTask());
+}
@@ -0,0 +1,27 @@
+//
+//  ParallelTaskTests.h
+//  tests/task/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_ParallelTaskTests_h
+#define hifi_ParallelTaskTests_h
+
+#include <QtTest/QtTest>
+
+class ParallelTaskTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testJoinOrder();
+    void testSequentialFallback();
+    void testCPURunTimes();
+    void testAbortForwarded();
+};
+
+#endif // hifi_ParallelTaskTests_h
@@ -0,0 +1,190 @@
+//
+//  SpaceBenchmarkTests.cpp
+//  tests/workload/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "SpaceBenchmarkTests.h"
+
+#include <random>
+#include <vector>
+
+#include <QElapsedTimer>
+#include <QThread>
+
+#include <TBBHelpers.h>
+#include <tbb/task_arena.h>
+
+#include <workload/Space.h>
+
+QTEST_MAIN(SpaceBenchmarkTests)
+
+const float WORLD_WIDTH = 1000.0f;
+const float MIN_RADIUS = 0.1f;
+const float MAX_RADIUS = 10.0f;
+
+static std::vector<workload::Sphere> generateSpheres(uint32_t numProxies, uint32_t seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> position(-0.5f * WORLD_WIDTH, 0.5f * WORLD_WIDTH);
+    std::uniform_real_distribution<float> radius(MIN_RADIUS, MAX_RADIUS);
+    std::vector<workload::Sphere> spheres;
+    spheres.reserve(numProxies);
+    for (uint32_t i = 0; i < numProxies; ++i) {
+        spheres.push_back(workload::Sphere(position(generator), position(generator), position(generator), radius(generator)));
+    }
+    return spheres;
+}
+
+static workload::View makeView(const glm::vec3& origin) {
+    workload::View view;
+    view.origin = origin;
+    const float REGION_RADII[workload::Region::NUM_TRACKED_REGIONS] = { 0.05f * WORLD_WIDTH, 0.1f * WORLD_WIDTH, 0.25f * WORLD_WIDTH };
+    for (uint32_t k = 0; k < workload::Region::NUM_TRACKED_REGIONS; ++k) {
+        view.regions[k] = workload::Sphere(origin, REGION_RADII[k]);
+    }
+    return view;
+}
+
+static std::vector<workload::ProxyID> addProxies(workload::Space& space, const std::vector<workload::Sphere>& spheres) {
+    std::vector<workload::ProxyID> ids;
+    ids.reserve(spheres.size());
+    workload::Transaction transaction;
+    for (const auto& sphere : spheres) {
+        workload::ProxyID id = space.allocateID();
+        transaction.reset(id, sphere, workload::Owner());
+        ids.push_back(id);
+    }
+    space.enqueueTransaction(std::move(transaction));
+    space.enqueueFrame();
+    space.processTransactionQueue();
+    return ids;
+}
+
+// the classification as it was done before it was vectorized and parallelized
+static uint8_t referenceRegion(const workload::Sphere& sphere, const workload::Views& views) {
+    uint8_t region = workload::Region::R4;
+    for (const auto& view : views) {
+        for (uint8_t k = 0; k < region; ++k) {
+            float touchDistance = sphere.w + view.regions[k].w;
+            glm::vec3 offset = glm::vec3(sphere) - glm::vec3(view.regions[k]);
+            if (glm::dot(offset, offset) < touchDistance * touchDistance) {
+                region = k;
+                break;
+            }
+        }
+    }
+    return region;
+}
+
+void SpaceBenchmarkTests::testCategorize() {
+    const uint32_t NUM_PROXIES = 20000;
+    workload::Space space;
+    std::vector<workload::Sphere> spheres = generateSpheres(NUM_PROXIES, 1);
+    std::vector<workload::ProxyID> ids = addProxies(space, spheres);
+
+    workload::Views views;
+    views.push_back(makeView(glm::vec3(0.0f)));
+    views.push_back(makeView(glm::vec3(100.0f, 0.0f, 0.0f)));
+    space.setViews(views);
+
+    // every new proxy leaves UNKNOWN
+    workload::Changes changes;
+    space.categorizeAndGetChanges(changes);
+    QCOMPARE((uint32_t)changes.size(), NUM_PROXIES);
+    for (uint32_t i = 0; i < NUM_PROXIES; ++i) {
+        QCOMPARE(changes[i].proxyId, ids[i]);
+        QCOMPARE(changes[i].prevRegion, (uint8_t)workload::Region::UNKNOWN);
+        QCOMPARE(changes[i].region, referenceRegion(spheres[i], views));
+    }
+
+    // move the views: only the proxies whose region differs are reported, in order
+    std::vector<uint8_t> prevRegions;
+    for (uint32_t i = 0; i < NUM_PROXIES; ++i) {
+        prevRegions.push_back(space.getRegion(ids[i]));
+    }
+    views[0] = makeView(glm::vec3(0.0f, 30.0f, 0.0f));
+    views.pop_back();
+    space.setViews(views);
+    changes.clear();
+    space.categorizeAndGetChanges(changes);
+    size_t c = 0;
+    for (uint32_t i = 0; i < NUM_PROXIES; ++i) {
+        uint8_t region = referenceRegion(spheres[i], views);
+        QCOMPARE(space.getRegion(ids[i]), region);
+        if (region != prevRegions[i]) {
+            QVERIFY(c < changes.size());
+            QCOMPARE(changes[c].proxyId, ids[i]);
+            QCOMPARE(changes[c].region, region);
+            QCOMPARE(changes[c].prevRegion, prevRegions[i]);
+            ++c;
+        }
+    }
+    QCOMPARE(c, changes.size());
+    QVERIFY(c > 0);
+
+    // removed proxies are no longer categorized
+    workload::Transaction transaction;
+    transaction.remove(ids[0]);
+    space.enqueueTransaction(std::move(transaction));
+    space.enqueueFrame();
+    space.processTransactionQueue();
+    views[0] = makeView(glm::vec3(glm::vec3(spheres[0])));
+    space.setViews(views);
+    changes.clear();
+    space.categorizeAndGetChanges(changes);
+    for (const auto& change : changes) {
+        QVERIFY(change.proxyId != ids[0]);
+    }
+    QCOMPARE(space.getRegion(ids[0]), (uint8_t)workload::Region::INVALID);
+}
+
+void SpaceBenchmarkTests::benchmarkCategorize_data() {
+    QTest::addColumn<uint32_t>("numProxies");
+    QTest::addColumn<int>("numThreads");
+    const uint32_t NUM_PROXIES[] = { 100000, 300000, 1000000 };
+    int maxThreads = QThread::idealThreadCount();
+    for (uint32_t numProxies : NUM_PROXIES) {
+        for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+            QTest::newRow(QString("%1 proxies, %2 threads").arg(numProxies).arg(numThreads).toLatin1().constData())
+                << numProxies << numThreads;
+        }
+    }
+}
+
+void SpaceBenchmarkTests::benchmarkCategorize() {
+    QFETCH(uint32_t, numProxies);
+    QFETCH(int, numThreads);
+    const int NUM_FRAMES = 20;
+
+    workload::Space space;
+    addProxies(space, generateSpheres(numProxies, 2));
+    workload::Views views;
+    views.push_back(makeView(glm::vec3(0.0f)));
+    views.push_back(makeView(glm::vec3(0.0f, 0.0f, 0.1f * WORLD_WIDTH)));
+
+    tbb::task_arena arena(numThreads);
+    workload::Changes changes;
+    QElapsedTimer timer;
+    QBENCHMARK_ONCE {
+        timer.start();
+        arena.execute([&] {
+            for (int frame = 0; frame < NUM_FRAMES; ++frame) {
+                // walk the views so that every frame has some changes to report
+                for (auto& view : views) {
+                    view = makeView(view.origin + glm::vec3(1.0f, 0.0f, 0.0f));
+                }
+                space.setViews(views);
+                changes.clear();
+                space.categorizeAndGetChanges(changes);
+            }
+        });
+    }
+    float msecPerFrame = (float)timer.nsecsElapsed() / (1.0e6f * (float)NUM_FRAMES);
+    qInfo() << numProxies << "proxies," << numThreads << "threads:" << msecPerFrame << "msec/frame,"
+        << changes.size() << "changes in the last frame";
+}
@@ -0,0 +1,26 @@
+//
+//  SpaceBenchmarkTests.h
+//  tests/workload/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_workload_SpaceBenchmarkTests_h
+#define hifi_workload_SpaceBenchmarkTests_h
+
+#include <QtTest/QtTest>
+
+class SpaceBenchmarkTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testCategorize();
+    void benchmarkCategorize_data();
+    void benchmarkCategorize();
+};
+
+#endif // hifi_workload_SpaceBenchmarkTests_h
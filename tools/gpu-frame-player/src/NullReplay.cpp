@@ -0,0 +1,83 @@
+//
+//  NullReplay.cpp
+//  tools/gpu-frame-player/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "NullReplay.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTextStream>
+
+#include <gpu/Context.h>
+#include <gpu/Frame.h>
+#include <gpu/FrameIO.h>
+#include <gpu/null/NullBackend.h>
+#include <test-utils/AllocationCounter.h>
+
+int replayFrameHeadless(const QString& path, int numFrames) {
+    QTextStream out(stdout);
+
+    gpu::Context::init<gpu::null::Backend>();
+    auto gpuContext = std::make_shared<gpu::Context>();
+    auto backend = std::static_pointer_cast<gpu::null::Backend>(gpuContext->getBackend());
+    gpu::null::Backend::setAllocationCounter(&getAllocationCount);
+
+    auto frame = gpu::readFrame(path.toStdString(), 0);
+    if (!frame) {
+        out << "Unable to read frame " << path << Qt::endl;
+        return 1;
+    }
+    gpuContext->consumeFrameUpdates(frame);
+
+    // The first replay warms up the batch caches and the backend state, it isn't measured
+    gpuContext->executeFrame(frame);
+    backend->resetCommandStats();
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < numFrames; ++i) {
+        gpuContext->executeFrame(frame);
+    }
+    double msecPerFrame = (double)timer.nsecsElapsed() / (1.0e6 * (double)std::max(numFrames, 1));
+
+    const auto& commandStats = backend->getCommandStats();
+    std::vector<int> commands;
+    for (int i = 0; i < gpu::Batch::NUM_COMMANDS; ++i) {
+        if (commandStats[i].count > 0) {
+            commands.push_back(i);
+        }
+    }
+    std::sort(commands.begin(), commands.end(), [&](int a, int b) { return commandStats[a].nsecs > commandStats[b].nsecs; });
+
+    uint64_t totalNsecs = 0;
+    uint64_t totalAllocations = 0;
+    out << qSetFieldWidth(40) << Qt::left << "command" << qSetFieldWidth(14) << Qt::right
+        << "count/frame" << "usec/frame" << "nsec/command" << "allocs/frame" << qSetFieldWidth(0) << Qt::endl;
+    for (int command : commands) {
+        const auto& stats = commandStats[command];
+        totalNsecs += stats.nsecs;
+        totalAllocations += stats.allocations;
+        out << qSetFieldWidth(40) << Qt::left << gpu::null::Backend::getCommandName((gpu::Batch::Command)command)
+            << qSetFieldWidth(14) << Qt::right
+            << (double)stats.count / numFrames
+            << (double)stats.nsecs / (1.0e3 * numFrames)
+            << (double)stats.nsecs / (double)stats.count
+            << (double)stats.allocations / numFrames
+            << qSetFieldWidth(0) << Qt::endl;
+    }
+    out << frame->batches.size() << " batches, " << numFrames << " frames: " << msecPerFrame << " msec/frame, "
+        << (double)totalNsecs / (1.0e6 * numFrames) << " msec/frame in commands, "
+        << (double)totalAllocations / numFrames << " allocations/frame in commands" << Qt::endl;
+
+    gpuContext->shutdown();
+    return 0;
+}
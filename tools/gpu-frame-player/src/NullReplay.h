@@ -0,0 +1,18 @@
+//
+//  NullReplay.h
+//  tools/gpu-frame-player/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <QtCore/QString>
+
+// Replays a captured frame numFrames times against the null gpu backend, without a window or a GPU, and prints
+// the CPU cost and heap allocations of each command type.  Returns the process exit code.
+int replayFrameHeadless(const QString& path, int numFrames);
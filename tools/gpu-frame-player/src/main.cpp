@@ -7,9 +7,11 @@
 //
 
 #include <QtWidgets/QApplication>
+#include <QtCore/QCommandLineParser>
 #include <QtCore/QSharedPointer>
 
 #include <shared/FileLogger.h>
+#include "NullReplay.h"
 #include "PlayerWindow.h"
 
 Q_DECLARE_LOGGING_CATEGORY(gpu_player_logging)
@@ -23,9 +25,33 @@ static void setup() {
     DependencyManager::set<tracing::Tracer>(); 
 }
 
+static const int DEFAULT_NULL_REPLAY_FRAMES = 100;
+
 int main(int argc, char** argv) {
     setupHifiApplication("gpuFramePlayer");
 
+    // Headless replay against the null backend doesn't need a window, so look for it before creating the QApplication
+    {
+        QCoreApplication app(argc, argv);
+        QCommandLineParser parser;
+        // Qt's own options like -platform offscreen are single dash words, don't split them into short options
+        parser.setSingleDashWordOptionMode(QCommandLineParser::ParseAsLongOptions);
+        const QCommandLineOption helpOption = parser.addHelpOption();
+        const QCommandLineOption nullOption("null", "Replay the frame on the null gpu backend and report the CPU cost of each command", "frame.hfb");
+        const QCommandLineOption framesOption("frames", "Number of frames to replay with --null", "count", QString::number(DEFAULT_NULL_REPLAY_FRAMES));
+        parser.addOption(nullOption);
+        parser.addOption(framesOption);
+        // parse() rather than process(): options meant for QApplication aren't an error
+        parser.parse(app.arguments());
+        if (parser.isSet(helpOption)) {
+            parser.showHelp();
+        }
+        if (parser.isSet(nullOption)) {
+            setup();
+            return replayFrameHeadless(parser.value(nullOption), qMax(parser.value(framesOption).toInt(), 1));
+        }
+    }
+
     QApplication app(argc, argv);
     logger.reset(new FileLogger());
     setup();
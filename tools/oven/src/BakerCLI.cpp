@@ -29,7 +29,7 @@ BakerCLI::BakerCLI(OvenCLIApplication* parent) : QObject(parent) {
 
 }
 
-void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString& type) {
+std::unique_ptr<Baker> BakerCLI::createBaker(QUrl inputUrl, const QString& outputPath, const QString& type) {
 
     // if the URL doesn't have a scheme, assume it is a local file
     if (inputUrl.scheme() != "http" && inputUrl.scheme() != "https" && inputUrl.scheme() != "ftp" && inputUrl.scheme() != "file") {
@@ -43,15 +43,15 @@ void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString&
     static const QString MATERIAL_EXTENSION { "material" };
     static const QString SCRIPT_EXTENSION { "js" };
 
-    _outputPath.setPath(outputPath);
+    std::unique_ptr<Baker> baker;
 
     // create our appropiate baker
     if (type == MODEL_EXTENSION || type == FBX_EXTENSION) {
         QUrl bakeableModelURL = getBakeableModelURL(inputUrl);
         if (!bakeableModelURL.isEmpty()) {
-            _baker = getModelBaker(bakeableModelURL, outputPath);
-            if (_baker) {
-                _baker->moveToThread(Oven::instance().getNextWorkerThread());
+            baker = getModelBaker(bakeableModelURL, outputPath);
+            if (baker) {
+                baker->moveToThread(Oven::instance().getNextWorkerThread());
             }
         }
     } else if (type == SCRIPT_EXTENSION) {
@@ -59,8 +59,8 @@ void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString&
         //_baker = std::unique_ptr<Baker> { new JSBaker(inputUrl, outputPath) };
         //_baker->moveToThread(Oven::instance().getNextWorkerThread());
     } else if (type == MATERIAL_EXTENSION) {
-        _baker = std::unique_ptr<Baker> { new MaterialBaker(inputUrl.toDisplayString(), true, outputPath) };
-        _baker->moveToThread(Oven::instance().getNextWorkerThread());
+        baker = std::unique_ptr<Baker> { new MaterialBaker(inputUrl.toDisplayString(), true, outputPath) };
+        baker->moveToThread(Oven::instance().getNextWorkerThread());
     } else {
         // If the type doesn't match the above, we assume we have a texture, and the type specified is the
         // texture usage type (albedo, cubemap, normals, etc.)
@@ -91,13 +91,20 @@ void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString&
             auto it = STRING_TO_TEXTURE_USAGE_TYPE_MAP.find(type);
             if (it == STRING_TO_TEXTURE_USAGE_TYPE_MAP.end()) {
                 qCDebug(model_baking) << "Unknown texture usage type:" << type;
-                QCoreApplication::exit(OVEN_STATUS_CODE_FAIL);
+                return nullptr;
             }
-            _baker = std::unique_ptr<Baker> { new TextureBaker(inputUrl, it->second, outputPath) };
-            _baker->moveToThread(Oven::instance().getNextWorkerThread());
+            baker = std::unique_ptr<Baker> { new TextureBaker(inputUrl, it->second, outputPath) };
+            baker->moveToThread(Oven::instance().getNextWorkerThread());
         }
     }
 
+    return baker;
+}
+
+void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString& type) {
+    _outputPath.setPath(outputPath);
+    _baker = createBaker(inputUrl, outputPath, type);
+
     if (!_baker) {
         qCDebug(model_baking) << "Failed to determine baker type for file" << inputUrl;
         QCoreApplication::exit(OVEN_STATUS_CODE_FAIL);
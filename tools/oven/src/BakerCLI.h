@@ -33,6 +33,9 @@ class BakerCLI : public QObject {
 public:
     BakerCLI(OvenCLIApplication* parent);
 
+    /// \return a baker for the file, already moved to an oven worker thread, or nullptr if the type isn't bakeable
+    static std::unique_ptr<Baker> createBaker(QUrl inputUrl, const QString& outputPath, const QString& type);
+
 public slots:
     void bakeFile(QUrl inputUrl, const QString& outputPath, const QString& type = QString());
 
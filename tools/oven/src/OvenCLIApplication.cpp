@@ -12,27 +12,53 @@
 #include "OvenCLIApplication.h"
 
 #include <QtCore/QCommandLineParser>
+#include <QtCore/QThread>
 #include <QtCore/QUrl>
 
 #include <iostream>
 
 #include <image/TextureProcessing.h>
+#include <SharedUtil.h>
 #include <TextureBaker.h>
 #include <crash-handler/CrashHandler.h>
 #include "BakerCLI.h"
+#include "OvenServer.h"
 
 static const QString CLI_INPUT_PARAMETER = "i";
 static const QString CLI_OUTPUT_PARAMETER = "o";
 static const QString CLI_TYPE_PARAMETER = "t";
 static const QString CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER = "disable-texture-compression";
+static const QString CLI_SERVER_PARAMETER = "server";
+static const QString CLI_MAX_JOBS_PARAMETER = "max-jobs";
+static const QString CLI_MEMORY_BUDGET_PARAMETER = "memory-budget";
+
+static const uint64_t DEFAULT_SERVER_MEMORY_BUDGET_MB = 4096;
+// Textures are often shared between the assets of a domain, keep their bakes around for the length of an upload
+static const size_t SERVER_TEXTURE_BAKE_CACHE_SIZE = 512 * 1024 * 1024;
 
 QUrl OvenCLIApplication::_inputUrlParameter;
 QUrl OvenCLIApplication::_outputUrlParameter;
 QString OvenCLIApplication::_typeParameter;
+QString OvenCLIApplication::_serverNameParameter;
+int OvenCLIApplication::_maxJobsParameter { 0 };
+uint64_t OvenCLIApplication::_memoryBudgetParameter { 0 };
+int OvenCLIApplication::_parentPIDParameter { -1 };
 
 OvenCLIApplication::OvenCLIApplication(int argc, char* argv[]) :
     QCoreApplication(argc, argv)
 {
+    if (!_serverNameParameter.isEmpty()) {
+        if (_parentPIDParameter != -1) {
+            watchParentProcess(_parentPIDParameter);
+        }
+        TextureBaker::setBakeCacheSize(SERVER_TEXTURE_BAKE_CACHE_SIZE);
+        OvenServer* server = new OvenServer(_serverNameParameter, _maxJobsParameter, _memoryBudgetParameter, this);
+        if (!server->listen()) {
+            QMetaObject::invokeMethod(this, [] { QCoreApplication::exit(OVEN_STATUS_CODE_FAIL); }, Qt::QueuedConnection);
+        }
+        return;
+    }
+
     BakerCLI* cli = new BakerCLI(this);
     QMetaObject::invokeMethod(cli, "bakeFile", Qt::QueuedConnection, Q_ARG(QUrl, _inputUrlParameter),
                               Q_ARG(QString, _outputUrlParameter.toString()), Q_ARG(QString, _typeParameter));
@@ -47,7 +73,12 @@ OvenCLIApplication::parseResult OvenCLIApplication::parseCommandLine(int argc, c
         { CLI_INPUT_PARAMETER, "Path to file that you would like to bake.", "input" },
         { CLI_OUTPUT_PARAMETER, "Path to folder that will be used as output.", "output" },
         { CLI_TYPE_PARAMETER, "Type of asset. [model|material]"/*|js]"*/, "type" },
-        { CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER, "Disable texture compression." }
+        { CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER, "Disable texture compression." },
+        { CLI_SERVER_PARAMETER, "Keep running and bake the jobs sent to the local socket with this name.", "name" },
+        { CLI_MAX_JOBS_PARAMETER, "Number of jobs the server bakes at once. Defaults to the number of cores.", "jobs" },
+        { CLI_MEMORY_BUDGET_PARAMETER, "Estimated memory in MB the server's running jobs may use. Defaults to "
+            + QString::number(DEFAULT_SERVER_MEMORY_BUDGET_MB) + ".", "megabytes" },
+        { PARENT_PID_OPTION, "PID of the process the server quits with.", "parent-pid" }
     });
 
 
@@ -92,17 +123,34 @@ OvenCLIApplication::parseResult OvenCLIApplication::parseCommandLine(int argc, c
         Q_UNREACHABLE();
     }
 
+    if (parser.isSet(CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER)) {
+        qDebug() << "Disabling texture compression";
+        TextureBaker::setCompressionEnabled(false);
+    }
+
+    if (parser.isSet(CLI_SERVER_PARAMETER)) {
+        _serverNameParameter = parser.value(CLI_SERVER_PARAMETER);
+        _maxJobsParameter = parser.isSet(CLI_MAX_JOBS_PARAMETER) ? parser.value(CLI_MAX_JOBS_PARAMETER).toInt()
+                                                                 : QThread::idealThreadCount();
+        uint64_t memoryBudgetMB = parser.isSet(CLI_MEMORY_BUDGET_PARAMETER) ? parser.value(CLI_MEMORY_BUDGET_PARAMETER).toULongLong()
+                                                                           : DEFAULT_SERVER_MEMORY_BUDGET_MB;
+        _memoryBudgetParameter = memoryBudgetMB * 1024 * 1024;
+        if (parser.isSet(PARENT_PID_OPTION)) {
+            bool ok = false;
+            int parentPID = parser.value(PARENT_PID_OPTION).toInt(&ok);
+            if (ok) {
+                _parentPIDParameter = parentPID;
+            }
+        }
+        return OvenCLIApplication::CLIMode;
+    }
+
     if (parser.isSet(CLI_INPUT_PARAMETER) &&  parser.isSet(CLI_OUTPUT_PARAMETER)) {
         _inputUrlParameter = QDir::fromNativeSeparators(parser.value(CLI_INPUT_PARAMETER));
         _outputUrlParameter = QDir::fromNativeSeparators(parser.value(CLI_OUTPUT_PARAMETER));
 
         _typeParameter = parser.isSet(CLI_TYPE_PARAMETER) ? parser.value(CLI_TYPE_PARAMETER) : QString();
 
-        if (parser.isSet(CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER)) {
-            qDebug() << "Disabling texture compression";
-            TextureBaker::setCompressionEnabled(false);
-        }
-
         return OvenCLIApplication::CLIMode;
     } else {
         return OvenCLIApplication::GUIMode;
@@ -47,6 +47,10 @@ private:
     static QUrl _inputUrlParameter;
     static QUrl _outputUrlParameter;
     static QString _typeParameter;
+    static QString _serverNameParameter;
+    static int _maxJobsParameter;
+    static uint64_t _memoryBudgetParameter;
+    static int _parentPIDParameter;
 };
 
 #endif // hifi_OvenCLIApplication_h
@@ -0,0 +1,204 @@
+//
+//  OvenServer.cpp
+//  tools/oven/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "OvenServer.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+
+#include <algorithm>
+
+#include <SharedUtil.h>
+
+#include "BakerCLI.h"
+#include "ModelBakingLoggingCategory.h"
+
+// Baking decodes textures, embedded or not, to several times their file size, so jobs are weighed by their input size
+static const uint64_t BAKE_MEMORY_PER_INPUT_BYTE = 16;
+static const uint64_t MIN_BAKE_MEMORY_ESTIMATE = 32 * 1024 * 1024;
+static const uint64_t REMOTE_BAKE_MEMORY_ESTIMATE = 256 * 1024 * 1024;
+
+static uint64_t estimateBakeMemory(const QUrl& inputUrl) {
+    if (!inputUrl.isLocalFile()) {
+        return REMOTE_BAKE_MEMORY_ESTIMATE;
+    }
+    uint64_t inputSize = QFileInfo(inputUrl.toLocalFile()).size();
+    return std::max(inputSize * BAKE_MEMORY_PER_INPUT_BYTE, MIN_BAKE_MEMORY_ESTIMATE);
+}
+
+OvenServer::OvenServer(const QString& serverName, int maxJobs, uint64_t memoryBudget, QObject* parent) :
+    QObject(parent),
+    _serverName(serverName),
+    _maxJobs(std::max(maxJobs, 1)),
+    _memoryBudget(memoryBudget)
+{
+    connect(&_server, &QLocalServer::newConnection, this, &OvenServer::handleNewConnection);
+}
+
+OvenServer::~OvenServer() {
+    for (auto& job : _runningJobs) {
+        job->baker->abort();
+        job->baker.release()->deleteLater();
+    }
+}
+
+bool OvenServer::listen() {
+    // a server that didn't shut down cleanly leaves its socket behind
+    QLocalServer::removeServer(_serverName);
+    if (!_server.listen(_serverName)) {
+        qCWarning(model_baking) << "Oven server could not listen on" << _serverName << "-" << _server.errorString();
+        return false;
+    }
+    qCInfo(model_baking) << "Oven server listening on" << _server.fullServerName() << "running up to" << _maxJobs
+        << "jobs in" << (_memoryBudget / (1024 * 1024)) << "MB";
+    return true;
+}
+
+void OvenServer::handleNewConnection() {
+    while (auto client = _server.nextPendingConnection()) {
+        connect(client, &QLocalSocket::readyRead, this, &OvenServer::handleReadyRead);
+        connect(client, &QLocalSocket::disconnected, this, &OvenServer::handleDisconnected);
+    }
+}
+
+void OvenServer::handleReadyRead() {
+    auto client = qobject_cast<QLocalSocket*>(sender());
+    if (!client) {
+        return;
+    }
+
+    while (client->canReadLine()) {
+        QJsonParseError error;
+        auto request = QJsonDocument::fromJson(client->readLine(), &error);
+        if (error.error != QJsonParseError::NoError || !request.isObject()) {
+            qCWarning(model_baking) << "Oven server ignoring invalid job:" << error.errorString();
+            continue;
+        }
+        queueJob(client, request.object());
+    }
+    startJobs();
+}
+
+void OvenServer::handleDisconnected() {
+    auto client = qobject_cast<QLocalSocket*>(sender());
+    if (!client) {
+        return;
+    }
+
+    // nobody is waiting for these anymore
+    auto it = std::remove_if(_queuedJobs.begin(), _queuedJobs.end(), [client](const JobPointer& job) {
+        return job->client == client;
+    });
+    _queuedJobs.erase(it, _queuedJobs.end());
+
+    for (auto& job : _runningJobs) {
+        if (job->client == client) {
+            job->client = nullptr;
+            QMetaObject::invokeMethod(job->baker.get(), "abort");
+        }
+    }
+    client->deleteLater();
+    startJobs();
+}
+
+void OvenServer::queueJob(QLocalSocket* client, const QJsonObject& request) {
+    auto job = std::make_shared<Job>();
+    job->client = client;
+    job->id = request[OVEN_SERVER_JOB_ID_KEY];
+    job->inputUrl = QDir::fromNativeSeparators(request[OVEN_SERVER_JOB_INPUT_KEY].toString());
+    job->outputPath = QDir::fromNativeSeparators(request[OVEN_SERVER_JOB_OUTPUT_KEY].toString());
+    job->type = request[OVEN_SERVER_JOB_TYPE_KEY].toString();
+    job->queuedTime = usecTimestampNow();
+
+    // same as on the command line, anything without a known scheme is a local file
+    auto scheme = job->inputUrl.scheme();
+    if (scheme != "http" && scheme != "https" && scheme != "ftp" && scheme != "file") {
+        job->inputUrl = QUrl::fromLocalFile(job->inputUrl.toString());
+    }
+    job->estimatedMemory = estimateBakeMemory(job->inputUrl);
+
+    _queuedJobs.push_back(job);
+}
+
+void OvenServer::startJobs() {
+    while (!_queuedJobs.empty() && (int)_runningJobs.size() < _maxJobs) {
+        auto job = _queuedJobs.front();
+        if (!_runningJobs.empty() && _runningMemory + job->estimatedMemory > _memoryBudget) {
+            break;
+        }
+        _queuedJobs.pop_front();
+
+        job->startTime = usecTimestampNow();
+        job->baker = BakerCLI::createBaker(job->inputUrl, job->outputPath, job->type);
+        if (!job->baker) {
+            finishJob(job, OVEN_STATUS_CODE_FAIL, { "Failed to determine baker type for file " + job->inputUrl.toString() });
+            continue;
+        }
+
+        _runningJobs.push_back(job);
+        _runningMemory += job->estimatedMemory;
+
+        connect(job->baker.get(), &Baker::finished, this, &OvenServer::handleFinishedBaker);
+        connect(job->baker.get(), &Baker::aborted, this, &OvenServer::handleFinishedBaker);
+        QMetaObject::invokeMethod(job->baker.get(), "bake");
+    }
+}
+
+void OvenServer::handleFinishedBaker() {
+    auto baker = qobject_cast<Baker*>(sender());
+    auto it = std::find_if(_runningJobs.begin(), _runningJobs.end(), [baker](const JobPointer& job) {
+        return job->baker.get() == baker;
+    });
+    // an aborted baker can report both that it was aborted and that it finished
+    if (!baker || it == _runningJobs.end()) {
+        return;
+    }
+
+    auto job = *it;
+    int statusCode = OVEN_STATUS_CODE_SUCCESS;
+    if (baker->wasAborted()) {
+        statusCode = OVEN_STATUS_CODE_ABORT;
+    } else if (baker->hasErrors()) {
+        statusCode = OVEN_STATUS_CODE_FAIL;
+    }
+    finishJob(job, statusCode, baker->getErrors());
+    startJobs();
+}
+
+void OvenServer::finishJob(const JobPointer& job, int statusCode, const QStringList& errors) {
+    auto it = std::find(_runningJobs.begin(), _runningJobs.end(), job);
+    if (it != _runningJobs.end()) {
+        _runningJobs.erase(it);
+        _runningMemory -= job->estimatedMemory;
+    }
+
+    auto now = usecTimestampNow();
+    auto queueMsecs = (job->startTime - job->queuedTime) / USECS_PER_MSEC;
+    auto bakeMsecs = (now - job->startTime) / USECS_PER_MSEC;
+    qCDebug(model_baking) << "Oven server finished" << job->inputUrl << "with status" << statusCode << "after queueing for"
+        << queueMsecs << "ms and baking for" << bakeMsecs << "ms";
+
+    if (job->baker) {
+        disconnect(job->baker.get(), nullptr, this, nullptr);
+        job->baker.release()->deleteLater();
+    }
+
+    if (job->client) {
+        QJsonObject reply;
+        reply[OVEN_SERVER_JOB_ID_KEY] = job->id;
+        reply[OVEN_SERVER_JOB_STATUS_KEY] = statusCode;
+        reply[OVEN_SERVER_JOB_ERRORS_KEY] = errors.join('\n');
+        reply[OVEN_SERVER_JOB_QUEUE_MSECS_KEY] = (qint64)queueMsecs;
+        reply[OVEN_SERVER_JOB_BAKE_MSECS_KEY] = (qint64)bakeMsecs;
+        job->client->write(QJsonDocument(reply).toJson(QJsonDocument::Compact) + '\n');
+    }
+}
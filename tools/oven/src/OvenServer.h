@@ -0,0 +1,89 @@
+//
+//  OvenServer.h
+//  tools/oven/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_OvenServer_h
+#define hifi_OvenServer_h
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QObject>
+#include <QtCore/QUrl>
+#include <QtNetwork/QLocalServer>
+#include <QtNetwork/QLocalSocket>
+
+#include <deque>
+#include <memory>
+
+#include "Baker.h"
+
+static const QString OVEN_SERVER_JOB_ID_KEY = "id";
+static const QString OVEN_SERVER_JOB_INPUT_KEY = "input";
+static const QString OVEN_SERVER_JOB_OUTPUT_KEY = "output";
+static const QString OVEN_SERVER_JOB_TYPE_KEY = "type";
+static const QString OVEN_SERVER_JOB_STATUS_KEY = "status";
+static const QString OVEN_SERVER_JOB_ERRORS_KEY = "errors";
+static const QString OVEN_SERVER_JOB_QUEUE_MSECS_KEY = "queueMsecs";
+static const QString OVEN_SERVER_JOB_BAKE_MSECS_KEY = "bakeMsecs";
+
+/// Keeps one oven running to bake many assets, so that bakes don't pay for starting the process and shared textures
+/// are only baked once.
+///
+/// Clients connect to the local socket and write one JSON object per line describing a job, using the same input,
+/// output and type as the command line.  Each job is answered with a line holding its id, its status (the
+/// OVEN_STATUS_CODE_* of the command line), any errors and how long it queued and baked for.  Jobs of a client that
+/// disconnects are aborted.
+///
+/// Jobs start in order, as long as fewer than maxJobs are running and their estimated memory use fits in the budget
+/// along with the running ones.  A job that doesn't fit waits for running jobs to finish, but always starts when
+/// nothing else is running.
+class OvenServer : public QObject {
+    Q_OBJECT
+
+public:
+    OvenServer(const QString& serverName, int maxJobs, uint64_t memoryBudget, QObject* parent = nullptr);
+    ~OvenServer();
+
+    bool listen();
+
+private slots:
+    void handleNewConnection();
+    void handleReadyRead();
+    void handleDisconnected();
+    void handleFinishedBaker();
+
+private:
+    struct Job {
+        QLocalSocket* client;
+        QJsonValue id;
+        QUrl inputUrl;
+        QString outputPath;
+        QString type;
+        uint64_t estimatedMemory;
+        quint64 queuedTime;
+        quint64 startTime { 0 };
+        std::unique_ptr<Baker> baker;
+    };
+    using JobPointer = std::shared_ptr<Job>;
+
+    void queueJob(QLocalSocket* client, const QJsonObject& request);
+    void startJobs();
+    void finishJob(const JobPointer& job, int statusCode, const QStringList& errors);
+
+    QString _serverName;
+    QLocalServer _server;
+    const int _maxJobs;
+    const uint64_t _memoryBudget;
+
+    std::deque<JobPointer> _queuedJobs;
+    std::vector<JobPointer> _runningJobs;
+    uint64_t _runningMemory { 0 };
+};
+
+#endif // hifi_OvenServer_h
@@ -0,0 +1,74 @@
+//
+//  main.cpp
+//  tools/trace-tool/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDebug>
+#include <QtCore/QFile>
+
+#include <Gzip.h>
+#include <SharedUtil.h>
+#include <Trace.h>
+
+// Converts the binary traces dumped by servers to Chrome trace JSON, for chrome://tracing or Perfetto to open
+int main(int argc, char* argv[]) {
+    setupHifiApplication("Trace Tool");
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Converts a binary trace (.hftrace, optionally gzipped) to Chrome trace JSON, "
+                                     "gzipped when the output ends with .gz");
+    parser.addHelpOption();
+    parser.addPositionalArgument("input", "The binary trace to convert.");
+    parser.addPositionalArgument("output", "The Chrome trace to write, defaults to the input with a .json extension.");
+    parser.process(app);
+
+    auto arguments = parser.positionalArguments();
+    if (arguments.empty() || arguments.size() > 2) {
+        parser.showHelp(1);
+    }
+
+    QString inputPath = arguments[0];
+    QString outputPath = arguments.size() > 1 ? arguments[1] : inputPath.left(inputPath.lastIndexOf('.')) + ".json";
+
+    QFile inputFile(inputPath);
+    if (!inputFile.open(QIODevice::ReadOnly)) {
+        qCritical() << "Could not open" << inputPath;
+        return 1;
+    }
+    QByteArray dump = inputFile.readAll();
+
+    // traces downloaded or copied by hand may still be compressed
+    QByteArray uncompressed;
+    if (gunzip(dump, uncompressed)) {
+        dump = uncompressed;
+    }
+
+    QByteArray trace = tracing::Tracer::toChromeTrace(dump);
+    if (trace.isEmpty()) {
+        qCritical() << inputPath << "is not a binary trace";
+        return 1;
+    }
+
+    if (outputPath.endsWith(".gz")) {
+        QByteArray compressed;
+        gzip(trace, compressed);
+        trace = compressed;
+    }
+
+    QFile outputFile(outputPath);
+    if (!outputFile.open(QIODevice::WriteOnly) || outputFile.write(trace) != trace.size()) {
+        qCritical() << "Could not write" << outputPath;
+        return 1;
+    }
+    qDebug() << "Wrote" << outputPath;
+    return 0;
+}